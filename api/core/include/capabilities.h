@@ -109,6 +109,10 @@ struct ICapabilities {
      
      */
     virtual bool supported( const std::string& capability, Firebolt::Error *err = nullptr ) = 0;
+
+    // New methods go last, existing binaries keep the layout of the interface
+    // info(), into a list the caller keeps across calls: its elements are decoded over, not allocated again
+    virtual void info( const std::vector<std::string>& capabilities, std::vector<CapabilityInfo>& info, Firebolt::Error *err = nullptr ) = 0;
 };
 
 } //namespace Capabilities
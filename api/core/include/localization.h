@@ -140,6 +140,9 @@ struct ILocalization {
      */
     virtual std::vector<std::string> preferredAudioLanguages( Firebolt::Error *err = nullptr ) const = 0;
 
+    // New methods go last, existing binaries keep the layout of the interface
+    // preferredAudioLanguages(), into a list the caller keeps across calls: its strings are decoded over, not allocated again
+    virtual void preferredAudioLanguages( std::vector<std::string>& languages, Firebolt::Error *err = nullptr ) const = 0;
 };
 
 } //namespace Localization
@@ -37,7 +37,7 @@ namespace Accessibility {
         if (status == Firebolt::Error::None) {
             AudioDescriptionSettings settingsResult;
             settingsResult.enabled = jsonResult.Enabled.Value();
-            settings = settingsResult;
+            settings = std::move(settingsResult);
         }
         if (err != nullptr) {
             *err = status;
@@ -106,7 +106,7 @@ namespace Accessibility {
                         closedCaptionsSettingsResult.preferredLanguages.value().push_back(preferredLanguagesIndex.Current().Value());
                     }
                 }
-                closedCaptionsSettings = closedCaptionsSettingsResult;
+                closedCaptionsSettings = std::move(closedCaptionsSettingsResult);
         }
 
         if (err != nullptr) {
@@ -175,7 +175,7 @@ namespace Accessibility {
                     closedCaptionsSettingsResult.preferredLanguages.value().push_back(preferredLanguagesIndex.Current().Value());
                 }
             }
-            closedCaptionsSettings = closedCaptionsSettingsResult;
+            closedCaptionsSettings = std::move(closedCaptionsSettingsResult);
         }
         if (err != nullptr) {
             *err = status;
@@ -223,7 +223,7 @@ namespace Accessibility {
                 if (jsonResult.Speed.IsSet()) {
                     settingsResult.speed = jsonResult.Speed.Value();
                 }
-                settings = settingsResult;
+                settings = std::move(settingsResult);
         }
 
         if (err != nullptr) {
@@ -251,7 +251,7 @@ namespace Accessibility {
             if (jsonResult.Speed.IsSet()) {
                 settingsResult.speed = jsonResult.Speed.Value();
             }
-            settings = settingsResult;
+            settings = std::move(settingsResult);
         }
         if (err != nullptr) {
             *err = status;
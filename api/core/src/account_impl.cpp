@@ -30,13 +30,10 @@ namespace Account {
         const string method = _T("account.id");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string id;
+        FireboltSDK::Decoded<std::string> jsonResult(id);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            id = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -50,13 +47,10 @@ namespace Account {
         const string method = _T("account.uid");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string uniqueId;
+        FireboltSDK::Decoded<std::string> jsonResult(uniqueId);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            uniqueId = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -56,7 +56,7 @@ namespace Advertising {
                 if (jsonResult.Lmt.IsSet()) {
                     advertisingIdResult.lmt = jsonResult.Lmt.Value();
                 }
-                advertisingId = advertisingIdResult;
+                advertisingId = std::move(advertisingIdResult);
         }
 
         if (err != nullptr) {
@@ -74,11 +74,10 @@ namespace Advertising {
 
         JsonObject jsonParameters;
 
-        FireboltSDK::JSON::String jsonResult;
+        FireboltSDK::Decoded<std::string> jsonResult(appBundleId);
         status = FireboltSDK::Gateway::Instance().Request("advertising.appBundleId", jsonParameters, jsonResult);
         if (status == Firebolt::Error::None) {
             FIREBOLT_LOG_INFO(FireboltSDK::Logger::Category::OpenRPC, FireboltSDK::Logger::Module<FireboltSDK::Accessor>(), "Advertising.appBundleId is successfully invoked");
-            appBundleId = jsonResult.Value().c_str();
         }
 
         if (err != nullptr) {
@@ -171,7 +170,7 @@ namespace Advertising {
             if (jsonResult.LimitAdTracking.IsSet()) {
                 adPolicyResult.limitAdTracking = jsonResult.LimitAdTracking.Value();
             }
-            adPolicy = adPolicyResult;
+            adPolicy = std::move(adPolicyResult);
         }
         if (err != nullptr) {
             *err = status;
@@ -32,11 +32,10 @@ namespace Authentication {
 
         JsonObject jsonParameters;
 
-        FireboltSDK::JSON::String jsonResult;
+        FireboltSDK::Decoded<std::string> jsonResult(token);
         status = FireboltSDK::Gateway::Instance().Request("authentication.device", jsonParameters, jsonResult);
         if (status == Firebolt::Error::None) {
             FIREBOLT_LOG_INFO(FireboltSDK::Logger::Category::OpenRPC, FireboltSDK::Logger::Module<FireboltSDK::Accessor>(), "Authentication.device is successfully invoked");
-            token = jsonResult.Value().c_str();
         }
 
         if (err != nullptr) {
@@ -54,11 +53,10 @@ namespace Authentication {
 
         JsonObject jsonParameters;
 
-        FireboltSDK::JSON::String jsonResult;
+        FireboltSDK::Decoded<std::string> jsonResult(token);
         status = FireboltSDK::Gateway::Instance().Request("authentication.root", jsonParameters, jsonResult);
         if (status == Firebolt::Error::None) {
             FIREBOLT_LOG_INFO(FireboltSDK::Logger::Category::OpenRPC, FireboltSDK::Logger::Module<FireboltSDK::Accessor>(), "Authentication.root is successfully invoked");
-            token = jsonResult.Value().c_str();
         }
 
         if (err != nullptr) {
@@ -76,11 +74,10 @@ namespace Authentication {
 
         JsonObject jsonParameters;
 
-        FireboltSDK::JSON::String jsonResult;
+        FireboltSDK::Decoded<std::string> jsonResult(token);
         status = FireboltSDK::Gateway::Instance().Request("authentication.session", jsonParameters, jsonResult);
         if (status == Firebolt::Error::None) {
             FIREBOLT_LOG_INFO(FireboltSDK::Logger::Category::OpenRPC, FireboltSDK::Logger::Module<FireboltSDK::Accessor>(), "Authentication.session is successfully invoked");
-            token = jsonResult.Value().c_str();
         }
 
         if (err != nullptr) {
@@ -116,7 +113,7 @@ namespace Authentication {
                 if (jsonResult.Type.IsSet()) {
                     tokenResult.type = jsonResult.Type.Value();
                 }
-                token = tokenResult;
+                token = std::move(tokenResult);
         }
 
         if (err != nullptr) {
@@ -83,10 +83,15 @@ namespace Capabilities {
     }
 
     /* info - Returns an array of CapabilityInfo objects for the passed in capabilities. */
-    std::vector<CapabilityInfo> CapabilitiesImpl::info( const std::vector<std::string>& capabilities, Firebolt::Error *err ) 
+    std::vector<CapabilityInfo> CapabilitiesImpl::info( const std::vector<std::string>& capabilities, Firebolt::Error *err )
     {
-        Firebolt::Error status = Firebolt::Error::NotConnected;
         std::vector<CapabilityInfo> info;
+        this->info(capabilities, info, err);
+        return info;
+    }
+    void CapabilitiesImpl::info( const std::vector<std::string>& capabilities, std::vector<CapabilityInfo>& info, Firebolt::Error *err )
+    {
+        Firebolt::Error status = Firebolt::Error::NotConnected;
 
         JsonObject jsonParameters;
         WPEFramework::Core::JSON::ArrayType<WPEFramework::Core::JSON::Variant> capabilitiesArray;
@@ -96,59 +101,17 @@ namespace Capabilities {
             WPEFramework::Core::JSON::Variant capabilitiesVariant;
             capabilitiesVariant.Array(capabilitiesArray);
             jsonParameters.Set(_T("capabilities"), capabilitiesVariant);
-        WPEFramework::Core::JSON::ArrayType<Firebolt::Capabilities::JsonData_CapabilityInfo> jsonResult;
+        FireboltSDK::Decoded<std::vector<CapabilityInfo>> jsonResult(info);
         status = FireboltSDK::Gateway::Instance().Request("capabilities.info", jsonParameters, jsonResult);
         if (status == Firebolt::Error::None) {
             FIREBOLT_LOG_INFO(FireboltSDK::Logger::Category::OpenRPC, FireboltSDK::Logger::Module<FireboltSDK::Accessor>(), "Capabilities.info is successfully invoked");
-            auto index(jsonResult.Elements());
-                while (index.Next() == true) {
-                    CapabilityInfo infoResult1;
-                    JsonData_CapabilityInfo jsonResult = index.Current();
-                    if (jsonResult.Capability.IsSet()) {
-                        infoResult1.capability = jsonResult.Capability.Value();
-                    }
-                    infoResult1.supported = jsonResult.Supported.Value();
-                    infoResult1.available = jsonResult.Available.Value();
-                    {
-                      if (jsonResult.Use.Permitted.IsSet()) {
-                            infoResult1.use.permitted = jsonResult.Use.Permitted;
-                        }
-                      if (jsonResult.Use.Granted.IsSet()) {
-                            infoResult1.use.granted = jsonResult.Use.Granted;
-                        }
-                    }
-                    {
-                      if (jsonResult.Manage.Permitted.IsSet()) {
-                            infoResult1.manage.permitted = jsonResult.Manage.Permitted;
-                        }
-                      if (jsonResult.Manage.Granted.IsSet()) {
-                            infoResult1.manage.granted = jsonResult.Manage.Granted;
-                        }
-                    }
-                    {
-                      if (jsonResult.Provide.Permitted.IsSet()) {
-                            infoResult1.provide.permitted = jsonResult.Provide.Permitted;
-                        }
-                      if (jsonResult.Provide.Granted.IsSet()) {
-                            infoResult1.provide.granted = jsonResult.Provide.Granted;
-                        }
-                    }
-                    if (jsonResult.Details.IsSet()) {
-                        infoResult1.details = std::make_optional<std::vector<DenyReason>>();
-                        auto detailsIndex(jsonResult.Details.Elements());
-                        while (detailsIndex.Next() == true) {
-                            infoResult1.details.value().push_back(detailsIndex.Current().Value());
-                        }
-                    }
-                    info.push_back(infoResult1);
-                }
+        } else {
+            info.clear();
         }
 
         if (err != nullptr) {
             *err = status;
         }
-
-        return info;
     }
 
     /* permitted - Returns whether the current App has permission to the passed capability and role. */
@@ -211,52 +174,12 @@ namespace Capabilities {
             WPEFramework::Core::JSON::Variant grantsVariant;
             grantsVariant.Array(grantsArray);
             jsonParameters.Set(_T("grants"), grantsVariant);
-        WPEFramework::Core::JSON::ArrayType<Firebolt::Capabilities::JsonData_CapabilityInfo> jsonResult;
+        FireboltSDK::Decoded<std::vector<CapabilityInfo>> jsonResult(request);
         status = FireboltSDK::Gateway::Instance().Request("capabilities.request", jsonParameters, jsonResult);
         if (status == Firebolt::Error::None) {
             FIREBOLT_LOG_INFO(FireboltSDK::Logger::Category::OpenRPC, FireboltSDK::Logger::Module<FireboltSDK::Accessor>(), "Capabilities.request is successfully invoked");
-            auto index(jsonResult.Elements());
-                while (index.Next() == true) {
-                    CapabilityInfo requestResult1;
-                    JsonData_CapabilityInfo jsonResult = index.Current();
-                    if (jsonResult.Capability.IsSet()) {
-                        requestResult1.capability = jsonResult.Capability.Value();
-                    }
-                    requestResult1.supported = jsonResult.Supported.Value();
-                    requestResult1.available = jsonResult.Available.Value();
-                    {
-                      if (jsonResult.Use.Permitted.IsSet()) {
-                            requestResult1.use.permitted = jsonResult.Use.Permitted;
-                        }
-                      if (jsonResult.Use.Granted.IsSet()) {
-                            requestResult1.use.granted = jsonResult.Use.Granted;
-                        }
-                    }
-                    {
-                      if (jsonResult.Manage.Permitted.IsSet()) {
-                            requestResult1.manage.permitted = jsonResult.Manage.Permitted;
-                        }
-                      if (jsonResult.Manage.Granted.IsSet()) {
-                            requestResult1.manage.granted = jsonResult.Manage.Granted;
-                        }
-                    }
-                    {
-                      if (jsonResult.Provide.Permitted.IsSet()) {
-                            requestResult1.provide.permitted = jsonResult.Provide.Permitted;
-                        }
-                      if (jsonResult.Provide.Granted.IsSet()) {
-                            requestResult1.provide.granted = jsonResult.Provide.Granted;
-                        }
-                    }
-                    if (jsonResult.Details.IsSet()) {
-                        requestResult1.details = std::make_optional<std::vector<DenyReason>>();
-                        auto detailsIndex(jsonResult.Details.Elements());
-                        while (detailsIndex.Next() == true) {
-                            requestResult1.details.value().push_back(detailsIndex.Current().Value());
-                        }
-                    }
-                    request.push_back(requestResult1);
-                }
+        } else {
+            request.clear();
         }
 
         if (err != nullptr) {
@@ -85,6 +85,7 @@ namespace Capabilities {
          Returns an array of CapabilityInfo objects for the passed in capabilities.
          */
         std::vector<CapabilityInfo> info( const std::vector<std::string>& capabilities, Firebolt::Error *err = nullptr ) override;
+        void info( const std::vector<std::string>& capabilities, std::vector<CapabilityInfo>& info, Firebolt::Error *err = nullptr ) override;
 
         // signature callback params: 
         // method result properties : 
@@ -56,18 +56,11 @@ namespace Device {
         const string method = _T("device.audio");
         
         
-        Firebolt::Device::JsonData_AudioProfiles jsonResult;
+        FireboltSDK::Arena arena;
         AudioProfiles supportedAudioProfiles;
+        FireboltSDK::Decoded<AudioProfiles> jsonResult(supportedAudioProfiles);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            AudioProfiles supportedAudioProfilesResult;
-            supportedAudioProfilesResult.stereo = jsonResult.Stereo.Value();
-            supportedAudioProfilesResult.dolbyDigital5_1 = jsonResult.DolbyDigital5_1.Value();
-            supportedAudioProfilesResult.dolbyDigital5_1_plus = jsonResult.DolbyDigital5_1_plus.Value();
-            supportedAudioProfilesResult.dolbyAtmos = jsonResult.DolbyAtmos.Value();
-            supportedAudioProfiles = supportedAudioProfilesResult;
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -81,13 +74,10 @@ namespace Device {
         const string method = _T("device.distributor");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string distributorId;
+        FireboltSDK::Decoded<std::string> jsonResult(distributorId);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            distributorId = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -103,16 +93,11 @@ namespace Device {
         const string method = _T("device.hdcp");
         
         
-        Firebolt::Device::JsonData_HDCPVersionMap jsonResult;
+        FireboltSDK::Arena arena;
         HDCPVersionMap negotiatedHdcpVersions;
+        FireboltSDK::Decoded<HDCPVersionMap> jsonResult(negotiatedHdcpVersions);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            HDCPVersionMap negotiatedHdcpVersionsResult;
-            negotiatedHdcpVersionsResult.hdcp1_4 = jsonResult.Hdcp1_4.Value();
-            negotiatedHdcpVersionsResult.hdcp2_2 = jsonResult.Hdcp2_2.Value();
-            negotiatedHdcpVersions = negotiatedHdcpVersionsResult;
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -126,18 +111,11 @@ namespace Device {
         const string method = _T("device.hdr");
         
         
-        Firebolt::Device::JsonData_HDRFormatMap jsonResult;
+        FireboltSDK::Arena arena;
         HDRFormatMap negotiatedHdrFormats;
+        FireboltSDK::Decoded<HDRFormatMap> jsonResult(negotiatedHdrFormats);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            HDRFormatMap negotiatedHdrFormatsResult;
-            negotiatedHdrFormatsResult.hdr10 = jsonResult.Hdr10.Value();
-            negotiatedHdrFormatsResult.hdr10Plus = jsonResult.Hdr10Plus.Value();
-            negotiatedHdrFormatsResult.dolbyVision = jsonResult.DolbyVision.Value();
-            negotiatedHdrFormatsResult.hlg = jsonResult.Hlg.Value();
-            negotiatedHdrFormats = negotiatedHdrFormatsResult;
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -151,13 +129,10 @@ namespace Device {
         const string method = _T("device.id");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string id;
+        FireboltSDK::Decoded<std::string> jsonResult(id);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            id = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -171,13 +146,10 @@ namespace Device {
         const string method = _T("device.make");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string make;
+        FireboltSDK::Decoded<std::string> jsonResult(make);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            make = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -191,13 +163,10 @@ namespace Device {
         const string method = _T("device.model");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string model;
+        FireboltSDK::Decoded<std::string> jsonResult(model);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            model = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -211,13 +180,10 @@ namespace Device {
         const string method = _T("device.name");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string value;
+        FireboltSDK::Decoded<std::string> jsonResult(value);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            value = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -239,7 +205,7 @@ namespace Device {
             NetworkInfoResult networkInfoResult;
             networkInfoResult.state = jsonResult.State.Value();
             networkInfoResult.type = jsonResult.Type.Value();
-            networkInfo = networkInfoResult;
+            networkInfo = std::move(networkInfoResult);
         }
         if (err != nullptr) {
             *err = status;
@@ -254,13 +220,10 @@ namespace Device {
         const string method = _T("device.platform");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string platformId;
+        FireboltSDK::Decoded<std::string> jsonResult(platformId);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            platformId = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -313,13 +276,10 @@ Full HD (FHD): [1920, 1080]
         const string method = _T("device.sku");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string sku;
+        FireboltSDK::Decoded<std::string> jsonResult(sku);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            sku = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -333,13 +293,10 @@ Full HD (FHD): [1920, 1080]
         const string method = _T("device.type");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string deviceType;
+        FireboltSDK::Decoded<std::string> jsonResult(deviceType);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            deviceType = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -353,13 +310,10 @@ Full HD (FHD): [1920, 1080]
         const string method = _T("device.uid");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string uniqueId;
+        FireboltSDK::Decoded<std::string> jsonResult(uniqueId);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            uniqueId = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -250,6 +250,63 @@ namespace Device {
         WPEFramework::Core::JSON::Boolean Hdcp2_2;
     };
 
+    // Decoders, filling the public types straight from the result
+    inline bool Decode(FireboltSDK::JsonReader& reader, HDRFormatMap& value)
+    {
+        std::string_view key;
+        bool decoded = reader.BeginObject();
+        while ((decoded == true) && (reader.Next(key) == true)) {
+            if (key == "hdr10") {
+                decoded = reader.Read(value.hdr10);
+            } else if (key == "hdr10Plus") {
+                decoded = reader.Read(value.hdr10Plus);
+            } else if (key == "dolbyVision") {
+                decoded = reader.Read(value.dolbyVision);
+            } else if (key == "hlg") {
+                decoded = reader.Read(value.hlg);
+            } else {
+                decoded = reader.Skip();
+            }
+        }
+        return (reader.Failed() == false);
+    }
+
+    inline bool Decode(FireboltSDK::JsonReader& reader, AudioProfiles& value)
+    {
+        std::string_view key;
+        bool decoded = reader.BeginObject();
+        while ((decoded == true) && (reader.Next(key) == true)) {
+            if (key == "stereo") {
+                decoded = reader.Read(value.stereo);
+            } else if (key == "dolbyDigital5.1") {
+                decoded = reader.Read(value.dolbyDigital5_1);
+            } else if (key == "dolbyDigital5.1+") {
+                decoded = reader.Read(value.dolbyDigital5_1_plus);
+            } else if (key == "dolbyAtmos") {
+                decoded = reader.Read(value.dolbyAtmos);
+            } else {
+                decoded = reader.Skip();
+            }
+        }
+        return (reader.Failed() == false);
+    }
+
+    inline bool Decode(FireboltSDK::JsonReader& reader, HDCPVersionMap& value)
+    {
+        std::string_view key;
+        bool decoded = reader.BeginObject();
+        while ((decoded == true) && (reader.Next(key) == true)) {
+            if (key == "hdcp1.4") {
+                decoded = reader.Read(value.hdcp1_4);
+            } else if (key == "hdcp2.2") {
+                decoded = reader.Read(value.hdcp2_2);
+            } else {
+                decoded = reader.Skip();
+            }
+        }
+        return (reader.Failed() == false);
+    }
+
     class DeviceImpl : public IDevice, public IModule {
 
     public:
@@ -73,58 +73,11 @@ namespace Discovery {
         Firebolt::Error status = Firebolt::Error::NotConnected;
 
 
-        JsonObject jsonParameters;
-        auto element = ids;
-            JsonData_ContentAccessIdentifiers idsContainer;
-            {
-                if (element.availabilities.has_value()) {
-                    WPEFramework::Core::JSON::ArrayType<Firebolt::Discovery::JsonData_Availability> availabilitiesArray;
-                    std::vector<Availability> availabilities = element.availabilities.value();
-                    for (auto& element : availabilities) {
-                        Firebolt::Discovery::JsonData_Availability availabilitiesContainer;
-                        {
-                            availabilitiesContainer.Type = element.type;
-                            availabilitiesContainer.Id = element.id;
-                            if (element.catalogId.has_value()) {
-                                availabilitiesContainer.CatalogId = element.catalogId.value();
-                            }
-                            if (element.startTime.has_value()) {
-                                availabilitiesContainer.StartTime = element.startTime.value();
-                            }
-                            if (element.endTime.has_value()) {
-                                availabilitiesContainer.EndTime = element.endTime.value();
-                            }
-                        }
-                        availabilitiesArray.Add() = availabilitiesContainer;
-                    }
-                    idsContainer.Availabilities = availabilitiesArray;
-                }
-                if (element.entitlements.has_value()) {
-                    WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_Entitlement> entitlementsArray;
-                    std::vector<Entertainment::Entitlement> entitlements = element.entitlements.value();
-                    for (auto& element : entitlements) {
-                        Firebolt::Entertainment::JsonData_Entitlement entitlementsContainer;
-                        {
-                            entitlementsContainer.EntitlementId = element.entitlementId;
-                            if (element.startTime.has_value()) {
-                                entitlementsContainer.StartTime = element.startTime.value();
-                            }
-                            if (element.endTime.has_value()) {
-                                entitlementsContainer.EndTime = element.endTime.value();
-                            }
-                        }
-                        entitlementsArray.Add() = entitlementsContainer;
-                    }
-                    idsContainer.Entitlements = entitlementsArray;
-                }
-            }
-            string idsStr;
-            idsContainer.ToString(idsStr);
-            WPEFramework::Core::JSON::VariantContainer idsVariantContainer(idsStr);
-            WPEFramework::Core::JSON::Variant idsVariant = idsVariantContainer;
-            jsonParameters.Set(_T("ids"), idsVariant);
+        FireboltSDK::Arena arena;
+        FireboltSDK::JsonWriter jsonParameters;
+        jsonParameters.Add(_T("ids"), ids);
         WPEFramework::Core::JSON::VariantContainer jsonResult;
-        status = FireboltSDK::Gateway::Instance().Request("discovery.contentAccess", jsonParameters, jsonResult);
+        status = FireboltSDK::Gateway::Instance().Request("discovery.contentAccess", jsonParameters.Finish(), jsonResult);
         if (status == Firebolt::Error::None) {
             FIREBOLT_LOG_INFO(FireboltSDK::Logger::Category::OpenRPC, FireboltSDK::Logger::Module<FireboltSDK::Accessor>(), "Discovery.contentAccess is successfully invoked");
 
@@ -143,30 +96,11 @@ namespace Discovery {
         Firebolt::Error status = Firebolt::Error::NotConnected;
         bool success = false;
 
-        JsonObject jsonParameters;
-        WPEFramework::Core::JSON::ArrayType<WPEFramework::Core::JSON::Variant> entitlementsArray;
-            for (auto& element : entitlements) {
-                Firebolt::Entertainment::JsonData_Entitlement entitlementsContainer;
-                {
-                        entitlementsContainer.EntitlementId = element.entitlementId;
-                        if (element.startTime.has_value()) {
-                            entitlementsContainer.StartTime = element.startTime.value();
-                        }
-                        if (element.endTime.has_value()) {
-                            entitlementsContainer.EndTime = element.endTime.value();
-                        }
-                }
-                string entitlementsStr;
-                entitlementsContainer.ToString(entitlementsStr);
-                WPEFramework::Core::JSON::VariantContainer entitlementsVariantContainer(entitlementsStr);
-                WPEFramework::Core::JSON::Variant entitlementsVariant = entitlementsVariantContainer;
-                entitlementsArray.Add() = entitlementsVariant;
-            }
-            WPEFramework::Core::JSON::Variant entitlementsVariant;
-            entitlementsVariant.Array(entitlementsArray);
-            jsonParameters.Set(_T("entitlements"), entitlementsVariant);
+        FireboltSDK::Arena arena;
+        FireboltSDK::JsonWriter jsonParameters;
+        jsonParameters.Add(_T("entitlements"), entitlements);
         WPEFramework::Core::JSON::Boolean jsonResult;
-        status = FireboltSDK::Gateway::Instance().Request("discovery.entitlements", jsonParameters, jsonResult);
+        status = FireboltSDK::Gateway::Instance().Request("discovery.entitlements", jsonParameters.Finish(), jsonResult);
         if (status == Firebolt::Error::None) {
             FIREBOLT_LOG_INFO(FireboltSDK::Logger::Category::OpenRPC, FireboltSDK::Logger::Module<FireboltSDK::Accessor>(), "Discovery.entitlements is successfully invoked");
             success = jsonResult.Value();
@@ -189,346 +123,12 @@ The app only needs to implement Pull support for `entityInfo` at this time. */
         Firebolt::Error status = Firebolt::Error::NotConnected;
         bool success = false;
         string correlationId = "";
-        JsonObject jsonParameters;
-        WPEFramework::Core::JSON::Variant correlationIdVariant(correlationId);
-            jsonParameters.Set(_T("correlationId"), correlationIdVariant);
-            auto element = result;
-            JsonData_EntityInfoResult resultContainer;
-            {
-                resultContainer.Expires = element.expires;
-                {
-                    {
-                        if (element.entity.identifiers.assetId.has_value()) {
-                            resultContainer.Entity.Identifiers.AssetId = element.entity.identifiers.assetId.value();
-                        }
-                        if (element.entity.identifiers.entityId.has_value()) {
-                            resultContainer.Entity.Identifiers.EntityId = element.entity.identifiers.entityId.value();
-                        }
-                        if (element.entity.identifiers.seasonId.has_value()) {
-                            resultContainer.Entity.Identifiers.SeasonId = element.entity.identifiers.seasonId.value();
-                        }
-                        if (element.entity.identifiers.seriesId.has_value()) {
-                            resultContainer.Entity.Identifiers.SeriesId = element.entity.identifiers.seriesId.value();
-                        }
-                        if (element.entity.identifiers.appContentData.has_value()) {
-                            resultContainer.Entity.Identifiers.AppContentData = element.entity.identifiers.appContentData.value();
-                        }
-                    }
-                    resultContainer.Entity.Title = element.entity.title;
-                    resultContainer.Entity.EntityType = element.entity.entityType;
-                    if (element.entity.programType.has_value()) {
-                        resultContainer.Entity.ProgramType = element.entity.programType.value();
-                    }
-                    if (element.entity.musicType.has_value()) {
-                        resultContainer.Entity.MusicType = element.entity.musicType.value();
-                    }
-                    if (element.entity.synopsis.has_value()) {
-                        resultContainer.Entity.Synopsis = element.entity.synopsis.value();
-                    }
-                    if (element.entity.seasonNumber.has_value()) {
-                        resultContainer.Entity.SeasonNumber = element.entity.seasonNumber.value();
-                    }
-                    if (element.entity.seasonCount.has_value()) {
-                        resultContainer.Entity.SeasonCount = element.entity.seasonCount.value();
-                    }
-                    if (element.entity.episodeNumber.has_value()) {
-                        resultContainer.Entity.EpisodeNumber = element.entity.episodeNumber.value();
-                    }
-                    if (element.entity.episodeCount.has_value()) {
-                        resultContainer.Entity.EpisodeCount = element.entity.episodeCount.value();
-                    }
-                    if (element.entity.releaseDate.has_value()) {
-                        resultContainer.Entity.ReleaseDate = element.entity.releaseDate.value();
-                    }
-                    if (element.entity.contentRatings.has_value()) {
-                        WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_ContentRating> contentRatingsArray;
-                        std::vector<Entertainment::ContentRating> contentRatings = element.entity.contentRatings.value();
-                        for (auto& element : contentRatings) {
-                            Firebolt::Entertainment::JsonData_ContentRating contentRatingsContainer;
-                            {
-                                contentRatingsContainer.Scheme = element.scheme;
-                                contentRatingsContainer.Rating = element.rating;
-                                if (element.advisories.has_value()) {
-                                    WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> advisoriesArray;
-                                    std::vector<std::string> advisories = element.advisories.value();
-                                    for (auto& element : advisories) {
-                                        advisoriesArray.Add() = element;
-                                    }
-                                    contentRatingsContainer.Advisories = advisoriesArray;
-                                }
-                            }
-                            contentRatingsArray.Add() = contentRatingsContainer;
-                        }
-                        resultContainer.Entity.ContentRatings = contentRatingsArray;
-                    }
-                    if (element.entity.waysToWatch.has_value()) {
-                        WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_WayToWatch> waysToWatchArray;
-                        std::vector<Entertainment::WayToWatch> waysToWatch = element.entity.waysToWatch.value();
-                        for (auto& element : waysToWatch) {
-                            Firebolt::Entertainment::JsonData_WayToWatch waysToWatchContainer;
-                            {
-                                {
-                                    if (element.identifiers.assetId.has_value()) {
-                                        waysToWatchContainer.Identifiers.AssetId = element.identifiers.assetId.value();
-                                    }
-                                    if (element.identifiers.entityId.has_value()) {
-                                        waysToWatchContainer.Identifiers.EntityId = element.identifiers.entityId.value();
-                                    }
-                                    if (element.identifiers.seasonId.has_value()) {
-                                        waysToWatchContainer.Identifiers.SeasonId = element.identifiers.seasonId.value();
-                                    }
-                                    if (element.identifiers.seriesId.has_value()) {
-                                        waysToWatchContainer.Identifiers.SeriesId = element.identifiers.seriesId.value();
-                                    }
-                                    if (element.identifiers.appContentData.has_value()) {
-                                        waysToWatchContainer.Identifiers.AppContentData = element.identifiers.appContentData.value();
-                                    }
-                                }
-                                if (element.expires.has_value()) {
-                                    waysToWatchContainer.Expires = element.expires.value();
-                                }
-                                if (element.entitled.has_value()) {
-                                    waysToWatchContainer.Entitled = element.entitled.value();
-                                }
-                                if (element.entitledExpires.has_value()) {
-                                    waysToWatchContainer.EntitledExpires = element.entitledExpires.value();
-                                }
-                                if (element.offeringType.has_value()) {
-                                    waysToWatchContainer.OfferingType = element.offeringType.value();
-                                }
-                                if (element.hasAds.has_value()) {
-                                    waysToWatchContainer.HasAds = element.hasAds.value();
-                                }
-                                if (element.price.has_value()) {
-                                    waysToWatchContainer.Price = element.price.value();
-                                }
-                                if (element.videoQuality.has_value()) {
-                                    WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_WayToWatchVideoQuality> videoQualityArray;
-                                    std::vector<Entertainment::WayToWatchVideoQuality> videoQuality = element.videoQuality.value();
-                                    for (auto& element : videoQuality) {
-                                        videoQualityArray.Add() = element;
-                                    }
-                                    waysToWatchContainer.VideoQuality = videoQualityArray;
-                                }
-                                WPEFramework::Core::JSON::ArrayType<Firebolt::Types::JsonData_AudioProfile> audioProfileArray;
-                                std::vector<Types::AudioProfile> audioProfile = element.audioProfile;
-                                for (auto& element : audioProfile) {
-                                    audioProfileArray.Add() = element;
-                                }
-                                waysToWatchContainer.AudioProfile = audioProfileArray;
-                                if (element.audioLanguages.has_value()) {
-                                    WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> audioLanguagesArray;
-                                    std::vector<std::string> audioLanguages = element.audioLanguages.value();
-                                    for (auto& element : audioLanguages) {
-                                        audioLanguagesArray.Add() = element;
-                                    }
-                                    waysToWatchContainer.AudioLanguages = audioLanguagesArray;
-                                }
-                                if (element.closedCaptions.has_value()) {
-                                    WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> closedCaptionsArray;
-                                    std::vector<std::string> closedCaptions = element.closedCaptions.value();
-                                    for (auto& element : closedCaptions) {
-                                        closedCaptionsArray.Add() = element;
-                                    }
-                                    waysToWatchContainer.ClosedCaptions = closedCaptionsArray;
-                                }
-                                if (element.subtitles.has_value()) {
-                                    WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> subtitlesArray;
-                                    std::vector<std::string> subtitles = element.subtitles.value();
-                                    for (auto& element : subtitles) {
-                                        subtitlesArray.Add() = element;
-                                    }
-                                    waysToWatchContainer.Subtitles = subtitlesArray;
-                                }
-                                if (element.audioDescriptions.has_value()) {
-                                    WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> audioDescriptionsArray;
-                                    std::vector<std::string> audioDescriptions = element.audioDescriptions.value();
-                                    for (auto& element : audioDescriptions) {
-                                        audioDescriptionsArray.Add() = element;
-                                    }
-                                    waysToWatchContainer.AudioDescriptions = audioDescriptionsArray;
-                                }
-                            }
-                            waysToWatchArray.Add() = waysToWatchContainer;
-                        }
-                        resultContainer.Entity.WaysToWatch = waysToWatchArray;
-                    }
-                }
-                if (element.related.has_value()) {
-                    WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_EntityInfo> relatedArray;
-                    std::vector<Entertainment::EntityInfo> related = element.related.value();
-                    for (auto& element : related) {
-                        Firebolt::Entertainment::JsonData_EntityInfo relatedContainer;
-                        {
-                            {
-                                if (element.identifiers.assetId.has_value()) {
-                                    relatedContainer.Identifiers.AssetId = element.identifiers.assetId.value();
-                                }
-                                if (element.identifiers.entityId.has_value()) {
-                                    relatedContainer.Identifiers.EntityId = element.identifiers.entityId.value();
-                                }
-                                if (element.identifiers.seasonId.has_value()) {
-                                    relatedContainer.Identifiers.SeasonId = element.identifiers.seasonId.value();
-                                }
-                                if (element.identifiers.seriesId.has_value()) {
-                                    relatedContainer.Identifiers.SeriesId = element.identifiers.seriesId.value();
-                                }
-                                if (element.identifiers.appContentData.has_value()) {
-                                    relatedContainer.Identifiers.AppContentData = element.identifiers.appContentData.value();
-                                }
-                            }
-                            relatedContainer.Title = element.title;
-                            relatedContainer.EntityType = element.entityType;
-                            if (element.programType.has_value()) {
-                                relatedContainer.ProgramType = element.programType.value();
-                            }
-                            if (element.musicType.has_value()) {
-                                relatedContainer.MusicType = element.musicType.value();
-                            }
-                            if (element.synopsis.has_value()) {
-                                relatedContainer.Synopsis = element.synopsis.value();
-                            }
-                            if (element.seasonNumber.has_value()) {
-                                relatedContainer.SeasonNumber = element.seasonNumber.value();
-                            }
-                            if (element.seasonCount.has_value()) {
-                                relatedContainer.SeasonCount = element.seasonCount.value();
-                            }
-                            if (element.episodeNumber.has_value()) {
-                                relatedContainer.EpisodeNumber = element.episodeNumber.value();
-                            }
-                            if (element.episodeCount.has_value()) {
-                                relatedContainer.EpisodeCount = element.episodeCount.value();
-                            }
-                            if (element.releaseDate.has_value()) {
-                                relatedContainer.ReleaseDate = element.releaseDate.value();
-                            }
-                            if (element.contentRatings.has_value()) {
-                                WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_ContentRating> contentRatingsArray;
-                                std::vector<Entertainment::ContentRating> contentRatings = element.contentRatings.value();
-                                for (auto& element : contentRatings) {
-                                    Firebolt::Entertainment::JsonData_ContentRating contentRatingsContainer;
-                                    {
-                                        contentRatingsContainer.Scheme = element.scheme;
-                                        contentRatingsContainer.Rating = element.rating;
-                                        if (element.advisories.has_value()) {
-                                            WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> advisoriesArray;
-                                            std::vector<std::string> advisories = element.advisories.value();
-                                            for (auto& element : advisories) {
-                                                advisoriesArray.Add() = element;
-                                            }
-                                            contentRatingsContainer.Advisories = advisoriesArray;
-                                        }
-                                    }
-                                    contentRatingsArray.Add() = contentRatingsContainer;
-                                }
-                                relatedContainer.ContentRatings = contentRatingsArray;
-                            }
-                            if (element.waysToWatch.has_value()) {
-                                WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_WayToWatch> waysToWatchArray;
-                                std::vector<Entertainment::WayToWatch> waysToWatch = element.waysToWatch.value();
-                                for (auto& element : waysToWatch) {
-                                    Firebolt::Entertainment::JsonData_WayToWatch waysToWatchContainer;
-                                    {
-                                        {
-                                            if (element.identifiers.assetId.has_value()) {
-                                                waysToWatchContainer.Identifiers.AssetId = element.identifiers.assetId.value();
-                                            }
-                                            if (element.identifiers.entityId.has_value()) {
-                                                waysToWatchContainer.Identifiers.EntityId = element.identifiers.entityId.value();
-                                            }
-                                            if (element.identifiers.seasonId.has_value()) {
-                                                waysToWatchContainer.Identifiers.SeasonId = element.identifiers.seasonId.value();
-                                            }
-                                            if (element.identifiers.seriesId.has_value()) {
-                                                waysToWatchContainer.Identifiers.SeriesId = element.identifiers.seriesId.value();
-                                            }
-                                            if (element.identifiers.appContentData.has_value()) {
-                                                waysToWatchContainer.Identifiers.AppContentData = element.identifiers.appContentData.value();
-                                            }
-                                        }
-                                        if (element.expires.has_value()) {
-                                            waysToWatchContainer.Expires = element.expires.value();
-                                        }
-                                        if (element.entitled.has_value()) {
-                                            waysToWatchContainer.Entitled = element.entitled.value();
-                                        }
-                                        if (element.entitledExpires.has_value()) {
-                                            waysToWatchContainer.EntitledExpires = element.entitledExpires.value();
-                                        }
-                                        if (element.offeringType.has_value()) {
-                                            waysToWatchContainer.OfferingType = element.offeringType.value();
-                                        }
-                                        if (element.hasAds.has_value()) {
-                                            waysToWatchContainer.HasAds = element.hasAds.value();
-                                        }
-                                        if (element.price.has_value()) {
-                                            waysToWatchContainer.Price = element.price.value();
-                                        }
-                                        if (element.videoQuality.has_value()) {
-                                            WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_WayToWatchVideoQuality> videoQualityArray;
-                                            std::vector<Entertainment::WayToWatchVideoQuality> videoQuality = element.videoQuality.value();
-                                            for (auto& element : videoQuality) {
-                                                videoQualityArray.Add() = element;
-                                            }
-                                            waysToWatchContainer.VideoQuality = videoQualityArray;
-                                        }
-                                        WPEFramework::Core::JSON::ArrayType<Firebolt::Types::JsonData_AudioProfile> audioProfileArray;
-                                        std::vector<Types::AudioProfile> audioProfile = element.audioProfile;
-                                        for (auto& element : audioProfile) {
-                                            audioProfileArray.Add() = element;
-                                        }
-                                        waysToWatchContainer.AudioProfile = audioProfileArray;
-                                        if (element.audioLanguages.has_value()) {
-                                            WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> audioLanguagesArray;
-                                            std::vector<std::string> audioLanguages = element.audioLanguages.value();
-                                            for (auto& element : audioLanguages) {
-                                                audioLanguagesArray.Add() = element;
-                                            }
-                                            waysToWatchContainer.AudioLanguages = audioLanguagesArray;
-                                        }
-                                        if (element.closedCaptions.has_value()) {
-                                            WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> closedCaptionsArray;
-                                            std::vector<std::string> closedCaptions = element.closedCaptions.value();
-                                            for (auto& element : closedCaptions) {
-                                                closedCaptionsArray.Add() = element;
-                                            }
-                                            waysToWatchContainer.ClosedCaptions = closedCaptionsArray;
-                                        }
-                                        if (element.subtitles.has_value()) {
-                                            WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> subtitlesArray;
-                                            std::vector<std::string> subtitles = element.subtitles.value();
-                                            for (auto& element : subtitles) {
-                                                subtitlesArray.Add() = element;
-                                            }
-                                            waysToWatchContainer.Subtitles = subtitlesArray;
-                                        }
-                                        if (element.audioDescriptions.has_value()) {
-                                            WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> audioDescriptionsArray;
-                                            std::vector<std::string> audioDescriptions = element.audioDescriptions.value();
-                                            for (auto& element : audioDescriptions) {
-                                                audioDescriptionsArray.Add() = element;
-                                            }
-                                            waysToWatchContainer.AudioDescriptions = audioDescriptionsArray;
-                                        }
-                                    }
-                                    waysToWatchArray.Add() = waysToWatchContainer;
-                                }
-                                relatedContainer.WaysToWatch = waysToWatchArray;
-                            }
-                        }
-                        relatedArray.Add() = relatedContainer;
-                    }
-                    resultContainer.Related = relatedArray;
-                }
-            }
-            string resultStr;
-            resultContainer.ToString(resultStr);
-            WPEFramework::Core::JSON::VariantContainer resultVariantContainer(resultStr);
-            WPEFramework::Core::JSON::Variant resultVariant = resultVariantContainer;
-            jsonParameters.Set(_T("result"), resultVariant);
+        FireboltSDK::Arena arena;
+        FireboltSDK::JsonWriter jsonParameters;
+            jsonParameters.Add(_T("correlationId"), correlationId);
+            jsonParameters.Add(_T("result"), result);
         WPEFramework::Core::JSON::Boolean jsonResult;
-        status = FireboltSDK::Gateway::Instance().Request("discovery.entityInfo", jsonParameters, jsonResult);
+        status = FireboltSDK::Gateway::Instance().Request("discovery.entityInfo", jsonParameters.Finish(), jsonResult);
         if (status == Firebolt::Error::None) {
             FIREBOLT_LOG_INFO(FireboltSDK::Logger::Category::OpenRPC, FireboltSDK::Logger::Module<FireboltSDK::Accessor>(), "Discovery.entityInfo is successfully invoked");
             success = jsonResult.Value();
@@ -589,7 +189,7 @@ The app only needs to implement Pull support for `entityInfo` at this time. */
             policyResult.enableRecommendations = jsonResult.EnableRecommendations.Value();
             policyResult.shareWatchHistory = jsonResult.ShareWatchHistory.Value();
             policyResult.rememberWatchedPrograms = jsonResult.RememberWatchedPrograms.Value();
-            policy = policyResult;
+            policy = std::move(policyResult);
         }
         if (err != nullptr) {
             *err = status;
@@ -641,187 +241,12 @@ The app should actively push `purchasedContent` when:
         Firebolt::Error status = Firebolt::Error::NotConnected;
         bool success = false;
         string correlationId = "";
-        JsonObject jsonParameters;
-        WPEFramework::Core::JSON::Variant correlationIdVariant(correlationId);
-            jsonParameters.Set(_T("correlationId"), correlationIdVariant);
-            auto element = result;
-            JsonData_PurchasedContentResult resultContainer;
-            {
-                resultContainer.Expires = element.expires;
-                resultContainer.TotalCount = element.totalCount;
-                WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_EntityInfo> entriesArray;
-                std::vector<Entertainment::EntityInfo> entries = element.entries;
-                for (auto& element : entries) {
-                    Firebolt::Entertainment::JsonData_EntityInfo entriesContainer;
-                    {
-                        {
-                            if (element.identifiers.assetId.has_value()) {
-                                entriesContainer.Identifiers.AssetId = element.identifiers.assetId.value();
-                            }
-                            if (element.identifiers.entityId.has_value()) {
-                                entriesContainer.Identifiers.EntityId = element.identifiers.entityId.value();
-                            }
-                            if (element.identifiers.seasonId.has_value()) {
-                                entriesContainer.Identifiers.SeasonId = element.identifiers.seasonId.value();
-                            }
-                            if (element.identifiers.seriesId.has_value()) {
-                                entriesContainer.Identifiers.SeriesId = element.identifiers.seriesId.value();
-                            }
-                            if (element.identifiers.appContentData.has_value()) {
-                                entriesContainer.Identifiers.AppContentData = element.identifiers.appContentData.value();
-                            }
-                        }
-                        entriesContainer.Title = element.title;
-                        entriesContainer.EntityType = element.entityType;
-                        if (element.programType.has_value()) {
-                            entriesContainer.ProgramType = element.programType.value();
-                        }
-                        if (element.musicType.has_value()) {
-                            entriesContainer.MusicType = element.musicType.value();
-                        }
-                        if (element.synopsis.has_value()) {
-                            entriesContainer.Synopsis = element.synopsis.value();
-                        }
-                        if (element.seasonNumber.has_value()) {
-                            entriesContainer.SeasonNumber = element.seasonNumber.value();
-                        }
-                        if (element.seasonCount.has_value()) {
-                            entriesContainer.SeasonCount = element.seasonCount.value();
-                        }
-                        if (element.episodeNumber.has_value()) {
-                            entriesContainer.EpisodeNumber = element.episodeNumber.value();
-                        }
-                        if (element.episodeCount.has_value()) {
-                            entriesContainer.EpisodeCount = element.episodeCount.value();
-                        }
-                        if (element.releaseDate.has_value()) {
-                            entriesContainer.ReleaseDate = element.releaseDate.value();
-                        }
-                        if (element.contentRatings.has_value()) {
-                            WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_ContentRating> contentRatingsArray;
-                            std::vector<Entertainment::ContentRating> contentRatings = element.contentRatings.value();
-                            for (auto& element : contentRatings) {
-                                Firebolt::Entertainment::JsonData_ContentRating contentRatingsContainer;
-                                {
-                                    contentRatingsContainer.Scheme = element.scheme;
-                                    contentRatingsContainer.Rating = element.rating;
-                                    if (element.advisories.has_value()) {
-                                        WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> advisoriesArray;
-                                        std::vector<std::string> advisories = element.advisories.value();
-                                        for (auto& element : advisories) {
-                                            advisoriesArray.Add() = element;
-                                        }
-                                        contentRatingsContainer.Advisories = advisoriesArray;
-                                    }
-                                }
-                                contentRatingsArray.Add() = contentRatingsContainer;
-                            }
-                            entriesContainer.ContentRatings = contentRatingsArray;
-                        }
-                        if (element.waysToWatch.has_value()) {
-                            WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_WayToWatch> waysToWatchArray;
-                            std::vector<Entertainment::WayToWatch> waysToWatch = element.waysToWatch.value();
-                            for (auto& element : waysToWatch) {
-                                Firebolt::Entertainment::JsonData_WayToWatch waysToWatchContainer;
-                                {
-                                    {
-                                        if (element.identifiers.assetId.has_value()) {
-                                            waysToWatchContainer.Identifiers.AssetId = element.identifiers.assetId.value();
-                                        }
-                                        if (element.identifiers.entityId.has_value()) {
-                                            waysToWatchContainer.Identifiers.EntityId = element.identifiers.entityId.value();
-                                        }
-                                        if (element.identifiers.seasonId.has_value()) {
-                                            waysToWatchContainer.Identifiers.SeasonId = element.identifiers.seasonId.value();
-                                        }
-                                        if (element.identifiers.seriesId.has_value()) {
-                                            waysToWatchContainer.Identifiers.SeriesId = element.identifiers.seriesId.value();
-                                        }
-                                        if (element.identifiers.appContentData.has_value()) {
-                                            waysToWatchContainer.Identifiers.AppContentData = element.identifiers.appContentData.value();
-                                        }
-                                    }
-                                    if (element.expires.has_value()) {
-                                        waysToWatchContainer.Expires = element.expires.value();
-                                    }
-                                    if (element.entitled.has_value()) {
-                                        waysToWatchContainer.Entitled = element.entitled.value();
-                                    }
-                                    if (element.entitledExpires.has_value()) {
-                                        waysToWatchContainer.EntitledExpires = element.entitledExpires.value();
-                                    }
-                                    if (element.offeringType.has_value()) {
-                                        waysToWatchContainer.OfferingType = element.offeringType.value();
-                                    }
-                                    if (element.hasAds.has_value()) {
-                                        waysToWatchContainer.HasAds = element.hasAds.value();
-                                    }
-                                    if (element.price.has_value()) {
-                                        waysToWatchContainer.Price = element.price.value();
-                                    }
-                                    if (element.videoQuality.has_value()) {
-                                        WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_WayToWatchVideoQuality> videoQualityArray;
-                                        std::vector<Entertainment::WayToWatchVideoQuality> videoQuality = element.videoQuality.value();
-                                        for (auto& element : videoQuality) {
-                                            videoQualityArray.Add() = element;
-                                        }
-                                        waysToWatchContainer.VideoQuality = videoQualityArray;
-                                    }
-                                    WPEFramework::Core::JSON::ArrayType<Firebolt::Types::JsonData_AudioProfile> audioProfileArray;
-                                    std::vector<Types::AudioProfile> audioProfile = element.audioProfile;
-                                    for (auto& element : audioProfile) {
-                                        audioProfileArray.Add() = element;
-                                    }
-                                    waysToWatchContainer.AudioProfile = audioProfileArray;
-                                    if (element.audioLanguages.has_value()) {
-                                        WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> audioLanguagesArray;
-                                        std::vector<std::string> audioLanguages = element.audioLanguages.value();
-                                        for (auto& element : audioLanguages) {
-                                            audioLanguagesArray.Add() = element;
-                                        }
-                                        waysToWatchContainer.AudioLanguages = audioLanguagesArray;
-                                    }
-                                    if (element.closedCaptions.has_value()) {
-                                        WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> closedCaptionsArray;
-                                        std::vector<std::string> closedCaptions = element.closedCaptions.value();
-                                        for (auto& element : closedCaptions) {
-                                            closedCaptionsArray.Add() = element;
-                                        }
-                                        waysToWatchContainer.ClosedCaptions = closedCaptionsArray;
-                                    }
-                                    if (element.subtitles.has_value()) {
-                                        WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> subtitlesArray;
-                                        std::vector<std::string> subtitles = element.subtitles.value();
-                                        for (auto& element : subtitles) {
-                                            subtitlesArray.Add() = element;
-                                        }
-                                        waysToWatchContainer.Subtitles = subtitlesArray;
-                                    }
-                                    if (element.audioDescriptions.has_value()) {
-                                        WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> audioDescriptionsArray;
-                                        std::vector<std::string> audioDescriptions = element.audioDescriptions.value();
-                                        for (auto& element : audioDescriptions) {
-                                            audioDescriptionsArray.Add() = element;
-                                        }
-                                        waysToWatchContainer.AudioDescriptions = audioDescriptionsArray;
-                                    }
-                                }
-                                waysToWatchArray.Add() = waysToWatchContainer;
-                            }
-                            entriesContainer.WaysToWatch = waysToWatchArray;
-                        }
-                    }
-                    entriesArray.Add() = entriesContainer;
-                }
-                resultContainer.Entries = entriesArray;
-            }
-            string resultStr;
-            resultContainer.ToString(resultStr);
-            WPEFramework::Core::JSON::VariantContainer resultVariantContainer(resultStr);
-            WPEFramework::Core::JSON::Variant resultVariant = resultVariantContainer;
-            jsonParameters.Set(_T("result"), resultVariant);
+        FireboltSDK::Arena arena;
+        FireboltSDK::JsonWriter jsonParameters;
+            jsonParameters.Add(_T("correlationId"), correlationId);
+            jsonParameters.Add(_T("result"), result);
         WPEFramework::Core::JSON::Boolean jsonResult;
-        status = FireboltSDK::Gateway::Instance().Request("discovery.purchasedContent", jsonParameters, jsonResult);
+        status = FireboltSDK::Gateway::Instance().Request("discovery.purchasedContent", jsonParameters.Finish(), jsonResult);
         if (status == Firebolt::Error::None) {
             FIREBOLT_LOG_INFO(FireboltSDK::Logger::Category::OpenRPC, FireboltSDK::Logger::Module<FireboltSDK::Accessor>(), "Discovery.purchasedContent is successfully invoked");
             success = jsonResult.Value();
@@ -846,32 +271,15 @@ The app should actively push `purchasedContent` when:
         Firebolt::Error status = Firebolt::Error::NotConnected;
         bool success = false;
 
-        JsonObject jsonParameters;
-        WPEFramework::Core::JSON::ArrayType<WPEFramework::Core::JSON::Variant> entitlementsArray;
-            if (entitlements.has_value()) {
-                for (auto& element : entitlements.value()) {
-                    Firebolt::Entertainment::JsonData_Entitlement entitlementsContainer;
-                    {
-                            entitlementsContainer.EntitlementId = element.entitlementId;
-                            if (element.startTime.has_value()) {
-                                entitlementsContainer.StartTime = element.startTime.value();
-                            }
-                            if (element.endTime.has_value()) {
-                                entitlementsContainer.EndTime = element.endTime.value();
-                            }
-                    }
-                    string entitlementsStr;
-                    entitlementsContainer.ToString(entitlementsStr);
-                    WPEFramework::Core::JSON::VariantContainer entitlementsVariantContainer(entitlementsStr);
-                    WPEFramework::Core::JSON::Variant entitlementsVariant = entitlementsVariantContainer;
-                    entitlementsArray.Add() = entitlementsVariant;
-                }
-            }
-            WPEFramework::Core::JSON::Variant entitlementsVariant;
-            entitlementsVariant.Array(entitlementsArray);
-            jsonParameters.Set(_T("entitlements"), entitlementsVariant);
+        FireboltSDK::Arena arena;
+        FireboltSDK::JsonWriter jsonParameters;
+        if (entitlements.has_value()) {
+            jsonParameters.Add(_T("entitlements"), entitlements.value());
+        } else {
+            jsonParameters.BeginArray(_T("entitlements")).EndArray();
+        }
         WPEFramework::Core::JSON::Boolean jsonResult;
-        status = FireboltSDK::Gateway::Instance().Request("discovery.signIn", jsonParameters, jsonResult);
+        status = FireboltSDK::Gateway::Instance().Request("discovery.signIn", jsonParameters.Finish(), jsonResult);
         if (status == Firebolt::Error::None) {
             FIREBOLT_LOG_INFO(FireboltSDK::Logger::Category::OpenRPC, FireboltSDK::Logger::Module<FireboltSDK::Accessor>(), "Discovery.signIn is successfully invoked");
             success = jsonResult.Value();
@@ -921,46 +329,23 @@ The app should actively push `purchasedContent` when:
         Firebolt::Error status = Firebolt::Error::NotConnected;
         bool success = false;
 
-        JsonObject jsonParameters;
-        WPEFramework::Core::JSON::Variant titleVariant(title);
-            jsonParameters.Set(_T("title"), titleVariant);
-            auto element = identifiers;
-            Firebolt::Entertainment::JsonData_ContentIdentifiers identifiersContainer;
-            {
-                if (element.assetId.has_value()) {
-                    identifiersContainer.AssetId = element.assetId.value();
-                }
-                if (element.entityId.has_value()) {
-                    identifiersContainer.EntityId = element.entityId.value();
-                }
-                if (element.seasonId.has_value()) {
-                    identifiersContainer.SeasonId = element.seasonId.value();
-                }
-                if (element.seriesId.has_value()) {
-                    identifiersContainer.SeriesId = element.seriesId.value();
-                }
-                if (element.appContentData.has_value()) {
-                    identifiersContainer.AppContentData = element.appContentData.value();
-                }
-            }
-            string identifiersStr;
-            identifiersContainer.ToString(identifiersStr);
-            WPEFramework::Core::JSON::VariantContainer identifiersVariantContainer(identifiersStr);
-            WPEFramework::Core::JSON::Variant identifiersVariant = identifiersVariantContainer;
-            jsonParameters.Set(_T("identifiers"), identifiersVariant);
-            if (expires.has_value()) {
-                WPEFramework::Core::JSON::Variant expiresVariant(expires.value());
-                jsonParameters.Set(_T("expires"), expiresVariant);
-            }
+        FireboltSDK::Arena arena;
+        FireboltSDK::JsonWriter jsonParameters;
+            jsonParameters.Add(_T("title"), title);
+            jsonParameters.BeginObject(_T("identifiers"));
+                jsonParameters.Add(_T("assetId"), identifiers.assetId);
+                jsonParameters.Add(_T("entityId"), identifiers.entityId);
+                jsonParameters.Add(_T("seasonId"), identifiers.seasonId);
+                jsonParameters.Add(_T("seriesId"), identifiers.seriesId);
+                jsonParameters.Add(_T("appContentData"), identifiers.appContentData);
+            jsonParameters.EndObject();
+            jsonParameters.Add(_T("expires"), expires);
             if (images.has_value()) {
-                WPEFramework::Core::JSON::VariantContainer imagesContainer;
-                imagesContainer.FromString(images.value());
-                WPEFramework::Core::JSON::Variant imagesVariant(imagesContainer);
-                jsonParameters.Set(_T("images"), imagesVariant);
+                jsonParameters.AddJson(_T("images"), images.value());
             }
     
         WPEFramework::Core::JSON::Boolean jsonResult;
-        status = FireboltSDK::Gateway::Instance().Request("discovery.watchNext", jsonParameters, jsonResult);
+        status = FireboltSDK::Gateway::Instance().Request("discovery.watchNext", jsonParameters.Finish(), jsonResult);
         if (status == Firebolt::Error::None) {
             FIREBOLT_LOG_INFO(FireboltSDK::Logger::Category::OpenRPC, FireboltSDK::Logger::Module<FireboltSDK::Accessor>(), "Discovery.watchNext is successfully invoked");
             success = jsonResult.Value();
@@ -1080,354 +465,19 @@ The app only needs to implement Pull support for `entityInfo` at this time. */
             if (jsonResult.AssetId.IsSet()) {
                 entityInfoParametersResult.assetId = jsonResult.AssetId.Value();
             }
-            entityInfoParameters = entityInfoParametersResult;
+            entityInfoParameters = std::move(entityInfoParametersResult);
 
             IDiscovery::IOnPullEntityInfoNotification& notifier = *(reinterpret_cast<IDiscovery::IOnPullEntityInfoNotification*>(notification));
             EntityInfoResult element = notifier.onPullEntityInfo(entityInfoParameters);
             Firebolt::Error status = Firebolt::Error::NotConnected;
-            JsonObject jsonParameters;
-            WPEFramework::Core::JSON::Variant CorrelationId = proxyResponse->CorrelationId.Value();
-            jsonParameters.Set(_T("correlationId"), CorrelationId);
-            JsonData_EntityInfoResult Container;
-            {
-                {
-                        Container.Expires = element.expires;
-                        {
-                            {
-                                if (element.entity.identifiers.assetId.has_value()) {
-                                    Container.Entity.Identifiers.AssetId = element.entity.identifiers.assetId.value();
-                                }
-                                if (element.entity.identifiers.entityId.has_value()) {
-                                    Container.Entity.Identifiers.EntityId = element.entity.identifiers.entityId.value();
-                                }
-                                if (element.entity.identifiers.seasonId.has_value()) {
-                                    Container.Entity.Identifiers.SeasonId = element.entity.identifiers.seasonId.value();
-                                }
-                                if (element.entity.identifiers.seriesId.has_value()) {
-                                    Container.Entity.Identifiers.SeriesId = element.entity.identifiers.seriesId.value();
-                                }
-                                if (element.entity.identifiers.appContentData.has_value()) {
-                                    Container.Entity.Identifiers.AppContentData = element.entity.identifiers.appContentData.value();
-                                }
-                            }
-                            Container.Entity.Title = element.entity.title;
-                            Container.Entity.EntityType = element.entity.entityType;
-                            if (element.entity.programType.has_value()) {
-                                Container.Entity.ProgramType = element.entity.programType.value();
-                            }
-                            if (element.entity.musicType.has_value()) {
-                                Container.Entity.MusicType = element.entity.musicType.value();
-                            }
-                            if (element.entity.synopsis.has_value()) {
-                                Container.Entity.Synopsis = element.entity.synopsis.value();
-                            }
-                            if (element.entity.seasonNumber.has_value()) {
-                                Container.Entity.SeasonNumber = element.entity.seasonNumber.value();
-                            }
-                            if (element.entity.seasonCount.has_value()) {
-                                Container.Entity.SeasonCount = element.entity.seasonCount.value();
-                            }
-                            if (element.entity.episodeNumber.has_value()) {
-                                Container.Entity.EpisodeNumber = element.entity.episodeNumber.value();
-                            }
-                            if (element.entity.episodeCount.has_value()) {
-                                Container.Entity.EpisodeCount = element.entity.episodeCount.value();
-                            }
-                            if (element.entity.releaseDate.has_value()) {
-                                Container.Entity.ReleaseDate = element.entity.releaseDate.value();
-                            }
-                            if (element.entity.contentRatings.has_value()) {
-                                WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_ContentRating> contentRatingsArray;
-                                std::vector<Entertainment::ContentRating> contentRatings = element.entity.contentRatings.value();
-                                for (auto& element : contentRatings) {
-                                    Firebolt::Entertainment::JsonData_ContentRating contentRatingsContainer;
-                                    {
-                                        contentRatingsContainer.Scheme = element.scheme;
-                                        contentRatingsContainer.Rating = element.rating;
-                                        if (element.advisories.has_value()) {
-                                            WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> advisoriesArray;
-                                            std::vector<std::string> advisories = element.advisories.value();
-                                            for (auto& element : advisories) {
-                                                advisoriesArray.Add() = element;
-                                            }
-                                            contentRatingsContainer.Advisories = advisoriesArray;
-                                        }
-                                    }
-                                    contentRatingsArray.Add() = contentRatingsContainer;
-                                }
-                                Container.Entity.ContentRatings = contentRatingsArray;
-                            }
-                            if (element.entity.waysToWatch.has_value()) {
-                                WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_WayToWatch> waysToWatchArray;
-                                std::vector<Entertainment::WayToWatch> waysToWatch = element.entity.waysToWatch.value();
-                                for (auto& element : waysToWatch) {
-                                    Firebolt::Entertainment::JsonData_WayToWatch waysToWatchContainer;
-                                    {
-                                        {
-                                            if (element.identifiers.assetId.has_value()) {
-                                                waysToWatchContainer.Identifiers.AssetId = element.identifiers.assetId.value();
-                                            }
-                                            if (element.identifiers.entityId.has_value()) {
-                                                waysToWatchContainer.Identifiers.EntityId = element.identifiers.entityId.value();
-                                            }
-                                            if (element.identifiers.seasonId.has_value()) {
-                                                waysToWatchContainer.Identifiers.SeasonId = element.identifiers.seasonId.value();
-                                            }
-                                            if (element.identifiers.seriesId.has_value()) {
-                                                waysToWatchContainer.Identifiers.SeriesId = element.identifiers.seriesId.value();
-                                            }
-                                            if (element.identifiers.appContentData.has_value()) {
-                                                waysToWatchContainer.Identifiers.AppContentData = element.identifiers.appContentData.value();
-                                            }
-                                        }
-                                        if (element.expires.has_value()) {
-                                            waysToWatchContainer.Expires = element.expires.value();
-                                        }
-                                        if (element.entitled.has_value()) {
-                                            waysToWatchContainer.Entitled = element.entitled.value();
-                                        }
-                                        if (element.entitledExpires.has_value()) {
-                                            waysToWatchContainer.EntitledExpires = element.entitledExpires.value();
-                                        }
-                                        if (element.offeringType.has_value()) {
-                                            waysToWatchContainer.OfferingType = element.offeringType.value();
-                                        }
-                                        if (element.hasAds.has_value()) {
-                                            waysToWatchContainer.HasAds = element.hasAds.value();
-                                        }
-                                        if (element.price.has_value()) {
-                                            waysToWatchContainer.Price = element.price.value();
-                                        }
-                                        if (element.videoQuality.has_value()) {
-                                            WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_WayToWatchVideoQuality> videoQualityArray;
-                                            std::vector<Entertainment::WayToWatchVideoQuality> videoQuality = element.videoQuality.value();
-                                            for (auto& element : videoQuality) {
-                                                videoQualityArray.Add() = element;
-                                            }
-                                            waysToWatchContainer.VideoQuality = videoQualityArray;
-                                        }
-                                        WPEFramework::Core::JSON::ArrayType<Firebolt::Types::JsonData_AudioProfile> audioProfileArray;
-                                        std::vector<Types::AudioProfile> audioProfile = element.audioProfile;
-                                        for (auto& element : audioProfile) {
-                                            audioProfileArray.Add() = element;
-                                        }
-                                        waysToWatchContainer.AudioProfile = audioProfileArray;
-                                        if (element.audioLanguages.has_value()) {
-                                            WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> audioLanguagesArray;
-                                            std::vector<std::string> audioLanguages = element.audioLanguages.value();
-                                            for (auto& element : audioLanguages) {
-                                                audioLanguagesArray.Add() = element;
-                                            }
-                                            waysToWatchContainer.AudioLanguages = audioLanguagesArray;
-                                        }
-                                        if (element.closedCaptions.has_value()) {
-                                            WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> closedCaptionsArray;
-                                            std::vector<std::string> closedCaptions = element.closedCaptions.value();
-                                            for (auto& element : closedCaptions) {
-                                                closedCaptionsArray.Add() = element;
-                                            }
-                                            waysToWatchContainer.ClosedCaptions = closedCaptionsArray;
-                                        }
-                                        if (element.subtitles.has_value()) {
-                                            WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> subtitlesArray;
-                                            std::vector<std::string> subtitles = element.subtitles.value();
-                                            for (auto& element : subtitles) {
-                                                subtitlesArray.Add() = element;
-                                            }
-                                            waysToWatchContainer.Subtitles = subtitlesArray;
-                                        }
-                                        if (element.audioDescriptions.has_value()) {
-                                            WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> audioDescriptionsArray;
-                                            std::vector<std::string> audioDescriptions = element.audioDescriptions.value();
-                                            for (auto& element : audioDescriptions) {
-                                                audioDescriptionsArray.Add() = element;
-                                            }
-                                            waysToWatchContainer.AudioDescriptions = audioDescriptionsArray;
-                                        }
-                                    }
-                                    waysToWatchArray.Add() = waysToWatchContainer;
-                                }
-                                Container.Entity.WaysToWatch = waysToWatchArray;
-                            }
-                        }
-                        if (element.related.has_value()) {
-                            WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_EntityInfo> relatedArray;
-                            std::vector<Entertainment::EntityInfo> related = element.related.value();
-                            for (auto& element : related) {
-                                Firebolt::Entertainment::JsonData_EntityInfo relatedContainer;
-                                {
-                                    {
-                                        if (element.identifiers.assetId.has_value()) {
-                                            relatedContainer.Identifiers.AssetId = element.identifiers.assetId.value();
-                                        }
-                                        if (element.identifiers.entityId.has_value()) {
-                                            relatedContainer.Identifiers.EntityId = element.identifiers.entityId.value();
-                                        }
-                                        if (element.identifiers.seasonId.has_value()) {
-                                            relatedContainer.Identifiers.SeasonId = element.identifiers.seasonId.value();
-                                        }
-                                        if (element.identifiers.seriesId.has_value()) {
-                                            relatedContainer.Identifiers.SeriesId = element.identifiers.seriesId.value();
-                                        }
-                                        if (element.identifiers.appContentData.has_value()) {
-                                            relatedContainer.Identifiers.AppContentData = element.identifiers.appContentData.value();
-                                        }
-                                    }
-                                    relatedContainer.Title = element.title;
-                                    relatedContainer.EntityType = element.entityType;
-                                    if (element.programType.has_value()) {
-                                        relatedContainer.ProgramType = element.programType.value();
-                                    }
-                                    if (element.musicType.has_value()) {
-                                        relatedContainer.MusicType = element.musicType.value();
-                                    }
-                                    if (element.synopsis.has_value()) {
-                                        relatedContainer.Synopsis = element.synopsis.value();
-                                    }
-                                    if (element.seasonNumber.has_value()) {
-                                        relatedContainer.SeasonNumber = element.seasonNumber.value();
-                                    }
-                                    if (element.seasonCount.has_value()) {
-                                        relatedContainer.SeasonCount = element.seasonCount.value();
-                                    }
-                                    if (element.episodeNumber.has_value()) {
-                                        relatedContainer.EpisodeNumber = element.episodeNumber.value();
-                                    }
-                                    if (element.episodeCount.has_value()) {
-                                        relatedContainer.EpisodeCount = element.episodeCount.value();
-                                    }
-                                    if (element.releaseDate.has_value()) {
-                                        relatedContainer.ReleaseDate = element.releaseDate.value();
-                                    }
-                                    if (element.contentRatings.has_value()) {
-                                        WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_ContentRating> contentRatingsArray;
-                                        std::vector<Entertainment::ContentRating> contentRatings = element.contentRatings.value();
-                                        for (auto& element : contentRatings) {
-                                            Firebolt::Entertainment::JsonData_ContentRating contentRatingsContainer;
-                                            {
-                                                contentRatingsContainer.Scheme = element.scheme;
-                                                contentRatingsContainer.Rating = element.rating;
-                                                if (element.advisories.has_value()) {
-                                                    WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> advisoriesArray;
-                                                    std::vector<std::string> advisories = element.advisories.value();
-                                                    for (auto& element : advisories) {
-                                                        advisoriesArray.Add() = element;
-                                                    }
-                                                    contentRatingsContainer.Advisories = advisoriesArray;
-                                                }
-                                            }
-                                            contentRatingsArray.Add() = contentRatingsContainer;
-                                        }
-                                        relatedContainer.ContentRatings = contentRatingsArray;
-                                    }
-                                    if (element.waysToWatch.has_value()) {
-                                        WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_WayToWatch> waysToWatchArray;
-                                        std::vector<Entertainment::WayToWatch> waysToWatch = element.waysToWatch.value();
-                                        for (auto& element : waysToWatch) {
-                                            Firebolt::Entertainment::JsonData_WayToWatch waysToWatchContainer;
-                                            {
-                                                {
-                                                    if (element.identifiers.assetId.has_value()) {
-                                                        waysToWatchContainer.Identifiers.AssetId = element.identifiers.assetId.value();
-                                                    }
-                                                    if (element.identifiers.entityId.has_value()) {
-                                                        waysToWatchContainer.Identifiers.EntityId = element.identifiers.entityId.value();
-                                                    }
-                                                    if (element.identifiers.seasonId.has_value()) {
-                                                        waysToWatchContainer.Identifiers.SeasonId = element.identifiers.seasonId.value();
-                                                    }
-                                                    if (element.identifiers.seriesId.has_value()) {
-                                                        waysToWatchContainer.Identifiers.SeriesId = element.identifiers.seriesId.value();
-                                                    }
-                                                    if (element.identifiers.appContentData.has_value()) {
-                                                        waysToWatchContainer.Identifiers.AppContentData = element.identifiers.appContentData.value();
-                                                    }
-                                                }
-                                                if (element.expires.has_value()) {
-                                                    waysToWatchContainer.Expires = element.expires.value();
-                                                }
-                                                if (element.entitled.has_value()) {
-                                                    waysToWatchContainer.Entitled = element.entitled.value();
-                                                }
-                                                if (element.entitledExpires.has_value()) {
-                                                    waysToWatchContainer.EntitledExpires = element.entitledExpires.value();
-                                                }
-                                                if (element.offeringType.has_value()) {
-                                                    waysToWatchContainer.OfferingType = element.offeringType.value();
-                                                }
-                                                if (element.hasAds.has_value()) {
-                                                    waysToWatchContainer.HasAds = element.hasAds.value();
-                                                }
-                                                if (element.price.has_value()) {
-                                                    waysToWatchContainer.Price = element.price.value();
-                                                }
-                                                if (element.videoQuality.has_value()) {
-                                                    WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_WayToWatchVideoQuality> videoQualityArray;
-                                                    std::vector<Entertainment::WayToWatchVideoQuality> videoQuality = element.videoQuality.value();
-                                                    for (auto& element : videoQuality) {
-                                                        videoQualityArray.Add() = element;
-                                                    }
-                                                    waysToWatchContainer.VideoQuality = videoQualityArray;
-                                                }
-                                                WPEFramework::Core::JSON::ArrayType<Firebolt::Types::JsonData_AudioProfile> audioProfileArray;
-                                                std::vector<Types::AudioProfile> audioProfile = element.audioProfile;
-                                                for (auto& element : audioProfile) {
-                                                    audioProfileArray.Add() = element;
-                                                }
-                                                waysToWatchContainer.AudioProfile = audioProfileArray;
-                                                if (element.audioLanguages.has_value()) {
-                                                    WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> audioLanguagesArray;
-                                                    std::vector<std::string> audioLanguages = element.audioLanguages.value();
-                                                    for (auto& element : audioLanguages) {
-                                                        audioLanguagesArray.Add() = element;
-                                                    }
-                                                    waysToWatchContainer.AudioLanguages = audioLanguagesArray;
-                                                }
-                                                if (element.closedCaptions.has_value()) {
-                                                    WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> closedCaptionsArray;
-                                                    std::vector<std::string> closedCaptions = element.closedCaptions.value();
-                                                    for (auto& element : closedCaptions) {
-                                                        closedCaptionsArray.Add() = element;
-                                                    }
-                                                    waysToWatchContainer.ClosedCaptions = closedCaptionsArray;
-                                                }
-                                                if (element.subtitles.has_value()) {
-                                                    WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> subtitlesArray;
-                                                    std::vector<std::string> subtitles = element.subtitles.value();
-                                                    for (auto& element : subtitles) {
-                                                        subtitlesArray.Add() = element;
-                                                    }
-                                                    waysToWatchContainer.Subtitles = subtitlesArray;
-                                                }
-                                                if (element.audioDescriptions.has_value()) {
-                                                    WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> audioDescriptionsArray;
-                                                    std::vector<std::string> audioDescriptions = element.audioDescriptions.value();
-                                                    for (auto& element : audioDescriptions) {
-                                                        audioDescriptionsArray.Add() = element;
-                                                    }
-                                                    waysToWatchContainer.AudioDescriptions = audioDescriptionsArray;
-                                                }
-                                            }
-                                            waysToWatchArray.Add() = waysToWatchContainer;
-                                        }
-                                        relatedContainer.WaysToWatch = waysToWatchArray;
-                                    }
-                                }
-                                relatedArray.Add() = relatedContainer;
-                            }
-                            Container.Related = relatedArray;
-                        }
-                    }
-            }
-            string resultStr;
-            Container.ToString(resultStr);
-            WPEFramework::Core::JSON::VariantContainer resultContainer(resultStr);
-            WPEFramework::Core::JSON::Variant Result = resultContainer;
-            jsonParameters.Set(_T("result"), Result);
+            FireboltSDK::Arena arena;
+            FireboltSDK::JsonWriter jsonParameters;
+            jsonParameters.Add(_T("correlationId"), proxyResponse->CorrelationId.Value());
+            jsonParameters.Add(_T("result"), element);
             {
                 WPEFramework::Core::JSON::Boolean jsonResult;
 
-                status = FireboltSDK::Gateway::Instance().Request("discovery.entityInfo", jsonParameters, jsonResult);
+                status = FireboltSDK::Gateway::Instance().Request("discovery.entityInfo", jsonParameters.Finish(), jsonResult);
                 if (status == Firebolt::Error::None) {
                     FIREBOLT_LOG_INFO(FireboltSDK::Logger::Category::OpenRPC, FireboltSDK::Logger::Module<FireboltSDK::Accessor>(), "Discovery.onPullEntityInfo is successfully pushed with status as %d", jsonResult.Value());
                 }
@@ -1487,195 +537,19 @@ The app should actively push `purchasedContent` when:
             if (jsonResult.ProgramType.IsSet()) {
                 purchasedContentParametersResult.programType = jsonResult.ProgramType.Value();
             }
-            purchasedContentParameters = purchasedContentParametersResult;
+            purchasedContentParameters = std::move(purchasedContentParametersResult);
 
             IDiscovery::IOnPullPurchasedContentNotification& notifier = *(reinterpret_cast<IDiscovery::IOnPullPurchasedContentNotification*>(notification));
             PurchasedContentResult element = notifier.onPullPurchasedContent(purchasedContentParameters);
             Firebolt::Error status = Firebolt::Error::NotConnected;
-            JsonObject jsonParameters;
-            WPEFramework::Core::JSON::Variant CorrelationId = proxyResponse->CorrelationId.Value();
-            jsonParameters.Set(_T("correlationId"), CorrelationId);
-            JsonData_PurchasedContentResult Container;
-            {
-                {
-                        Container.Expires = element.expires;
-                        Container.TotalCount = element.totalCount;
-                        WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_EntityInfo> entriesArray;
-                        std::vector<Entertainment::EntityInfo> entries = element.entries;
-                        for (auto& element : entries) {
-                            Firebolt::Entertainment::JsonData_EntityInfo entriesContainer;
-                            {
-                                {
-                                    if (element.identifiers.assetId.has_value()) {
-                                        entriesContainer.Identifiers.AssetId = element.identifiers.assetId.value();
-                                    }
-                                    if (element.identifiers.entityId.has_value()) {
-                                        entriesContainer.Identifiers.EntityId = element.identifiers.entityId.value();
-                                    }
-                                    if (element.identifiers.seasonId.has_value()) {
-                                        entriesContainer.Identifiers.SeasonId = element.identifiers.seasonId.value();
-                                    }
-                                    if (element.identifiers.seriesId.has_value()) {
-                                        entriesContainer.Identifiers.SeriesId = element.identifiers.seriesId.value();
-                                    }
-                                    if (element.identifiers.appContentData.has_value()) {
-                                        entriesContainer.Identifiers.AppContentData = element.identifiers.appContentData.value();
-                                    }
-                                }
-                                entriesContainer.Title = element.title;
-                                entriesContainer.EntityType = element.entityType;
-                                if (element.programType.has_value()) {
-                                    entriesContainer.ProgramType = element.programType.value();
-                                }
-                                if (element.musicType.has_value()) {
-                                    entriesContainer.MusicType = element.musicType.value();
-                                }
-                                if (element.synopsis.has_value()) {
-                                    entriesContainer.Synopsis = element.synopsis.value();
-                                }
-                                if (element.seasonNumber.has_value()) {
-                                    entriesContainer.SeasonNumber = element.seasonNumber.value();
-                                }
-                                if (element.seasonCount.has_value()) {
-                                    entriesContainer.SeasonCount = element.seasonCount.value();
-                                }
-                                if (element.episodeNumber.has_value()) {
-                                    entriesContainer.EpisodeNumber = element.episodeNumber.value();
-                                }
-                                if (element.episodeCount.has_value()) {
-                                    entriesContainer.EpisodeCount = element.episodeCount.value();
-                                }
-                                if (element.releaseDate.has_value()) {
-                                    entriesContainer.ReleaseDate = element.releaseDate.value();
-                                }
-                                if (element.contentRatings.has_value()) {
-                                    WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_ContentRating> contentRatingsArray;
-                                    std::vector<Entertainment::ContentRating> contentRatings = element.contentRatings.value();
-                                    for (auto& element : contentRatings) {
-                                        Firebolt::Entertainment::JsonData_ContentRating contentRatingsContainer;
-                                        {
-                                            contentRatingsContainer.Scheme = element.scheme;
-                                            contentRatingsContainer.Rating = element.rating;
-                                            if (element.advisories.has_value()) {
-                                                WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> advisoriesArray;
-                                                std::vector<std::string> advisories = element.advisories.value();
-                                                for (auto& element : advisories) {
-                                                    advisoriesArray.Add() = element;
-                                                }
-                                                contentRatingsContainer.Advisories = advisoriesArray;
-                                            }
-                                        }
-                                        contentRatingsArray.Add() = contentRatingsContainer;
-                                    }
-                                    entriesContainer.ContentRatings = contentRatingsArray;
-                                }
-                                if (element.waysToWatch.has_value()) {
-                                    WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_WayToWatch> waysToWatchArray;
-                                    std::vector<Entertainment::WayToWatch> waysToWatch = element.waysToWatch.value();
-                                    for (auto& element : waysToWatch) {
-                                        Firebolt::Entertainment::JsonData_WayToWatch waysToWatchContainer;
-                                        {
-                                            {
-                                                if (element.identifiers.assetId.has_value()) {
-                                                    waysToWatchContainer.Identifiers.AssetId = element.identifiers.assetId.value();
-                                                }
-                                                if (element.identifiers.entityId.has_value()) {
-                                                    waysToWatchContainer.Identifiers.EntityId = element.identifiers.entityId.value();
-                                                }
-                                                if (element.identifiers.seasonId.has_value()) {
-                                                    waysToWatchContainer.Identifiers.SeasonId = element.identifiers.seasonId.value();
-                                                }
-                                                if (element.identifiers.seriesId.has_value()) {
-                                                    waysToWatchContainer.Identifiers.SeriesId = element.identifiers.seriesId.value();
-                                                }
-                                                if (element.identifiers.appContentData.has_value()) {
-                                                    waysToWatchContainer.Identifiers.AppContentData = element.identifiers.appContentData.value();
-                                                }
-                                            }
-                                            if (element.expires.has_value()) {
-                                                waysToWatchContainer.Expires = element.expires.value();
-                                            }
-                                            if (element.entitled.has_value()) {
-                                                waysToWatchContainer.Entitled = element.entitled.value();
-                                            }
-                                            if (element.entitledExpires.has_value()) {
-                                                waysToWatchContainer.EntitledExpires = element.entitledExpires.value();
-                                            }
-                                            if (element.offeringType.has_value()) {
-                                                waysToWatchContainer.OfferingType = element.offeringType.value();
-                                            }
-                                            if (element.hasAds.has_value()) {
-                                                waysToWatchContainer.HasAds = element.hasAds.value();
-                                            }
-                                            if (element.price.has_value()) {
-                                                waysToWatchContainer.Price = element.price.value();
-                                            }
-                                            if (element.videoQuality.has_value()) {
-                                                WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_WayToWatchVideoQuality> videoQualityArray;
-                                                std::vector<Entertainment::WayToWatchVideoQuality> videoQuality = element.videoQuality.value();
-                                                for (auto& element : videoQuality) {
-                                                    videoQualityArray.Add() = element;
-                                                }
-                                                waysToWatchContainer.VideoQuality = videoQualityArray;
-                                            }
-                                            WPEFramework::Core::JSON::ArrayType<Firebolt::Types::JsonData_AudioProfile> audioProfileArray;
-                                            std::vector<Types::AudioProfile> audioProfile = element.audioProfile;
-                                            for (auto& element : audioProfile) {
-                                                audioProfileArray.Add() = element;
-                                            }
-                                            waysToWatchContainer.AudioProfile = audioProfileArray;
-                                            if (element.audioLanguages.has_value()) {
-                                                WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> audioLanguagesArray;
-                                                std::vector<std::string> audioLanguages = element.audioLanguages.value();
-                                                for (auto& element : audioLanguages) {
-                                                    audioLanguagesArray.Add() = element;
-                                                }
-                                                waysToWatchContainer.AudioLanguages = audioLanguagesArray;
-                                            }
-                                            if (element.closedCaptions.has_value()) {
-                                                WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> closedCaptionsArray;
-                                                std::vector<std::string> closedCaptions = element.closedCaptions.value();
-                                                for (auto& element : closedCaptions) {
-                                                    closedCaptionsArray.Add() = element;
-                                                }
-                                                waysToWatchContainer.ClosedCaptions = closedCaptionsArray;
-                                            }
-                                            if (element.subtitles.has_value()) {
-                                                WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> subtitlesArray;
-                                                std::vector<std::string> subtitles = element.subtitles.value();
-                                                for (auto& element : subtitles) {
-                                                    subtitlesArray.Add() = element;
-                                                }
-                                                waysToWatchContainer.Subtitles = subtitlesArray;
-                                            }
-                                            if (element.audioDescriptions.has_value()) {
-                                                WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> audioDescriptionsArray;
-                                                std::vector<std::string> audioDescriptions = element.audioDescriptions.value();
-                                                for (auto& element : audioDescriptions) {
-                                                    audioDescriptionsArray.Add() = element;
-                                                }
-                                                waysToWatchContainer.AudioDescriptions = audioDescriptionsArray;
-                                            }
-                                        }
-                                        waysToWatchArray.Add() = waysToWatchContainer;
-                                    }
-                                    entriesContainer.WaysToWatch = waysToWatchArray;
-                                }
-                            }
-                            entriesArray.Add() = entriesContainer;
-                        }
-                        Container.Entries = entriesArray;
-                    }
-            }
-            string resultStr;
-            Container.ToString(resultStr);
-            WPEFramework::Core::JSON::VariantContainer resultContainer(resultStr);
-            WPEFramework::Core::JSON::Variant Result = resultContainer;
-            jsonParameters.Set(_T("result"), Result);
+            FireboltSDK::Arena arena;
+            FireboltSDK::JsonWriter jsonParameters;
+            jsonParameters.Add(_T("correlationId"), proxyResponse->CorrelationId.Value());
+            jsonParameters.Add(_T("result"), element);
             {
                 WPEFramework::Core::JSON::Boolean jsonResult;
 
-                status = FireboltSDK::Gateway::Instance().Request("discovery.purchasedContent", jsonParameters, jsonResult);
+                status = FireboltSDK::Gateway::Instance().Request("discovery.purchasedContent", jsonParameters.Finish(), jsonResult);
                 if (status == Firebolt::Error::None) {
                     FIREBOLT_LOG_INFO(FireboltSDK::Logger::Category::OpenRPC, FireboltSDK::Logger::Module<FireboltSDK::Accessor>(), "Discovery.onPullPurchasedContent is successfully pushed with status as %d", jsonResult.Value());
                 }
@@ -43,58 +43,6 @@ namespace Discovery {
 
 
     // Types
-    class JsonData_Availability: public WPEFramework::Core::JSON::Container {
-    public:
-        ~JsonData_Availability() override = default;
-  
-    public:
-        JsonData_Availability()
-            : WPEFramework::Core::JSON::Container()
-        {
-            Add(_T("type"), &Type);
-            Add(_T("id"), &Id);
-            Add(_T("catalogId"), &CatalogId);
-            Add(_T("startTime"), &StartTime);
-            Add(_T("endTime"), &EndTime);
-        }
-
-        JsonData_Availability(const JsonData_Availability& other)
-        {
-            Add(_T("type"), &Type);
-            Type = other.Type;
-            Add(_T("id"), &Id);
-            Id = other.Id;
-            Add(_T("catalogId"), &CatalogId);
-            CatalogId = other.CatalogId;
-            Add(_T("startTime"), &StartTime);
-            StartTime = other.StartTime;
-            Add(_T("endTime"), &EndTime);
-            EndTime = other.EndTime;
-        }
-
-        JsonData_Availability& operator=(const JsonData_Availability& other)
-        {
-            Add(_T("type"), &Type);
-            Type = other.Type;
-            Add(_T("id"), &Id);
-            Id = other.Id;
-            Add(_T("catalogId"), &CatalogId);
-            CatalogId = other.CatalogId;
-            Add(_T("startTime"), &StartTime);
-            StartTime = other.StartTime;
-            Add(_T("endTime"), &EndTime);
-            EndTime = other.EndTime;
-            return (*this);
-        }
-
-    public:
-        Firebolt::Discovery::JsonData_AvailabilityType Type;
-        FireboltSDK::JSON::String Id;
-        FireboltSDK::JSON::String CatalogId;
-        FireboltSDK::JSON::String StartTime;
-        FireboltSDK::JSON::String EndTime;
-    };
-
     class JsonData_UserInterestProviderParameters: public WPEFramework::Core::JSON::Container {
     public:
         ~JsonData_UserInterestProviderParameters() override = default;
@@ -129,40 +77,6 @@ namespace Discovery {
         Firebolt::Discovery::JsonData_InterestReason Reason;
     };
 
-    class JsonData_ContentAccessIdentifiers: public WPEFramework::Core::JSON::Container {
-    public:
-        ~JsonData_ContentAccessIdentifiers() override = default;
-  
-    public:
-        JsonData_ContentAccessIdentifiers()
-            : WPEFramework::Core::JSON::Container()
-        {
-            Add(_T("availabilities"), &Availabilities);
-            Add(_T("entitlements"), &Entitlements);
-        }
-
-        JsonData_ContentAccessIdentifiers(const JsonData_ContentAccessIdentifiers& other)
-        {
-            Add(_T("availabilities"), &Availabilities);
-            Availabilities = other.Availabilities;
-            Add(_T("entitlements"), &Entitlements);
-            Entitlements = other.Entitlements;
-        }
-
-        JsonData_ContentAccessIdentifiers& operator=(const JsonData_ContentAccessIdentifiers& other)
-        {
-            Add(_T("availabilities"), &Availabilities);
-            Availabilities = other.Availabilities;
-            Add(_T("entitlements"), &Entitlements);
-            Entitlements = other.Entitlements;
-            return (*this);
-        }
-
-    public:
-        WPEFramework::Core::JSON::ArrayType<Firebolt::Discovery::JsonData_Availability> Availabilities;
-        WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_Entitlement> Entitlements;
-    };
-
     using JsonData_Images = WPEFramework::Core::JSON::VariantContainer;
 
     class JsonData_Request: public WPEFramework::Core::JSON::Container {
@@ -525,3 +439,29 @@ The app should actively push `purchasedContent` when:
 
 } //namespace Discovery
 }
+
+namespace FireboltSDK {
+
+    // Field tables, the wire names of the members
+    template <>
+    struct Reflect<Firebolt::Discovery::Availability> {
+        using Type = Firebolt::Discovery::Availability;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("type", &Type::type),
+            MakeField("id", &Type::id),
+            MakeField("catalogId", &Type::catalogId),
+            MakeField("startTime", &Type::startTime),
+            MakeField("endTime", &Type::endTime)
+        );
+    };
+
+    template <>
+    struct Reflect<Firebolt::Discovery::ContentAccessIdentifiers> {
+        using Type = Firebolt::Discovery::ContentAccessIdentifiers;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("availabilities", &Type::availabilities),
+            MakeField("entitlements", &Type::entitlements)
+        );
+    };
+
+}
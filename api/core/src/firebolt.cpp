@@ -128,6 +128,21 @@ namespace Firebolt {
         {
         }
 
+        void Dispatcher(IDispatcher* dispatcher) override
+        {
+            _accessor->Dispatcher(dispatcher);
+        }
+
+        int Descriptor() const override
+        {
+            return _accessor->Descriptor();
+        }
+
+        Firebolt::Error Process(const uint32_t timeout) override
+        {
+            return _accessor->Process(timeout);
+        }
+
         Accessibility::IAccessibility& AccessibilityInterface() const override
         {
             auto module = _moduleMap.find("Accessibility");
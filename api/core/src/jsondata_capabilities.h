@@ -163,3 +163,31 @@ namespace Capabilities {
 
 }
 }
+
+namespace FireboltSDK {
+
+    // Field tables, the wire names of the members
+    template <>
+    struct Reflect<Firebolt::Capabilities::CapPermissionStatus> {
+        using Type = Firebolt::Capabilities::CapPermissionStatus;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("permitted", &Type::permitted),
+            MakeField("granted", &Type::granted)
+        );
+    };
+
+    template <>
+    struct Reflect<Firebolt::Capabilities::CapabilityInfo> {
+        using Type = Firebolt::Capabilities::CapabilityInfo;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("capability", &Type::capability),
+            MakeField("supported", &Type::supported),
+            MakeField("available", &Type::available),
+            MakeField("use", &Type::use),
+            MakeField("manage", &Type::manage),
+            MakeField("provide", &Type::provide),
+            MakeField("details", &Type::details)
+        );
+    };
+
+}
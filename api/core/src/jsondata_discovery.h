@@ -22,89 +22,27 @@
 #include "jsondata_entertainment.h"
 #include "common/discovery.h"
 
-namespace Firebolt {
-namespace Discovery {
-
-    // Types
-    class JsonData_PurchasedContentResult: public WPEFramework::Core::JSON::Container {
-    public:
-        ~JsonData_PurchasedContentResult() override = default;
-  
-    public:
-        JsonData_PurchasedContentResult()
-            : WPEFramework::Core::JSON::Container()
-        {
-            Add(_T("expires"), &Expires);
-            Add(_T("totalCount"), &TotalCount);
-            Add(_T("entries"), &Entries);
-        }
-
-        JsonData_PurchasedContentResult(const JsonData_PurchasedContentResult& other)
-        {
-            Add(_T("expires"), &Expires);
-            Expires = other.Expires;
-            Add(_T("totalCount"), &TotalCount);
-            TotalCount = other.TotalCount;
-            Add(_T("entries"), &Entries);
-            Entries = other.Entries;
-        }
-
-        JsonData_PurchasedContentResult& operator=(const JsonData_PurchasedContentResult& other)
-        {
-            Add(_T("expires"), &Expires);
-            Expires = other.Expires;
-            Add(_T("totalCount"), &TotalCount);
-            TotalCount = other.TotalCount;
-            Add(_T("entries"), &Entries);
-            Entries = other.Entries;
-            return (*this);
-        }
-
-    public:
-        FireboltSDK::JSON::String Expires;
-        WPEFramework::Core::JSON::DecSInt32 TotalCount;
-        WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_EntityInfo> Entries;
+namespace FireboltSDK {
+
+    // Field tables, the wire names of the members
+    template <>
+    struct Reflect<Firebolt::Discovery::PurchasedContentResult> {
+        using Type = Firebolt::Discovery::PurchasedContentResult;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("expires", &Type::expires),
+            MakeField("totalCount", &Type::totalCount),
+            MakeField("entries", &Type::entries)
+        );
     };
 
-    class JsonData_EntityInfoResult: public WPEFramework::Core::JSON::Container {
-    public:
-        ~JsonData_EntityInfoResult() override = default;
-  
-    public:
-        JsonData_EntityInfoResult()
-            : WPEFramework::Core::JSON::Container()
-        {
-            Add(_T("expires"), &Expires);
-            Add(_T("entity"), &Entity);
-            Add(_T("related"), &Related);
-        }
-
-        JsonData_EntityInfoResult(const JsonData_EntityInfoResult& other)
-        {
-            Add(_T("expires"), &Expires);
-            Expires = other.Expires;
-            Add(_T("entity"), &Entity);
-            Entity = other.Entity;
-            Add(_T("related"), &Related);
-            Related = other.Related;
-        }
-
-        JsonData_EntityInfoResult& operator=(const JsonData_EntityInfoResult& other)
-        {
-            Add(_T("expires"), &Expires);
-            Expires = other.Expires;
-            Add(_T("entity"), &Entity);
-            Entity = other.Entity;
-            Add(_T("related"), &Related);
-            Related = other.Related;
-            return (*this);
-        }
-
-    public:
-        FireboltSDK::JSON::String Expires;
-        Firebolt::Entertainment::JsonData_EntityInfo Entity;
-        WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_EntityInfo> Related;
+    template <>
+    struct Reflect<Firebolt::Discovery::EntityInfoResult> {
+        using Type = Firebolt::Discovery::EntityInfoResult;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("expires", &Type::expires),
+            MakeField("entity", &Type::entity),
+            MakeField("related", &Type::related)
+        );
     };
 
 }
-}
@@ -38,337 +38,82 @@ namespace Entertainment {
 
     using JsonData_ContentRatingScheme = WPEFramework::Core::JSON::EnumType<ContentRatingScheme>;
 
-    class JsonData_ContentIdentifiers: public WPEFramework::Core::JSON::Container {
-    public:
-        ~JsonData_ContentIdentifiers() override = default;
-  
-    public:
-        JsonData_ContentIdentifiers()
-            : WPEFramework::Core::JSON::Container()
-        {
-            Add(_T("assetId"), &AssetId);
-            Add(_T("entityId"), &EntityId);
-            Add(_T("seasonId"), &SeasonId);
-            Add(_T("seriesId"), &SeriesId);
-            Add(_T("appContentData"), &AppContentData);
-        }
-
-        JsonData_ContentIdentifiers(const JsonData_ContentIdentifiers& other)
-        {
-            Add(_T("assetId"), &AssetId);
-            AssetId = other.AssetId;
-            Add(_T("entityId"), &EntityId);
-            EntityId = other.EntityId;
-            Add(_T("seasonId"), &SeasonId);
-            SeasonId = other.SeasonId;
-            Add(_T("seriesId"), &SeriesId);
-            SeriesId = other.SeriesId;
-            Add(_T("appContentData"), &AppContentData);
-            AppContentData = other.AppContentData;
-        }
-
-        JsonData_ContentIdentifiers& operator=(const JsonData_ContentIdentifiers& other)
-        {
-            Add(_T("assetId"), &AssetId);
-            AssetId = other.AssetId;
-            Add(_T("entityId"), &EntityId);
-            EntityId = other.EntityId;
-            Add(_T("seasonId"), &SeasonId);
-            SeasonId = other.SeasonId;
-            Add(_T("seriesId"), &SeriesId);
-            SeriesId = other.SeriesId;
-            Add(_T("appContentData"), &AppContentData);
-            AppContentData = other.AppContentData;
-            return (*this);
-        }
+}
+}
 
-    public:
-        FireboltSDK::JSON::String AssetId;
-        FireboltSDK::JSON::String EntityId;
-        FireboltSDK::JSON::String SeasonId;
-        FireboltSDK::JSON::String SeriesId;
-        FireboltSDK::JSON::String AppContentData;
+namespace FireboltSDK {
+
+    // Field tables, the wire names of the members
+    template <>
+    struct Reflect<Firebolt::Entertainment::ContentIdentifiers> {
+        using Type = Firebolt::Entertainment::ContentIdentifiers;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("assetId", &Type::assetId),
+            MakeField("entityId", &Type::entityId),
+            MakeField("seasonId", &Type::seasonId),
+            MakeField("seriesId", &Type::seriesId),
+            MakeField("appContentData", &Type::appContentData)
+        );
     };
 
-    class JsonData_WayToWatch: public WPEFramework::Core::JSON::Container {
-    public:
-        ~JsonData_WayToWatch() override = default;
-  
-    public:
-        JsonData_WayToWatch()
-            : WPEFramework::Core::JSON::Container()
-        {
-            Add(_T("identifiers"), &Identifiers);
-            Add(_T("expires"), &Expires);
-            Add(_T("entitled"), &Entitled);
-            Add(_T("entitledExpires"), &EntitledExpires);
-            Add(_T("offeringType"), &OfferingType);
-            Add(_T("hasAds"), &HasAds);
-            Add(_T("price"), &Price);
-            Add(_T("videoQuality"), &VideoQuality);
-            Add(_T("audioProfile"), &AudioProfile);
-            Add(_T("audioLanguages"), &AudioLanguages);
-            Add(_T("closedCaptions"), &ClosedCaptions);
-            Add(_T("subtitles"), &Subtitles);
-            Add(_T("audioDescriptions"), &AudioDescriptions);
-        }
-
-        JsonData_WayToWatch(const JsonData_WayToWatch& other)
-        {
-            Add(_T("identifiers"), &Identifiers);
-            Identifiers = other.Identifiers;
-            Add(_T("expires"), &Expires);
-            Expires = other.Expires;
-            Add(_T("entitled"), &Entitled);
-            Entitled = other.Entitled;
-            Add(_T("entitledExpires"), &EntitledExpires);
-            EntitledExpires = other.EntitledExpires;
-            Add(_T("offeringType"), &OfferingType);
-            OfferingType = other.OfferingType;
-            Add(_T("hasAds"), &HasAds);
-            HasAds = other.HasAds;
-            Add(_T("price"), &Price);
-            Price = other.Price;
-            Add(_T("videoQuality"), &VideoQuality);
-            VideoQuality = other.VideoQuality;
-            Add(_T("audioProfile"), &AudioProfile);
-            AudioProfile = other.AudioProfile;
-            Add(_T("audioLanguages"), &AudioLanguages);
-            AudioLanguages = other.AudioLanguages;
-            Add(_T("closedCaptions"), &ClosedCaptions);
-            ClosedCaptions = other.ClosedCaptions;
-            Add(_T("subtitles"), &Subtitles);
-            Subtitles = other.Subtitles;
-            Add(_T("audioDescriptions"), &AudioDescriptions);
-            AudioDescriptions = other.AudioDescriptions;
-        }
-
-        JsonData_WayToWatch& operator=(const JsonData_WayToWatch& other)
-        {
-            Add(_T("identifiers"), &Identifiers);
-            Identifiers = other.Identifiers;
-            Add(_T("expires"), &Expires);
-            Expires = other.Expires;
-            Add(_T("entitled"), &Entitled);
-            Entitled = other.Entitled;
-            Add(_T("entitledExpires"), &EntitledExpires);
-            EntitledExpires = other.EntitledExpires;
-            Add(_T("offeringType"), &OfferingType);
-            OfferingType = other.OfferingType;
-            Add(_T("hasAds"), &HasAds);
-            HasAds = other.HasAds;
-            Add(_T("price"), &Price);
-            Price = other.Price;
-            Add(_T("videoQuality"), &VideoQuality);
-            VideoQuality = other.VideoQuality;
-            Add(_T("audioProfile"), &AudioProfile);
-            AudioProfile = other.AudioProfile;
-            Add(_T("audioLanguages"), &AudioLanguages);
-            AudioLanguages = other.AudioLanguages;
-            Add(_T("closedCaptions"), &ClosedCaptions);
-            ClosedCaptions = other.ClosedCaptions;
-            Add(_T("subtitles"), &Subtitles);
-            Subtitles = other.Subtitles;
-            Add(_T("audioDescriptions"), &AudioDescriptions);
-            AudioDescriptions = other.AudioDescriptions;
-            return (*this);
-        }
-
-    public:
-        Firebolt::Entertainment::JsonData_ContentIdentifiers Identifiers;
-        FireboltSDK::JSON::String Expires;
-        WPEFramework::Core::JSON::Boolean Entitled;
-        FireboltSDK::JSON::String EntitledExpires;
-        Firebolt::Entertainment::JsonData_OfferingType OfferingType;
-        WPEFramework::Core::JSON::Boolean HasAds;
-        WPEFramework::Core::JSON::Float Price;
-        WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_WayToWatchVideoQuality> VideoQuality;
-        WPEFramework::Core::JSON::ArrayType<Firebolt::Types::JsonData_AudioProfile> AudioProfile;
-        WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> AudioLanguages;
-        WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> ClosedCaptions;
-        WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> Subtitles;
-        WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> AudioDescriptions;
+    template <>
+    struct Reflect<Firebolt::Entertainment::WayToWatch> {
+        using Type = Firebolt::Entertainment::WayToWatch;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("identifiers", &Type::identifiers),
+            MakeField("expires", &Type::expires),
+            MakeField("entitled", &Type::entitled),
+            MakeField("entitledExpires", &Type::entitledExpires),
+            MakeField("offeringType", &Type::offeringType),
+            MakeField("hasAds", &Type::hasAds),
+            MakeField("price", &Type::price),
+            MakeField("videoQuality", &Type::videoQuality),
+            MakeField("audioProfile", &Type::audioProfile),
+            MakeField("audioLanguages", &Type::audioLanguages),
+            MakeField("closedCaptions", &Type::closedCaptions),
+            MakeField("subtitles", &Type::subtitles),
+            MakeField("audioDescriptions", &Type::audioDescriptions)
+        );
     };
 
-    class JsonData_ContentRating: public WPEFramework::Core::JSON::Container {
-    public:
-        ~JsonData_ContentRating() override = default;
-  
-    public:
-        JsonData_ContentRating()
-            : WPEFramework::Core::JSON::Container()
-        {
-            Add(_T("scheme"), &Scheme);
-            Add(_T("rating"), &Rating);
-            Add(_T("advisories"), &Advisories);
-        }
-
-        JsonData_ContentRating(const JsonData_ContentRating& other)
-        {
-            Add(_T("scheme"), &Scheme);
-            Scheme = other.Scheme;
-            Add(_T("rating"), &Rating);
-            Rating = other.Rating;
-            Add(_T("advisories"), &Advisories);
-            Advisories = other.Advisories;
-        }
-
-        JsonData_ContentRating& operator=(const JsonData_ContentRating& other)
-        {
-            Add(_T("scheme"), &Scheme);
-            Scheme = other.Scheme;
-            Add(_T("rating"), &Rating);
-            Rating = other.Rating;
-            Add(_T("advisories"), &Advisories);
-            Advisories = other.Advisories;
-            return (*this);
-        }
-
-    public:
-        Firebolt::Entertainment::JsonData_ContentRatingScheme Scheme;
-        FireboltSDK::JSON::String Rating;
-        WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> Advisories;
+    template <>
+    struct Reflect<Firebolt::Entertainment::ContentRating> {
+        using Type = Firebolt::Entertainment::ContentRating;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("scheme", &Type::scheme),
+            MakeField("rating", &Type::rating),
+            MakeField("advisories", &Type::advisories)
+        );
     };
 
-    class JsonData_Entitlement: public WPEFramework::Core::JSON::Container {
-    public:
-        ~JsonData_Entitlement() override = default;
-  
-    public:
-        JsonData_Entitlement()
-            : WPEFramework::Core::JSON::Container()
-        {
-            Add(_T("entitlementId"), &EntitlementId);
-            Add(_T("startTime"), &StartTime);
-            Add(_T("endTime"), &EndTime);
-        }
-
-        JsonData_Entitlement(const JsonData_Entitlement& other)
-        {
-            Add(_T("entitlementId"), &EntitlementId);
-            EntitlementId = other.EntitlementId;
-            Add(_T("startTime"), &StartTime);
-            StartTime = other.StartTime;
-            Add(_T("endTime"), &EndTime);
-            EndTime = other.EndTime;
-        }
-
-        JsonData_Entitlement& operator=(const JsonData_Entitlement& other)
-        {
-            Add(_T("entitlementId"), &EntitlementId);
-            EntitlementId = other.EntitlementId;
-            Add(_T("startTime"), &StartTime);
-            StartTime = other.StartTime;
-            Add(_T("endTime"), &EndTime);
-            EndTime = other.EndTime;
-            return (*this);
-        }
-
-    public:
-        FireboltSDK::JSON::String EntitlementId;
-        FireboltSDK::JSON::String StartTime;
-        FireboltSDK::JSON::String EndTime;
+    template <>
+    struct Reflect<Firebolt::Entertainment::Entitlement> {
+        using Type = Firebolt::Entertainment::Entitlement;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("entitlementId", &Type::entitlementId),
+            MakeField("startTime", &Type::startTime),
+            MakeField("endTime", &Type::endTime)
+        );
     };
 
-    class JsonData_EntityInfo: public WPEFramework::Core::JSON::Container {
-    public:
-        ~JsonData_EntityInfo() override = default;
-  
-    public:
-        JsonData_EntityInfo()
-            : WPEFramework::Core::JSON::Container()
-        {
-            Add(_T("identifiers"), &Identifiers);
-            Add(_T("title"), &Title);
-            Add(_T("entityType"), &EntityType);
-            Add(_T("programType"), &ProgramType);
-            Add(_T("musicType"), &MusicType);
-            Add(_T("synopsis"), &Synopsis);
-            Add(_T("seasonNumber"), &SeasonNumber);
-            Add(_T("seasonCount"), &SeasonCount);
-            Add(_T("episodeNumber"), &EpisodeNumber);
-            Add(_T("episodeCount"), &EpisodeCount);
-            Add(_T("releaseDate"), &ReleaseDate);
-            Add(_T("contentRatings"), &ContentRatings);
-            Add(_T("waysToWatch"), &WaysToWatch);
-        }
-
-        JsonData_EntityInfo(const JsonData_EntityInfo& other)
-        {
-            Add(_T("identifiers"), &Identifiers);
-            Identifiers = other.Identifiers;
-            Add(_T("title"), &Title);
-            Title = other.Title;
-            Add(_T("entityType"), &EntityType);
-            EntityType = other.EntityType;
-            Add(_T("programType"), &ProgramType);
-            ProgramType = other.ProgramType;
-            Add(_T("musicType"), &MusicType);
-            MusicType = other.MusicType;
-            Add(_T("synopsis"), &Synopsis);
-            Synopsis = other.Synopsis;
-            Add(_T("seasonNumber"), &SeasonNumber);
-            SeasonNumber = other.SeasonNumber;
-            Add(_T("seasonCount"), &SeasonCount);
-            SeasonCount = other.SeasonCount;
-            Add(_T("episodeNumber"), &EpisodeNumber);
-            EpisodeNumber = other.EpisodeNumber;
-            Add(_T("episodeCount"), &EpisodeCount);
-            EpisodeCount = other.EpisodeCount;
-            Add(_T("releaseDate"), &ReleaseDate);
-            ReleaseDate = other.ReleaseDate;
-            Add(_T("contentRatings"), &ContentRatings);
-            ContentRatings = other.ContentRatings;
-            Add(_T("waysToWatch"), &WaysToWatch);
-            WaysToWatch = other.WaysToWatch;
-        }
-
-        JsonData_EntityInfo& operator=(const JsonData_EntityInfo& other)
-        {
-            Add(_T("identifiers"), &Identifiers);
-            Identifiers = other.Identifiers;
-            Add(_T("title"), &Title);
-            Title = other.Title;
-            Add(_T("entityType"), &EntityType);
-            EntityType = other.EntityType;
-            Add(_T("programType"), &ProgramType);
-            ProgramType = other.ProgramType;
-            Add(_T("musicType"), &MusicType);
-            MusicType = other.MusicType;
-            Add(_T("synopsis"), &Synopsis);
-            Synopsis = other.Synopsis;
-            Add(_T("seasonNumber"), &SeasonNumber);
-            SeasonNumber = other.SeasonNumber;
-            Add(_T("seasonCount"), &SeasonCount);
-            SeasonCount = other.SeasonCount;
-            Add(_T("episodeNumber"), &EpisodeNumber);
-            EpisodeNumber = other.EpisodeNumber;
-            Add(_T("episodeCount"), &EpisodeCount);
-            EpisodeCount = other.EpisodeCount;
-            Add(_T("releaseDate"), &ReleaseDate);
-            ReleaseDate = other.ReleaseDate;
-            Add(_T("contentRatings"), &ContentRatings);
-            ContentRatings = other.ContentRatings;
-            Add(_T("waysToWatch"), &WaysToWatch);
-            WaysToWatch = other.WaysToWatch;
-            return (*this);
-        }
-
-    public:
-        Firebolt::Entertainment::JsonData_ContentIdentifiers Identifiers;
-        FireboltSDK::JSON::String Title;
-        Firebolt::Entertainment::JsonData_EntityInfoEntityType EntityType;
-        Firebolt::Entertainment::JsonData_ProgramType ProgramType;
-        Firebolt::Entertainment::JsonData_MusicType MusicType;
-        FireboltSDK::JSON::String Synopsis;
-        WPEFramework::Core::JSON::Float SeasonNumber;
-        WPEFramework::Core::JSON::Float SeasonCount;
-        WPEFramework::Core::JSON::Float EpisodeNumber;
-        WPEFramework::Core::JSON::Float EpisodeCount;
-        FireboltSDK::JSON::String ReleaseDate;
-        WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_ContentRating> ContentRatings;
-        WPEFramework::Core::JSON::ArrayType<Firebolt::Entertainment::JsonData_WayToWatch> WaysToWatch;
+    template <>
+    struct Reflect<Firebolt::Entertainment::EntityInfo> {
+        using Type = Firebolt::Entertainment::EntityInfo;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("identifiers", &Type::identifiers),
+            MakeField("title", &Type::title),
+            MakeField("entityType", &Type::entityType),
+            MakeField("programType", &Type::programType),
+            MakeField("musicType", &Type::musicType),
+            MakeField("synopsis", &Type::synopsis),
+            MakeField("seasonNumber", &Type::seasonNumber),
+            MakeField("seasonCount", &Type::seasonCount),
+            MakeField("episodeNumber", &Type::episodeNumber),
+            MakeField("episodeCount", &Type::episodeCount),
+            MakeField("releaseDate", &Type::releaseDate),
+            MakeField("contentRatings", &Type::contentRatings),
+            MakeField("waysToWatch", &Type::waysToWatch)
+        );
     };
 
 }
-}
@@ -30,458 +30,119 @@ namespace Entity {
 
     using JsonData_AdditionalEntityProgramType = WPEFramework::Core::JSON::EnumType<AdditionalEntityProgramType>;
 
-    class JsonData_MusicEntity: public WPEFramework::Core::JSON::Container {
-    public:
-        ~JsonData_MusicEntity() override = default;
-  
-    public:
-        JsonData_MusicEntity()
-            : WPEFramework::Core::JSON::Container()
-        {
-            Add(_T("entityType"), &EntityType);
-            Add(_T("musicType"), &MusicType);
-            Add(_T("entityId"), &EntityId);
-        }
-
-        JsonData_MusicEntity(const JsonData_MusicEntity& other)
-        {
-            Add(_T("entityType"), &EntityType);
-            EntityType = other.EntityType;
-            Add(_T("musicType"), &MusicType);
-            MusicType = other.MusicType;
-            Add(_T("entityId"), &EntityId);
-            EntityId = other.EntityId;
-        }
+    /* anyOf schema shape is not supported right now */
 
-        JsonData_MusicEntity& operator=(const JsonData_MusicEntity& other)
-        {
-            Add(_T("entityType"), &EntityType);
-            EntityType = other.EntityType;
-            Add(_T("musicType"), &MusicType);
-            MusicType = other.MusicType;
-            Add(_T("entityId"), &EntityId);
-            EntityId = other.EntityId;
-            return (*this);
-        }
+    /* anyOf schema shape is not supported right now */
+    /* anyOf schema shape is not supported right now */
+}
+}
 
-    public:
-        FireboltSDK::JSON::String EntityType;
-        Firebolt::Entertainment::JsonData_MusicType MusicType;
-        FireboltSDK::JSON::String EntityId;
+namespace FireboltSDK {
+
+    // Field tables, the wire names of the members
+    template <>
+    struct Reflect<Firebolt::Entity::MusicEntity> {
+        using Type = Firebolt::Entity::MusicEntity;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("entityType", &Type::entityType),
+            MakeField("musicType", &Type::musicType),
+            MakeField("entityId", &Type::entityId)
+        );
     };
 
-    class JsonData_TVEpisodeEntity: public WPEFramework::Core::JSON::Container {
-    public:
-        ~JsonData_TVEpisodeEntity() override = default;
-  
-    public:
-        JsonData_TVEpisodeEntity()
-            : WPEFramework::Core::JSON::Container()
-        {
-            Add(_T("entityType"), &EntityType);
-            Add(_T("programType"), &ProgramType);
-            Add(_T("entityId"), &EntityId);
-            Add(_T("seriesId"), &SeriesId);
-            Add(_T("seasonId"), &SeasonId);
-            Add(_T("assetId"), &AssetId);
-            Add(_T("appContentData"), &AppContentData);
-        }
-
-        JsonData_TVEpisodeEntity(const JsonData_TVEpisodeEntity& other)
-        {
-            Add(_T("entityType"), &EntityType);
-            EntityType = other.EntityType;
-            Add(_T("programType"), &ProgramType);
-            ProgramType = other.ProgramType;
-            Add(_T("entityId"), &EntityId);
-            EntityId = other.EntityId;
-            Add(_T("seriesId"), &SeriesId);
-            SeriesId = other.SeriesId;
-            Add(_T("seasonId"), &SeasonId);
-            SeasonId = other.SeasonId;
-            Add(_T("assetId"), &AssetId);
-            AssetId = other.AssetId;
-            Add(_T("appContentData"), &AppContentData);
-            AppContentData = other.AppContentData;
-        }
-
-        JsonData_TVEpisodeEntity& operator=(const JsonData_TVEpisodeEntity& other)
-        {
-            Add(_T("entityType"), &EntityType);
-            EntityType = other.EntityType;
-            Add(_T("programType"), &ProgramType);
-            ProgramType = other.ProgramType;
-            Add(_T("entityId"), &EntityId);
-            EntityId = other.EntityId;
-            Add(_T("seriesId"), &SeriesId);
-            SeriesId = other.SeriesId;
-            Add(_T("seasonId"), &SeasonId);
-            SeasonId = other.SeasonId;
-            Add(_T("assetId"), &AssetId);
-            AssetId = other.AssetId;
-            Add(_T("appContentData"), &AppContentData);
-            AppContentData = other.AppContentData;
-            return (*this);
-        }
-
-    public:
-        FireboltSDK::JSON::String EntityType;
-        FireboltSDK::JSON::String ProgramType;
-        FireboltSDK::JSON::String EntityId;
-        FireboltSDK::JSON::String SeriesId;
-        FireboltSDK::JSON::String SeasonId;
-        FireboltSDK::JSON::String AssetId;
-        FireboltSDK::JSON::String AppContentData;
+    template <>
+    struct Reflect<Firebolt::Entity::TVEpisodeEntity> {
+        using Type = Firebolt::Entity::TVEpisodeEntity;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("entityType", &Type::entityType),
+            MakeField("programType", &Type::programType),
+            MakeField("entityId", &Type::entityId),
+            MakeField("seriesId", &Type::seriesId),
+            MakeField("seasonId", &Type::seasonId),
+            MakeField("assetId", &Type::assetId),
+            MakeField("appContentData", &Type::appContentData)
+        );
     };
 
-    class JsonData_TVSeasonEntity: public WPEFramework::Core::JSON::Container {
-    public:
-        ~JsonData_TVSeasonEntity() override = default;
-  
-    public:
-        JsonData_TVSeasonEntity()
-            : WPEFramework::Core::JSON::Container()
-        {
-            Add(_T("entityType"), &EntityType);
-            Add(_T("programType"), &ProgramType);
-            Add(_T("entityId"), &EntityId);
-            Add(_T("seriesId"), &SeriesId);
-            Add(_T("assetId"), &AssetId);
-            Add(_T("appContentData"), &AppContentData);
-        }
-
-        JsonData_TVSeasonEntity(const JsonData_TVSeasonEntity& other)
-        {
-            Add(_T("entityType"), &EntityType);
-            EntityType = other.EntityType;
-            Add(_T("programType"), &ProgramType);
-            ProgramType = other.ProgramType;
-            Add(_T("entityId"), &EntityId);
-            EntityId = other.EntityId;
-            Add(_T("seriesId"), &SeriesId);
-            SeriesId = other.SeriesId;
-            Add(_T("assetId"), &AssetId);
-            AssetId = other.AssetId;
-            Add(_T("appContentData"), &AppContentData);
-            AppContentData = other.AppContentData;
-        }
-
-        JsonData_TVSeasonEntity& operator=(const JsonData_TVSeasonEntity& other)
-        {
-            Add(_T("entityType"), &EntityType);
-            EntityType = other.EntityType;
-            Add(_T("programType"), &ProgramType);
-            ProgramType = other.ProgramType;
-            Add(_T("entityId"), &EntityId);
-            EntityId = other.EntityId;
-            Add(_T("seriesId"), &SeriesId);
-            SeriesId = other.SeriesId;
-            Add(_T("assetId"), &AssetId);
-            AssetId = other.AssetId;
-            Add(_T("appContentData"), &AppContentData);
-            AppContentData = other.AppContentData;
-            return (*this);
-        }
-
-    public:
-        FireboltSDK::JSON::String EntityType;
-        FireboltSDK::JSON::String ProgramType;
-        FireboltSDK::JSON::String EntityId;
-        FireboltSDK::JSON::String SeriesId;
-        FireboltSDK::JSON::String AssetId;
-        FireboltSDK::JSON::String AppContentData;
+    template <>
+    struct Reflect<Firebolt::Entity::TVSeasonEntity> {
+        using Type = Firebolt::Entity::TVSeasonEntity;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("entityType", &Type::entityType),
+            MakeField("programType", &Type::programType),
+            MakeField("entityId", &Type::entityId),
+            MakeField("seriesId", &Type::seriesId),
+            MakeField("assetId", &Type::assetId),
+            MakeField("appContentData", &Type::appContentData)
+        );
     };
 
-    class JsonData_TVSeriesEntity: public WPEFramework::Core::JSON::Container {
-    public:
-        ~JsonData_TVSeriesEntity() override = default;
-  
-    public:
-        JsonData_TVSeriesEntity()
-            : WPEFramework::Core::JSON::Container()
-        {
-            Add(_T("entityType"), &EntityType);
-            Add(_T("programType"), &ProgramType);
-            Add(_T("entityId"), &EntityId);
-            Add(_T("assetId"), &AssetId);
-            Add(_T("appContentData"), &AppContentData);
-        }
-
-        JsonData_TVSeriesEntity(const JsonData_TVSeriesEntity& other)
-        {
-            Add(_T("entityType"), &EntityType);
-            EntityType = other.EntityType;
-            Add(_T("programType"), &ProgramType);
-            ProgramType = other.ProgramType;
-            Add(_T("entityId"), &EntityId);
-            EntityId = other.EntityId;
-            Add(_T("assetId"), &AssetId);
-            AssetId = other.AssetId;
-            Add(_T("appContentData"), &AppContentData);
-            AppContentData = other.AppContentData;
-        }
-
-        JsonData_TVSeriesEntity& operator=(const JsonData_TVSeriesEntity& other)
-        {
-            Add(_T("entityType"), &EntityType);
-            EntityType = other.EntityType;
-            Add(_T("programType"), &ProgramType);
-            ProgramType = other.ProgramType;
-            Add(_T("entityId"), &EntityId);
-            EntityId = other.EntityId;
-            Add(_T("assetId"), &AssetId);
-            AssetId = other.AssetId;
-            Add(_T("appContentData"), &AppContentData);
-            AppContentData = other.AppContentData;
-            return (*this);
-        }
-
-    public:
-        FireboltSDK::JSON::String EntityType;
-        FireboltSDK::JSON::String ProgramType;
-        FireboltSDK::JSON::String EntityId;
-        FireboltSDK::JSON::String AssetId;
-        FireboltSDK::JSON::String AppContentData;
+    template <>
+    struct Reflect<Firebolt::Entity::TVSeriesEntity> {
+        using Type = Firebolt::Entity::TVSeriesEntity;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("entityType", &Type::entityType),
+            MakeField("programType", &Type::programType),
+            MakeField("entityId", &Type::entityId),
+            MakeField("assetId", &Type::assetId),
+            MakeField("appContentData", &Type::appContentData)
+        );
     };
 
-    class JsonData_AdditionalEntity: public WPEFramework::Core::JSON::Container {
-    public:
-        ~JsonData_AdditionalEntity() override = default;
-  
-    public:
-        JsonData_AdditionalEntity()
-            : WPEFramework::Core::JSON::Container()
-        {
-            Add(_T("entityType"), &EntityType);
-            Add(_T("programType"), &ProgramType);
-            Add(_T("entityId"), &EntityId);
-            Add(_T("assetId"), &AssetId);
-            Add(_T("appContentData"), &AppContentData);
-        }
-
-        JsonData_AdditionalEntity(const JsonData_AdditionalEntity& other)
-        {
-            Add(_T("entityType"), &EntityType);
-            EntityType = other.EntityType;
-            Add(_T("programType"), &ProgramType);
-            ProgramType = other.ProgramType;
-            Add(_T("entityId"), &EntityId);
-            EntityId = other.EntityId;
-            Add(_T("assetId"), &AssetId);
-            AssetId = other.AssetId;
-            Add(_T("appContentData"), &AppContentData);
-            AppContentData = other.AppContentData;
-        }
-
-        JsonData_AdditionalEntity& operator=(const JsonData_AdditionalEntity& other)
-        {
-            Add(_T("entityType"), &EntityType);
-            EntityType = other.EntityType;
-            Add(_T("programType"), &ProgramType);
-            ProgramType = other.ProgramType;
-            Add(_T("entityId"), &EntityId);
-            EntityId = other.EntityId;
-            Add(_T("assetId"), &AssetId);
-            AssetId = other.AssetId;
-            Add(_T("appContentData"), &AppContentData);
-            AppContentData = other.AppContentData;
-            return (*this);
-        }
-
-    public:
-        FireboltSDK::JSON::String EntityType;
-        Firebolt::Entity::JsonData_AdditionalEntityProgramType ProgramType;
-        FireboltSDK::JSON::String EntityId;
-        FireboltSDK::JSON::String AssetId;
-        FireboltSDK::JSON::String AppContentData;
+    template <>
+    struct Reflect<Firebolt::Entity::AdditionalEntity> {
+        using Type = Firebolt::Entity::AdditionalEntity;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("entityType", &Type::entityType),
+            MakeField("programType", &Type::programType),
+            MakeField("entityId", &Type::entityId),
+            MakeField("assetId", &Type::assetId),
+            MakeField("appContentData", &Type::appContentData)
+        );
     };
 
-    class JsonData_PlaylistEntity: public WPEFramework::Core::JSON::Container {
-    public:
-        ~JsonData_PlaylistEntity() override = default;
-  
-    public:
-        JsonData_PlaylistEntity()
-            : WPEFramework::Core::JSON::Container()
-        {
-            Add(_T("entityType"), &EntityType);
-            Add(_T("entityId"), &EntityId);
-            Add(_T("assetId"), &AssetId);
-            Add(_T("appContentData"), &AppContentData);
-        }
-
-        JsonData_PlaylistEntity(const JsonData_PlaylistEntity& other)
-        {
-            Add(_T("entityType"), &EntityType);
-            EntityType = other.EntityType;
-            Add(_T("entityId"), &EntityId);
-            EntityId = other.EntityId;
-            Add(_T("assetId"), &AssetId);
-            AssetId = other.AssetId;
-            Add(_T("appContentData"), &AppContentData);
-            AppContentData = other.AppContentData;
-        }
-
-        JsonData_PlaylistEntity& operator=(const JsonData_PlaylistEntity& other)
-        {
-            Add(_T("entityType"), &EntityType);
-            EntityType = other.EntityType;
-            Add(_T("entityId"), &EntityId);
-            EntityId = other.EntityId;
-            Add(_T("assetId"), &AssetId);
-            AssetId = other.AssetId;
-            Add(_T("appContentData"), &AppContentData);
-            AppContentData = other.AppContentData;
-            return (*this);
-        }
-
-    public:
-        FireboltSDK::JSON::String EntityType;
-        FireboltSDK::JSON::String EntityId;
-        FireboltSDK::JSON::String AssetId;
-        FireboltSDK::JSON::String AppContentData;
+    template <>
+    struct Reflect<Firebolt::Entity::PlaylistEntity> {
+        using Type = Firebolt::Entity::PlaylistEntity;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("entityType", &Type::entityType),
+            MakeField("entityId", &Type::entityId),
+            MakeField("assetId", &Type::assetId),
+            MakeField("appContentData", &Type::appContentData)
+        );
     };
 
-    class JsonData_MovieEntity: public WPEFramework::Core::JSON::Container {
-    public:
-        ~JsonData_MovieEntity() override = default;
-  
-    public:
-        JsonData_MovieEntity()
-            : WPEFramework::Core::JSON::Container()
-        {
-            Add(_T("entityType"), &EntityType);
-            Add(_T("programType"), &ProgramType);
-            Add(_T("entityId"), &EntityId);
-            Add(_T("assetId"), &AssetId);
-            Add(_T("appContentData"), &AppContentData);
-        }
-
-        JsonData_MovieEntity(const JsonData_MovieEntity& other)
-        {
-            Add(_T("entityType"), &EntityType);
-            EntityType = other.EntityType;
-            Add(_T("programType"), &ProgramType);
-            ProgramType = other.ProgramType;
-            Add(_T("entityId"), &EntityId);
-            EntityId = other.EntityId;
-            Add(_T("assetId"), &AssetId);
-            AssetId = other.AssetId;
-            Add(_T("appContentData"), &AppContentData);
-            AppContentData = other.AppContentData;
-        }
-
-        JsonData_MovieEntity& operator=(const JsonData_MovieEntity& other)
-        {
-            Add(_T("entityType"), &EntityType);
-            EntityType = other.EntityType;
-            Add(_T("programType"), &ProgramType);
-            ProgramType = other.ProgramType;
-            Add(_T("entityId"), &EntityId);
-            EntityId = other.EntityId;
-            Add(_T("assetId"), &AssetId);
-            AssetId = other.AssetId;
-            Add(_T("appContentData"), &AppContentData);
-            AppContentData = other.AppContentData;
-            return (*this);
-        }
-
-    public:
-        FireboltSDK::JSON::String EntityType;
-        FireboltSDK::JSON::String ProgramType;
-        FireboltSDK::JSON::String EntityId;
-        FireboltSDK::JSON::String AssetId;
-        FireboltSDK::JSON::String AppContentData;
+    template <>
+    struct Reflect<Firebolt::Entity::MovieEntity> {
+        using Type = Firebolt::Entity::MovieEntity;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("entityType", &Type::entityType),
+            MakeField("programType", &Type::programType),
+            MakeField("entityId", &Type::entityId),
+            MakeField("assetId", &Type::assetId),
+            MakeField("appContentData", &Type::appContentData)
+        );
     };
 
-    /* anyOf schema shape is not supported right now */
-    class JsonData_UntypedEntity: public WPEFramework::Core::JSON::Container {
-    public:
-        ~JsonData_UntypedEntity() override = default;
-  
-    public:
-        JsonData_UntypedEntity()
-            : WPEFramework::Core::JSON::Container()
-        {
-            Add(_T("entityId"), &EntityId);
-            Add(_T("assetId"), &AssetId);
-            Add(_T("appContentData"), &AppContentData);
-        }
-
-        JsonData_UntypedEntity(const JsonData_UntypedEntity& other)
-        {
-            Add(_T("entityId"), &EntityId);
-            EntityId = other.EntityId;
-            Add(_T("assetId"), &AssetId);
-            AssetId = other.AssetId;
-            Add(_T("appContentData"), &AppContentData);
-            AppContentData = other.AppContentData;
-        }
-
-        JsonData_UntypedEntity& operator=(const JsonData_UntypedEntity& other)
-        {
-            Add(_T("entityId"), &EntityId);
-            EntityId = other.EntityId;
-            Add(_T("assetId"), &AssetId);
-            AssetId = other.AssetId;
-            Add(_T("appContentData"), &AppContentData);
-            AppContentData = other.AppContentData;
-            return (*this);
-        }
-
-    public:
-        FireboltSDK::JSON::String EntityId;
-        FireboltSDK::JSON::String AssetId;
-        FireboltSDK::JSON::String AppContentData;
+    template <>
+    struct Reflect<Firebolt::Entity::UntypedEntity> {
+        using Type = Firebolt::Entity::UntypedEntity;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("entityId", &Type::entityId),
+            MakeField("assetId", &Type::assetId),
+            MakeField("appContentData", &Type::appContentData)
+        );
     };
 
-    class JsonData_ChannelEntity: public WPEFramework::Core::JSON::Container {
-    public:
-        ~JsonData_ChannelEntity() override = default;
-  
-    public:
-        JsonData_ChannelEntity()
-            : WPEFramework::Core::JSON::Container()
-        {
-            Add(_T("entityType"), &EntityType);
-            Add(_T("channelType"), &ChannelType);
-            Add(_T("entityId"), &EntityId);
-            Add(_T("appContentData"), &AppContentData);
-        }
-
-        JsonData_ChannelEntity(const JsonData_ChannelEntity& other)
-        {
-            Add(_T("entityType"), &EntityType);
-            EntityType = other.EntityType;
-            Add(_T("channelType"), &ChannelType);
-            ChannelType = other.ChannelType;
-            Add(_T("entityId"), &EntityId);
-            EntityId = other.EntityId;
-            Add(_T("appContentData"), &AppContentData);
-            AppContentData = other.AppContentData;
-        }
-
-        JsonData_ChannelEntity& operator=(const JsonData_ChannelEntity& other)
-        {
-            Add(_T("entityType"), &EntityType);
-            EntityType = other.EntityType;
-            Add(_T("channelType"), &ChannelType);
-            ChannelType = other.ChannelType;
-            Add(_T("entityId"), &EntityId);
-            EntityId = other.EntityId;
-            Add(_T("appContentData"), &AppContentData);
-            AppContentData = other.AppContentData;
-            return (*this);
-        }
-
-    public:
-        FireboltSDK::JSON::String EntityType;
-        Firebolt::Entity::JsonData_ChannelEntityChannelType ChannelType;
-        FireboltSDK::JSON::String EntityId;
-        FireboltSDK::JSON::String AppContentData;
+    template <>
+    struct Reflect<Firebolt::Entity::ChannelEntity> {
+        using Type = Firebolt::Entity::ChannelEntity;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("entityType", &Type::entityType),
+            MakeField("channelType", &Type::channelType),
+            MakeField("entityId", &Type::entityId),
+            MakeField("appContentData", &Type::appContentData)
+        );
     };
 
-    /* anyOf schema shape is not supported right now */
-    /* anyOf schema shape is not supported right now */
-}
 }
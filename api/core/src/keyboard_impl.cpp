@@ -34,9 +34,7 @@ namespace Keyboard {
 
         if (proxyResponse.IsValid() == true) {
 
-            std::string email;
-            FireboltSDK::JSON::String jsonResult(proxyResponse->Value().c_str());
-            email = jsonResult.Value().c_str();
+            std::string email = proxyResponse->Value();
             proxyResponse.Release();
 
             IKeyboardAsyncResponse& notifier = *(reinterpret_cast<IKeyboardAsyncResponse*>(notification));
@@ -86,9 +84,7 @@ namespace Keyboard {
 
         if (proxyResponse.IsValid() == true) {
 
-            std::string value;
-            FireboltSDK::JSON::String jsonResult(proxyResponse->Value().c_str());
-            value = jsonResult.Value().c_str();
+            std::string value = proxyResponse->Value();
             proxyResponse.Release();
 
             IKeyboardAsyncResponse& notifier = *(reinterpret_cast<IKeyboardAsyncResponse*>(notification));
@@ -135,9 +131,7 @@ namespace Keyboard {
 
         if (proxyResponse.IsValid() == true) {
 
-            std::string value;
-            FireboltSDK::JSON::String jsonResult(proxyResponse->Value().c_str());
-            value = jsonResult.Value().c_str();
+            std::string value = proxyResponse->Value();
             proxyResponse.Release();
 
             IKeyboardAsyncResponse& notifier = *(reinterpret_cast<IKeyboardAsyncResponse*>(notification));
@@ -59,13 +59,10 @@ namespace Localization {
         const string method = _T("localization.countryCode");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string code;
+        FireboltSDK::Decoded<std::string> jsonResult(code);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            code = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -79,13 +76,10 @@ namespace Localization {
         const string method = _T("localization.language");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string lang;
+        FireboltSDK::Decoded<std::string> jsonResult(lang);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            lang = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -126,13 +120,10 @@ namespace Localization {
         const string method = _T("localization.locale");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string locale;
+        FireboltSDK::Decoded<std::string> jsonResult(locale);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            locale = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -146,13 +137,10 @@ namespace Localization {
         const string method = _T("localization.locality");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string locality;
+        FireboltSDK::Decoded<std::string> jsonResult(locality);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            locality = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -166,13 +154,10 @@ namespace Localization {
         const string method = _T("localization.postalCode");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string postalCode;
+        FireboltSDK::Decoded<std::string> jsonResult(postalCode);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            postalCode = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -182,25 +167,25 @@ namespace Localization {
 
     /* preferredAudioLanguages - A prioritized list of ISO 639 1/2 codes for the preferred audio languages on this device. */
     std::vector<std::string> LocalizationImpl::preferredAudioLanguages( Firebolt::Error *err ) const
+    {
+        std::vector<std::string> languages;
+        preferredAudioLanguages(languages, err);
+        return languages;
+    }
+    void LocalizationImpl::preferredAudioLanguages( std::vector<std::string>& languages, Firebolt::Error *err ) const
     {
         const string method = _T("localization.preferredAudioLanguages");
         
         
-        WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> jsonResult;
-        std::vector<std::string> languages;
+        FireboltSDK::Decoded<std::vector<std::string>> jsonResult(languages);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            auto index(jsonResult.Elements());
-            while (index.Next() == true) {
-                languages.push_back(index.Current().Value());
-            }
+        if (status != Firebolt::Error::None) {
+            languages.clear();
         }
         if (err != nullptr) {
             *err = status;
         }
-
-        return languages;
     }
 
 
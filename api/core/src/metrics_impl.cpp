@@ -95,27 +95,14 @@ namespace Metrics {
         Firebolt::Error status = Firebolt::Error::NotConnected;
         bool success = false;
 
-        JsonObject jsonParameters;
-        JsonData_Category jsonCategory = category;
-            WPEFramework::Core::JSON::Variant categoryVariant(jsonCategory.Data());
-            jsonParameters.Set(_T("category"), categoryVariant);
-            WPEFramework::Core::JSON::Variant typeVariant(type);
-            jsonParameters.Set(_T("type"), typeVariant);
-            Firebolt::Types::FlatMap map;
-            if (parameters.has_value()) {
-                map = parameters.value();
-            }
-            WPEFramework::Core::JSON::Variant parametersVariant;
-            for (auto element: map) {
-                WPEFramework::Core::JSON::Variant jsonElement = element.second;
-                WPEFramework::Core::JSON::VariantContainer jsonContainer;
-                jsonContainer.Set(element.first.c_str(), jsonElement);
-                parametersVariant = jsonContainer;
-            }
-            jsonParameters.Set(_T("parameters"), parametersVariant);
+        FireboltSDK::Arena arena;
+        FireboltSDK::JsonWriter jsonParameters;
+            jsonParameters.Add(_T("category"), category);
+            jsonParameters.Add(_T("type"), type);
+            jsonParameters.Add(_T("parameters"), parameters);
     
         WPEFramework::Core::JSON::Boolean jsonResult;
-        status = FireboltSDK::Gateway::Instance().Request("metrics.action", jsonParameters, jsonResult);
+        status = FireboltSDK::Gateway::Instance().Request("metrics.action", jsonParameters.Finish(), jsonResult);
         if (status == Firebolt::Error::None) {
             FIREBOLT_LOG_INFO(FireboltSDK::Logger::Category::OpenRPC, FireboltSDK::Logger::Module<FireboltSDK::Accessor>(), "Metrics.action is successfully invoked");
             success = jsonResult.Value();
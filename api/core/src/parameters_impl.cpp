@@ -67,7 +67,7 @@ namespace Parameters {
                         }
                     }
                 }
-                init = initResult;
+                init = std::move(initResult);
         }
 
         if (err != nullptr) {
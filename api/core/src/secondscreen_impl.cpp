@@ -35,11 +35,10 @@ namespace SecondScreen {
                 WPEFramework::Core::JSON::Variant typeVariant(type.value());
                 jsonParameters.Set(_T("type"), typeVariant);
             }
-        FireboltSDK::JSON::String jsonResult;
+        FireboltSDK::Decoded<std::string> jsonResult(deviceId);
         status = FireboltSDK::Gateway::Instance().Request("secondscreen.device", jsonParameters, jsonResult);
         if (status == Firebolt::Error::None) {
             FIREBOLT_LOG_INFO(FireboltSDK::Logger::Category::OpenRPC, FireboltSDK::Logger::Module<FireboltSDK::Accessor>(), "SecondScreen.device is successfully invoked");
-            deviceId = jsonResult.Value().c_str();
         }
 
         if (err != nullptr) {
@@ -55,13 +54,10 @@ namespace SecondScreen {
         const string method = _T("secondscreen.friendlyName");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string friendlyName;
+        FireboltSDK::Decoded<std::string> jsonResult(friendlyName);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            friendlyName = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -21,6 +21,7 @@
 #include <functional>
 #include "types.h"
 #include "error.h"
+#include "dispatcher.h"
 #include "content.h"
 
 
@@ -48,7 +49,8 @@ struct IFireboltAccessor {
      *     "logLevel": "Info",
      *     "workerPool":{
      *       "queueSize": 8,
-     *       "threadCount": 3
+     *       "threadCount": 3,
+     *       "executor": "pool"
      *      },
      *     "wsUrl": "ws://127.0.0.1:9998"
      *  }
@@ -154,6 +156,37 @@ struct IFireboltAccessor {
     virtual Content::IContent& ContentInterface() const = 0;
 
 
+    // New methods go last, existing binaries keep the layout of the interface
+
+    /**
+     * @brief Register a dispatcher for the event notifications, they are then handed to it in batches instead
+     * of being called on an SDK thread.
+     *
+     * @param dispatcher IDispatcher posting to the thread of choice. Passing a nullptr will unregister.
+     * It has to stay valid until it is unregistered.
+     *
+     * @return None
+    */
+    virtual void Dispatcher(IDispatcher* dispatcher) = 0;
+
+    /**
+     * @brief Descriptor to watch when the SDK is run by the application, "executor": "caller" in the workerPool
+     * configuration. It turns readable whenever responses, events or timeouts are waiting for Process().
+     *
+     * @return int -1 if the SDK runs its own threads
+    */
+    virtual int Descriptor ( ) const = 0;
+
+    /**
+     * @brief Runs the callbacks and timeouts that are due, on the calling thread. Waits up to timeout ms for
+     * one if there is none yet.
+     *
+     * @param timeout Time to wait in ms, 0 to return right away.
+     *
+     * @return Firebolt::Error General if the SDK runs its own threads
+    */
+    virtual Firebolt::Error Process ( const uint32_t timeout ) = 0;
+
 };
 
 }
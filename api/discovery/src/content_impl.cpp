@@ -76,7 +76,7 @@ namespace Content {
                         auto index(jsonResult.Entity.Info.ContentRatings.Elements());
                         while (index.Next() == true) {
                             Entertainment::ContentRating contentRatingsResult1;
-                            Firebolt::Entertainment::JsonData_ContentRating jsonResult = index.Current();
+                            const Firebolt::Entertainment::JsonData_ContentRating& jsonResult = index.Current();
                             {
                                 contentRatingsResult1.scheme = jsonResult.Scheme;
                                 contentRatingsResult1.rating = jsonResult.Rating;
@@ -88,7 +88,7 @@ namespace Content {
                                     }
                                 }
                             }
-                            interestResult.entity.info.value().contentRatings->push_back(contentRatingsResult1);
+                            interestResult.entity.info.value().contentRatings->push_back(std::move(contentRatingsResult1));
                         }
                     }
                 }
@@ -97,7 +97,7 @@ namespace Content {
                     auto index(jsonResult.Entity.WaysToWatch.Elements());
                     while (index.Next() == true) {
                         Entertainment::WayToWatch waysToWatchResult1;
-                        Firebolt::Entertainment::JsonData_WayToWatch jsonResult = index.Current();
+                        const Firebolt::Entertainment::JsonData_WayToWatch& jsonResult = index.Current();
                         {
                             {
                                 if (jsonResult.Identifiers.AssetId.IsSet()) {
@@ -174,11 +174,11 @@ namespace Content {
                                 }
                             }
                         }
-                        interestResult.entity.waysToWatch->push_back(waysToWatchResult1);
+                        interestResult.entity.waysToWatch->push_back(std::move(waysToWatchResult1));
                     }
                 }
             }
-            interest = interestResult;
+            interest = std::move(interestResult);
         }
 
         if (err != nullptr) {
@@ -235,7 +235,7 @@ namespace Content {
                         auto index((*proxyResponse).Entity.Info.ContentRatings.Elements());
                         while (index.Next() == true) {
                             Entertainment::ContentRating contentRatingsResult1;
-                            Firebolt::Entertainment::JsonData_ContentRating jsonResult = index.Current();
+                            const Firebolt::Entertainment::JsonData_ContentRating& jsonResult = index.Current();
                                 contentRatingsResult1.scheme = jsonResult.Scheme;
                                 contentRatingsResult1.rating = jsonResult.Rating;
                                 if (jsonResult.Advisories.IsSet()) {
@@ -245,7 +245,7 @@ namespace Content {
                                         contentRatingsResult1.advisories.value().push_back(index.Current().Value());
                                     }
                                 }
-                            interest.entity.info.value().contentRatings.value().push_back(contentRatingsResult1);
+                            interest.entity.info.value().contentRatings.value().push_back(std::move(contentRatingsResult1));
                         }
                     }
                 }
@@ -254,7 +254,7 @@ namespace Content {
                     auto index((*proxyResponse).Entity.WaysToWatch.Elements());
                     while (index.Next() == true) {
                         Entertainment::WayToWatch waysToWatchResult1;
-                        Firebolt::Entertainment::JsonData_WayToWatch jsonResult = index.Current();
+                        const Firebolt::Entertainment::JsonData_WayToWatch& jsonResult = index.Current();
                             {
                                 if (jsonResult.Identifiers.AssetId.IsSet()) {
                                     waysToWatchResult1.identifiers.assetId = jsonResult.Identifiers.AssetId;
@@ -329,7 +329,7 @@ namespace Content {
                                     waysToWatchResult1.audioDescriptions.value().push_back(index.Current().Value());
                                 }
                             }
-                        interest.entity.waysToWatch.value().push_back(waysToWatchResult1);
+                        interest.entity.waysToWatch.value().push_back(std::move(waysToWatchResult1));
                     }
                 }
             }
@@ -198,6 +198,9 @@ struct IHDMIInput {
      */
     virtual void setLowLatencyMode( const bool value, Firebolt::Error *err = nullptr ) = 0;
 
+    // New methods go last, existing binaries keep the layout of the interface
+    // ports(), into a list the caller keeps across calls: its elements are decoded over, not allocated again
+    virtual void ports( std::vector<HDMIInputPort>& ports, Firebolt::Error *err = nullptr ) const = 0;
 };
 
 } //namespace HDMIInput
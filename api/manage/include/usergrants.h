@@ -114,6 +114,14 @@ struct IUserGrants {
      
      */
     virtual std::vector<GrantInfo> request( const std::string& appId, const std::vector<Capabilities::Permission>& permissions, const std::optional<RequestOptions>& options, Firebolt::Error *err = nullptr ) = 0;
+
+    // New methods go last, existing binaries keep the layout of the interface
+    // app(), into a list the caller keeps across calls: its elements are decoded over, not allocated again
+    virtual void app( const std::string& appId, std::vector<GrantInfo>& info, Firebolt::Error *err = nullptr ) = 0;
+    // capability(), into a list the caller keeps across calls: its elements are decoded over, not allocated again
+    virtual void capability( const std::string& capability, std::vector<GrantInfo>& info, Firebolt::Error *err = nullptr ) = 0;
+    // device(), into a list the caller keeps across calls: its elements are decoded over, not allocated again
+    virtual void device( std::vector<GrantInfo>& info, Firebolt::Error *err = nullptr ) const = 0;
 };
 
 } //namespace UserGrants
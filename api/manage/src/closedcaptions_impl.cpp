@@ -30,13 +30,10 @@ namespace ClosedCaptions {
         const string method = _T("closedcaptions.backgroundColor");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string color;
+        FireboltSDK::Decoded<std::string> jsonResult(color);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            color = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -138,13 +135,10 @@ namespace ClosedCaptions {
         const string method = _T("closedcaptions.fontColor");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string color;
+        FireboltSDK::Decoded<std::string> jsonResult(color);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            color = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -211,13 +205,10 @@ namespace ClosedCaptions {
         const string method = _T("closedcaptions.fontEdgeColor");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string color;
+        FireboltSDK::Decoded<std::string> jsonResult(color);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            color = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -400,13 +391,10 @@ namespace ClosedCaptions {
         const string method = _T("closedcaptions.textAlign");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string alignment;
+        FireboltSDK::Decoded<std::string> jsonResult(alignment);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            alignment = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -436,13 +424,10 @@ namespace ClosedCaptions {
         const string method = _T("closedcaptions.textAlignVertical");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string alignment;
+        FireboltSDK::Decoded<std::string> jsonResult(alignment);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            alignment = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -472,13 +457,10 @@ namespace ClosedCaptions {
         const string method = _T("closedcaptions.windowColor");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string color;
+        FireboltSDK::Decoded<std::string> jsonResult(color);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            color = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -30,13 +30,10 @@ namespace Device {
         const string method = _T("device.name");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string value;
+        FireboltSDK::Decoded<std::string> jsonResult(value);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            value = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -130,6 +130,21 @@ namespace Firebolt {
         {
         }
 
+        void Dispatcher(IDispatcher* dispatcher) override
+        {
+            _accessor->Dispatcher(dispatcher);
+        }
+
+        int Descriptor() const override
+        {
+            return _accessor->Descriptor();
+        }
+
+        Firebolt::Error Process(const uint32_t timeout) override
+        {
+            return _accessor->Process(timeout);
+        }
+
         Localization::ILocalization& LocalizationInterface() const override
         {
             auto module = _moduleMap.find("Localization");
@@ -206,7 +206,7 @@ namespace HDMIInput {
                 portResult.edidVersion = jsonResult.EdidVersion.Value();
                 portResult.autoLowLatencyModeCapable = jsonResult.AutoLowLatencyModeCapable.Value();
                 portResult.autoLowLatencyModeSignalled = jsonResult.AutoLowLatencyModeSignalled.Value();
-                port = portResult;
+                port = std::move(portResult);
         }
 
         if (err != nullptr) {
@@ -217,38 +217,29 @@ namespace HDMIInput {
     }
 
     /* ports - Retrieve a list of HDMI input ports. */
-    std::vector<HDMIInputPort> HDMIInputImpl::ports( Firebolt::Error *err )  const
+    std::vector<HDMIInputPort> HDMIInputImpl::ports( Firebolt::Error *err ) const
     {
-        Firebolt::Error status = Firebolt::Error::NotConnected;
         std::vector<HDMIInputPort> ports;
+        this->ports(ports, err);
+        return ports;
+    }
+    void HDMIInputImpl::ports( std::vector<HDMIInputPort>& ports, Firebolt::Error *err ) const
+    {
+        Firebolt::Error status = Firebolt::Error::NotConnected;
 
         JsonObject jsonParameters;
 
-        WPEFramework::Core::JSON::ArrayType<Firebolt::HDMIInput::JsonData_HDMIInputPort> jsonResult;
+        FireboltSDK::Decoded<std::vector<HDMIInputPort>> jsonResult(ports);
         status = FireboltSDK::Gateway::Instance().Request("hdmiinput.ports", jsonParameters, jsonResult);
         if (status == Firebolt::Error::None) {
             FIREBOLT_LOG_INFO(FireboltSDK::Logger::Category::OpenRPC, FireboltSDK::Logger::Module<FireboltSDK::Accessor>(), "HDMIInput.ports is successfully invoked");
-            auto index(jsonResult.Elements());
-                while (index.Next() == true) {
-                    HDMIInputPort portsResult1;
-                    JsonData_HDMIInputPort jsonResult = index.Current();
-                    portsResult1.port = jsonResult.Port.Value();
-                    portsResult1.connected = jsonResult.Connected.Value();
-                    portsResult1.signal = jsonResult.Signal.Value();
-                    portsResult1.arcCapable = jsonResult.ArcCapable.Value();
-                    portsResult1.arcConnected = jsonResult.ArcConnected.Value();
-                    portsResult1.edidVersion = jsonResult.EdidVersion.Value();
-                    portsResult1.autoLowLatencyModeCapable = jsonResult.AutoLowLatencyModeCapable.Value();
-                    portsResult1.autoLowLatencyModeSignalled = jsonResult.AutoLowLatencyModeSignalled.Value();
-                    ports.push_back(portsResult1);
-                }
+        } else {
+            ports.clear();
         }
 
         if (err != nullptr) {
             *err = status;
         }
-
-        return ports;
     }
 
 
@@ -321,6 +321,7 @@ namespace HDMIInput {
          Retrieve a list of HDMI input ports.
          */
         std::vector<HDMIInputPort> ports( Firebolt::Error *err = nullptr ) const override;
+        void ports( std::vector<HDMIInputPort>& ports, Firebolt::Error *err = nullptr ) const override;
 
         /*
          * setAutoLowLatencyModeCapable
@@ -344,3 +345,23 @@ namespace HDMIInput {
 
 }//namespace HDMIInput
 }
+
+namespace FireboltSDK {
+
+    // Field tables, the wire names of the members
+    template <>
+    struct Reflect<Firebolt::HDMIInput::HDMIInputPort> {
+        using Type = Firebolt::HDMIInput::HDMIInputPort;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("port", &Type::port),
+            MakeField("connected", &Type::connected),
+            MakeField("signal", &Type::signal),
+            MakeField("arcCapable", &Type::arcCapable),
+            MakeField("arcConnected", &Type::arcConnected),
+            MakeField("edidVersion", &Type::edidVersion),
+            MakeField("autoLowLatencyModeCapable", &Type::autoLowLatencyModeCapable),
+            MakeField("autoLowLatencyModeSignalled", &Type::autoLowLatencyModeSignalled)
+        );
+    };
+
+}
@@ -84,13 +84,10 @@ namespace Localization {
         const string method = _T("localization.countryCode");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string code;
+        FireboltSDK::Decoded<std::string> jsonResult(code);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            code = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -120,13 +117,10 @@ namespace Localization {
         const string method = _T("localization.language");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string lang;
+        FireboltSDK::Decoded<std::string> jsonResult(lang);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            lang = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -156,13 +150,10 @@ namespace Localization {
         const string method = _T("localization.locale");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string locale;
+        FireboltSDK::Decoded<std::string> jsonResult(locale);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            locale = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -192,13 +183,10 @@ namespace Localization {
         const string method = _T("localization.locality");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string locality;
+        FireboltSDK::Decoded<std::string> jsonResult(locality);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            locality = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -228,13 +216,10 @@ namespace Localization {
         const string method = _T("localization.postalCode");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string postalCode;
+        FireboltSDK::Decoded<std::string> jsonResult(postalCode);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            postalCode = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
@@ -260,25 +245,25 @@ namespace Localization {
 
     /* preferredAudioLanguages - A prioritized list of ISO 639 1/2 codes for the preferred audio languages on this device. */
     std::vector<std::string> LocalizationImpl::preferredAudioLanguages( Firebolt::Error *err ) const
+    {
+        std::vector<std::string> languages;
+        preferredAudioLanguages(languages, err);
+        return languages;
+    }
+    void LocalizationImpl::preferredAudioLanguages( std::vector<std::string>& languages, Firebolt::Error *err ) const
     {
         const string method = _T("localization.preferredAudioLanguages");
         
         
-        WPEFramework::Core::JSON::ArrayType<FireboltSDK::JSON::String> jsonResult;
-        std::vector<std::string> languages;
+        FireboltSDK::Decoded<std::vector<std::string>> jsonResult(languages);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            auto index(jsonResult.Elements());
-            while (index.Next() == true) {
-                languages.push_back(index.Current().Value());
-            }
+        if (status != Firebolt::Error::None) {
+            languages.clear();
         }
         if (err != nullptr) {
             *err = status;
         }
-
-        return languages;
     }
     /* setPreferredAudioLanguages - A prioritized list of ISO 639 1/2 codes for the preferred audio languages on this device. */
     void LocalizationImpl::setPreferredAudioLanguages( const std::vector<std::string>& value, Firebolt::Error *err )
@@ -331,13 +316,10 @@ namespace Localization {
         const string method = _T("localization.timeZone");
         
         
-        FireboltSDK::JSON::String jsonResult;
         std::string result;
+        FireboltSDK::Decoded<std::string> jsonResult(result);
         
         Firebolt::Error status = FireboltSDK::Properties::Get(method, jsonResult);
-        if (status == Firebolt::Error::None) {
-            result = jsonResult.Value().c_str();
-        }
         if (err != nullptr) {
             *err = status;
         }
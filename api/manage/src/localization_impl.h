@@ -118,6 +118,7 @@ namespace Localization {
          * 
          */
         std::vector<std::string> preferredAudioLanguages( Firebolt::Error *err = nullptr ) const override;
+        void preferredAudioLanguages( std::vector<std::string>& languages, Firebolt::Error *err = nullptr ) const override;
         /*
          removeAdditionalInfo
          Remove any platform-specific localization information from map
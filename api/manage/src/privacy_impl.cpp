@@ -481,7 +481,7 @@ namespace Privacy {
                 settingsResult.allowUnentitledPersonalization = jsonResult.AllowUnentitledPersonalization.Value();
                 settingsResult.allowUnentitledResumePoints = jsonResult.AllowUnentitledResumePoints.Value();
                 settingsResult.allowWatchHistory = jsonResult.AllowWatchHistory.Value();
-                settings = settingsResult;
+                settings = std::move(settingsResult);
         }
 
         if (err != nullptr) {
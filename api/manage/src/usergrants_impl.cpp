@@ -25,87 +25,57 @@ namespace UserGrants {
 
     // Methods
     /* app - Get all granted and denied user grants for the given app */
-    std::vector<GrantInfo> UserGrantsImpl::app( const std::string& appId, Firebolt::Error *err ) 
+    std::vector<GrantInfo> UserGrantsImpl::app( const std::string& appId, Firebolt::Error *err )
     {
-        Firebolt::Error status = Firebolt::Error::NotConnected;
         std::vector<GrantInfo> info;
+        app(appId, info, err);
+        return info;
+    }
+    void UserGrantsImpl::app( const std::string& appId, std::vector<GrantInfo>& info, Firebolt::Error *err )
+    {
+        Firebolt::Error status = Firebolt::Error::NotConnected;
 
         JsonObject jsonParameters;
         WPEFramework::Core::JSON::Variant appIdVariant(appId);
             jsonParameters.Set(_T("appId"), appIdVariant);
-        WPEFramework::Core::JSON::ArrayType<Firebolt::UserGrants::JsonData_GrantInfo> jsonResult;
+        FireboltSDK::Decoded<std::vector<GrantInfo>> jsonResult(info);
         status = FireboltSDK::Gateway::Instance().Request("usergrants.app", jsonParameters, jsonResult);
         if (status == Firebolt::Error::None) {
             FIREBOLT_LOG_INFO(FireboltSDK::Logger::Category::OpenRPC, FireboltSDK::Logger::Module<FireboltSDK::Accessor>(), "UserGrants.app is successfully invoked");
-            auto index(jsonResult.Elements());
-                while (index.Next() == true) {
-                    GrantInfo infoResult1;
-                    JsonData_GrantInfo jsonResult = index.Current();
-                    if (jsonResult.App.IsSet()) {
-                        infoResult1.app = std::make_optional<AppInfo>();
-                      infoResult1.app.value().id = jsonResult.App.Id;
-                      if (jsonResult.App.Title.IsSet()) {
-                            infoResult1.app.value().title = jsonResult.App.Title;
-                        }
-                    }
-                    infoResult1.state = jsonResult.State.Value();
-                    infoResult1.capability = jsonResult.Capability.Value();
-                    infoResult1.role = jsonResult.Role.Value();
-                    infoResult1.lifespan = jsonResult.Lifespan.Value();
-                    if (jsonResult.Expires.IsSet()) {
-                        infoResult1.expires = jsonResult.Expires.Value();
-                    }
-                    info.push_back(infoResult1);
-                }
+        } else {
+            info.clear();
         }
 
         if (err != nullptr) {
             *err = status;
         }
-
-        return info;
     }
 
     /* capability - Get all granted and denied user grants for the given capability */
-    std::vector<GrantInfo> UserGrantsImpl::capability( const std::string& capability, Firebolt::Error *err ) 
+    std::vector<GrantInfo> UserGrantsImpl::capability( const std::string& capability, Firebolt::Error *err )
     {
-        Firebolt::Error status = Firebolt::Error::NotConnected;
         std::vector<GrantInfo> info;
+        this->capability(capability, info, err);
+        return info;
+    }
+    void UserGrantsImpl::capability( const std::string& capability, std::vector<GrantInfo>& info, Firebolt::Error *err )
+    {
+        Firebolt::Error status = Firebolt::Error::NotConnected;
 
         JsonObject jsonParameters;
         WPEFramework::Core::JSON::Variant capabilityVariant(capability);
             jsonParameters.Set(_T("capability"), capabilityVariant);
-        WPEFramework::Core::JSON::ArrayType<Firebolt::UserGrants::JsonData_GrantInfo> jsonResult;
+        FireboltSDK::Decoded<std::vector<GrantInfo>> jsonResult(info);
         status = FireboltSDK::Gateway::Instance().Request("usergrants.capability", jsonParameters, jsonResult);
         if (status == Firebolt::Error::None) {
             FIREBOLT_LOG_INFO(FireboltSDK::Logger::Category::OpenRPC, FireboltSDK::Logger::Module<FireboltSDK::Accessor>(), "UserGrants.capability is successfully invoked");
-            auto index(jsonResult.Elements());
-                while (index.Next() == true) {
-                    GrantInfo infoResult1;
-                    JsonData_GrantInfo jsonResult = index.Current();
-                    if (jsonResult.App.IsSet()) {
-                        infoResult1.app = std::make_optional<AppInfo>();
-                      infoResult1.app.value().id = jsonResult.App.Id;
-                      if (jsonResult.App.Title.IsSet()) {
-                            infoResult1.app.value().title = jsonResult.App.Title;
-                        }
-                    }
-                    infoResult1.state = jsonResult.State.Value();
-                    infoResult1.capability = jsonResult.Capability.Value();
-                    infoResult1.role = jsonResult.Role.Value();
-                    infoResult1.lifespan = jsonResult.Lifespan.Value();
-                    if (jsonResult.Expires.IsSet()) {
-                        infoResult1.expires = jsonResult.Expires.Value();
-                    }
-                    info.push_back(infoResult1);
-                }
+        } else {
+            info.clear();
         }
 
         if (err != nullptr) {
             *err = status;
         }
-
-        return info;
     }
 
     /* clear - Clears the grant for a given capability, to a specific app if appropriate. Calling this results in a persisted Denied Grant that lasts for the duration of the Grant Policy lifespan.  */
@@ -185,44 +155,29 @@ namespace UserGrants {
     }
 
     /* device - Get all granted and denied user grants for the device */
-    std::vector<GrantInfo> UserGrantsImpl::device( Firebolt::Error *err )  const
+    std::vector<GrantInfo> UserGrantsImpl::device( Firebolt::Error *err ) const
     {
-        Firebolt::Error status = Firebolt::Error::NotConnected;
         std::vector<GrantInfo> info;
+        device(info, err);
+        return info;
+    }
+    void UserGrantsImpl::device( std::vector<GrantInfo>& info, Firebolt::Error *err ) const
+    {
+        Firebolt::Error status = Firebolt::Error::NotConnected;
 
         JsonObject jsonParameters;
 
-        WPEFramework::Core::JSON::ArrayType<Firebolt::UserGrants::JsonData_GrantInfo> jsonResult;
+        FireboltSDK::Decoded<std::vector<GrantInfo>> jsonResult(info);
         status = FireboltSDK::Gateway::Instance().Request("usergrants.device", jsonParameters, jsonResult);
         if (status == Firebolt::Error::None) {
             FIREBOLT_LOG_INFO(FireboltSDK::Logger::Category::OpenRPC, FireboltSDK::Logger::Module<FireboltSDK::Accessor>(), "UserGrants.device is successfully invoked");
-            auto index(jsonResult.Elements());
-                while (index.Next() == true) {
-                    GrantInfo infoResult1;
-                    JsonData_GrantInfo jsonResult = index.Current();
-                    if (jsonResult.App.IsSet()) {
-                        infoResult1.app = std::make_optional<AppInfo>();
-                      infoResult1.app.value().id = jsonResult.App.Id;
-                      if (jsonResult.App.Title.IsSet()) {
-                            infoResult1.app.value().title = jsonResult.App.Title;
-                        }
-                    }
-                    infoResult1.state = jsonResult.State.Value();
-                    infoResult1.capability = jsonResult.Capability.Value();
-                    infoResult1.role = jsonResult.Role.Value();
-                    infoResult1.lifespan = jsonResult.Lifespan.Value();
-                    if (jsonResult.Expires.IsSet()) {
-                        infoResult1.expires = jsonResult.Expires.Value();
-                    }
-                    info.push_back(infoResult1);
-                }
+        } else {
+            info.clear();
         }
 
         if (err != nullptr) {
             *err = status;
         }
-
-        return info;
     }
 
     /* grant - Grants a given capability to a specific app, if appropriate. Calling this results in a persisted active grant that lasts for the duration of the grant policy lifespan.  */
@@ -269,63 +224,28 @@ namespace UserGrants {
         Firebolt::Error status = Firebolt::Error::NotConnected;
         std::vector<GrantInfo> info;
 
-        JsonObject jsonParameters;
-        WPEFramework::Core::JSON::Variant appIdVariant(appId);
-            jsonParameters.Set(_T("appId"), appIdVariant);
-            WPEFramework::Core::JSON::ArrayType<WPEFramework::Core::JSON::Variant> permissionsArray;
+        FireboltSDK::Arena arena;
+        FireboltSDK::JsonWriter jsonParameters;
+            jsonParameters.Add(_T("appId"), appId);
+            jsonParameters.BeginArray(_T("permissions"));
             for (auto& element : permissions) {
-                Firebolt::Capabilities::JsonData_Permission permissionsContainer;
-                {
-                        if (element.role.has_value()) {
-                            permissionsContainer.Role = element.role.value();
-                        }
-                        permissionsContainer.Capability = element.capability;
-                }
-                string permissionsStr;
-                permissionsContainer.ToString(permissionsStr);
-                WPEFramework::Core::JSON::VariantContainer permissionsVariantContainer(permissionsStr);
-                WPEFramework::Core::JSON::Variant permissionsVariant = permissionsVariantContainer;
-                permissionsArray.Add() = permissionsVariant;
+                jsonParameters.BeginObject();
+                    jsonParameters.Add(_T("role"), element.role);
+                    jsonParameters.Add(_T("capability"), element.capability);
+                jsonParameters.EndObject();
             }
-            WPEFramework::Core::JSON::Variant permissionsVariant;
-            permissionsVariant.Array(permissionsArray);
-            jsonParameters.Set(_T("permissions"), permissionsVariant);
+            jsonParameters.EndArray();
             if (options.has_value()) {
-                auto element = options.value();
-                JsonData_RequestOptions optionsContainer;
-                if (element.force.has_value()) {
-                    optionsContainer.Force = element.force.value();
-                }
-                string optionsStr;
-                optionsContainer.ToString(optionsStr);
-                WPEFramework::Core::JSON::VariantContainer optionsVariantContainer(optionsStr);
-                WPEFramework::Core::JSON::Variant optionsVariant = optionsVariantContainer;
-                jsonParameters.Set(_T("options"), optionsVariant);
+                jsonParameters.BeginObject(_T("options"));
+                    jsonParameters.Add(_T("force"), options.value().force);
+                jsonParameters.EndObject();
             }
-        WPEFramework::Core::JSON::ArrayType<Firebolt::UserGrants::JsonData_GrantInfo> jsonResult;
-        status = FireboltSDK::Gateway::Instance().Request("usergrants.request", jsonParameters, jsonResult);
+        FireboltSDK::Decoded<std::vector<GrantInfo>> jsonResult(info);
+        status = FireboltSDK::Gateway::Instance().Request("usergrants.request", jsonParameters.Finish(), jsonResult);
         if (status == Firebolt::Error::None) {
             FIREBOLT_LOG_INFO(FireboltSDK::Logger::Category::OpenRPC, FireboltSDK::Logger::Module<FireboltSDK::Accessor>(), "UserGrants.request is successfully invoked");
-            auto index(jsonResult.Elements());
-                while (index.Next() == true) {
-                    GrantInfo infoResult1;
-                    JsonData_GrantInfo jsonResult = index.Current();
-                    if (jsonResult.App.IsSet()) {
-                        infoResult1.app = std::make_optional<AppInfo>();
-                      infoResult1.app.value().id = jsonResult.App.Id;
-                      if (jsonResult.App.Title.IsSet()) {
-                            infoResult1.app.value().title = jsonResult.App.Title;
-                        }
-                    }
-                    infoResult1.state = jsonResult.State.Value();
-                    infoResult1.capability = jsonResult.Capability.Value();
-                    infoResult1.role = jsonResult.Role.Value();
-                    infoResult1.lifespan = jsonResult.Lifespan.Value();
-                    if (jsonResult.Expires.IsSet()) {
-                        infoResult1.expires = jsonResult.Expires.Value();
-                    }
-                    info.push_back(infoResult1);
-                }
+        } else {
+            info.clear();
         }
 
         if (err != nullptr) {
@@ -198,12 +198,14 @@ namespace UserGrants {
          Get all granted and denied user grants for the given app
          */
         std::vector<GrantInfo> app( const std::string& appId, Firebolt::Error *err = nullptr ) override;
+        void app( const std::string& appId, std::vector<GrantInfo>& info, Firebolt::Error *err = nullptr ) override;
 
         /*
          capability
          Get all granted and denied user grants for the given capability
          */
         std::vector<GrantInfo> capability( const std::string& capability, Firebolt::Error *err = nullptr ) override;
+        void capability( const std::string& capability, std::vector<GrantInfo>& info, Firebolt::Error *err = nullptr ) override;
 
         /*
          clear
@@ -222,6 +224,7 @@ namespace UserGrants {
          Get all granted and denied user grants for the device
          */
         std::vector<GrantInfo> device( Firebolt::Error *err = nullptr ) const override;
+        void device( std::vector<GrantInfo>& info, Firebolt::Error *err = nullptr ) const override;
 
         /*
          grant
@@ -239,3 +242,30 @@ namespace UserGrants {
 
 }//namespace UserGrants
 }
+
+namespace FireboltSDK {
+
+    // Field tables, the wire names of the members
+    template <>
+    struct Reflect<Firebolt::UserGrants::AppInfo> {
+        using Type = Firebolt::UserGrants::AppInfo;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("id", &Type::id),
+            MakeField("title", &Type::title)
+        );
+    };
+
+    template <>
+    struct Reflect<Firebolt::UserGrants::GrantInfo> {
+        using Type = Firebolt::UserGrants::GrantInfo;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("app", &Type::app),
+            MakeField("state", &Type::state),
+            MakeField("capability", &Type::capability),
+            MakeField("role", &Type::role),
+            MakeField("lifespan", &Type::lifespan),
+            MakeField("expires", &Type::expires)
+        );
+    };
+
+}
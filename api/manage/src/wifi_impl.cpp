@@ -61,7 +61,7 @@ namespace Wifi {
                 if (jsonResult.Frequency.IsSet()) {
                     connectedWifiResult.frequency = jsonResult.Frequency.Value();
                 }
-                connectedWifi = connectedWifiResult;
+                connectedWifi = std::move(connectedWifiResult);
         }
 
         if (err != nullptr) {
@@ -114,7 +114,7 @@ namespace Wifi {
                     auto listIndex(jsonResult.List.Elements());
                     while (listIndex.Next() == true) {
                         AccessPoint listResult1;
-                        Firebolt::Wifi::JsonData_AccessPoint jsonResult = listIndex.Current();
+                        const Firebolt::Wifi::JsonData_AccessPoint& jsonResult = listIndex.Current();
                         {
                           if (jsonResult.Ssid.IsSet()) {
                                 listResult1.ssid = jsonResult.Ssid;
@@ -129,10 +129,10 @@ namespace Wifi {
                                 listResult1.frequency = jsonResult.Frequency;
                             }
                         }
-                        listResult.list.value().push_back(listResult1);
+                        listResult.list.value().push_back(std::move(listResult1));
                     }
                 }
-                list = listResult;
+                list = std::move(listResult);
         }
 
         if (err != nullptr) {
@@ -171,7 +171,7 @@ namespace Wifi {
                 if (jsonResult.Frequency.IsSet()) {
                     connectedWifiResult.frequency = jsonResult.Frequency.Value();
                 }
-                connectedWifi = connectedWifiResult;
+                connectedWifi = std::move(connectedWifiResult);
         }
 
         if (err != nullptr) {
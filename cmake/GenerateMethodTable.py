@@ -0,0 +1,235 @@
+#!/usr/bin/env python3
+# Copyright 2024 Comcast Cable Communications Management, LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Compiles firebolt-<sdk>-open-rpc.json into MethodTable.h, a constexpr table of
+every method the SDK may call, indexed by a MethodId, and a minimal perfect
+hash resolving a wire name into that MethodId.
+
+The hash works on 8 byte words folded to lower-case, collisions are resolved
+through hash-and-displace buckets. It has
+to stay in sync with MethodHash() and MethodDisplace() in
+src/Gateway/methodid.h. Events are also
+reachable through the name they are notified with ('module.onFooBar' is
+notified as 'module.fooBar').
+
+Wait time classes:
+  getter      - 'property*' getters and 'event' listen requests
+  interactive - methods answered only once the user acted upon them
+                (provided-by / allow-focus capabilities, a 'timeout' param)
+  default     - everything else
+"""
+
+import argparse
+import json
+import re
+import sys
+
+GETTER_TAGS = {"property", "property:readonly", "property:immutable", "event"}
+
+# Calls that the specification does not mark as user facing, but which may
+# raise a grant or challenge prompt on the platform side.
+INTERACTIVE_METHODS = {"usergrants.request", "capabilities.request"}
+
+LICENSE = """/*
+ * Copyright 2024 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+"""
+
+
+def wait_class(method):
+    tags = method.get("tags", [])
+    names = {tag.get("name") for tag in tags}
+
+    # Subscribing is answered by the platform right away, whatever provides the event later on
+    if "event" in names:
+        return "getter"
+    if method["name"].lower() in INTERACTIVE_METHODS:
+        return "interactive"
+    for tag in tags:
+        if "x-provided-by" in tag or tag.get("x-allow-focus", False):
+            return "interactive"
+    if any(param.get("name") == "timeout" for param in method.get("params", [])):
+        return "interactive"
+    if names & GETTER_TAGS:
+        return "getter"
+    return "default"
+
+
+HASH_OFFSET = 0xCBF29CE484222325
+HASH_MULTIPLIER = 0x9E3779B97F4A7C15
+# Method names are [A-Za-z0-9.] only, setting bit 5 of each byte folds them to lower-case
+CASE_FOLD = 0x2020202020202020
+EMPTY_SLOT = 0xFFFF
+MASK64 = 0xFFFFFFFFFFFFFFFF
+
+
+def method_hash(name):
+    data = name.encode()
+    value = HASH_OFFSET ^ len(data)
+    for index in range(0, len(data), 8):
+        word = int.from_bytes(data[index:index + 8], "little") | CASE_FOLD
+        value = ((value ^ word) * HASH_MULTIPLIER) & MASK64
+        value ^= value >> 32
+    return value & 0xFFFFFFFF
+
+
+def displace(value, seed):
+    # murmur3 finalizer, the name is hashed only once per lookup
+    value = (value ^ seed) & 0xFFFFFFFF
+    value ^= value >> 16
+    value = (value * 0x85EBCA6B) & 0xFFFFFFFF
+    value ^= value >> 13
+    value = (value * 0xC2B2AE35) & 0xFFFFFFFF
+    value ^= value >> 16
+    return value
+
+
+def notification_name(name):
+    module, dot, method = name.partition(".")
+    if dot and len(method) > 2 and method.startswith("on"):
+        return module + "." + method[2].lower() + method[3:]
+    return None
+
+
+def perfect_hash(keys):
+    """Returns (seeds, slots): key k sits in slots[displace(hash(k), seeds[hash(k) % len(seeds)]) % len(slots)]"""
+    bucketCount = max(1, len(keys) // 4)
+    buckets = [[] for _ in range(bucketCount)]
+    for index, key in enumerate(keys):
+        buckets[method_hash(key) % bucketCount].append(index)
+
+    seeds = [0] * bucketCount
+    slots = [EMPTY_SLOT] * max(1, len(keys))
+    for bucket in sorted(range(bucketCount), key=lambda b: -len(buckets[b])):
+        if not buckets[bucket]:
+            break
+        seed = 1
+        while True:
+            positions = [displace(method_hash(keys[index]), seed) % len(slots) for index in buckets[bucket]]
+            if len(set(positions)) == len(positions) and all(slots[p] == EMPTY_SLOT for p in positions):
+                break
+            seed += 1
+        seeds[bucket] = seed
+        for index, position in zip(buckets[bucket], positions):
+            slots[position] = index
+    return seeds, slots
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--output", required=True)
+    parser.add_argument("--getter", type=int, required=True, help="wait time of getters, in ms")
+    parser.add_argument("--default", type=int, required=True, help="wait time of regular methods, in ms")
+    parser.add_argument("--interactive", type=int, required=True, help="wait time of user facing methods, in ms")
+    parser.add_argument("specs", nargs="+")
+    args = parser.parse_args()
+
+    waitTimes = {"getter": args.getter, "default": args.default, "interactive": args.interactive}
+
+    methods = {}
+    for spec in args.specs:
+        with open(spec) as file:
+            document = json.load(file)
+        for method in document.get("methods", []):
+            methods.setdefault(method["name"].lower(), (method["name"], wait_class(method), method))
+
+    names = sorted(methods)
+    for name in names:
+        if not re.fullmatch(r"[a-z0-9.]+", name):
+            sys.exit("method name '%s' cannot be case folded" % methods[name][0])
+    if len(names) >= EMPTY_SLOT:
+        sys.exit("too many methods for a 16 bit MethodId")
+
+    # Lookup keys: every method, plus the notification name of every event
+    keys = list(names)
+    keyIds = list(range(len(names)))
+    for methodId, name in enumerate(names):
+        if "event" in {tag.get("name") for tag in methods[name][2].get("tags", [])}:
+            alias = notification_name(methods[name][0])
+            if alias is not None and alias.lower() not in methods:
+                keys.append(alias.lower())
+                keyIds.append(methodId)
+    seeds, slots = perfect_hash(keys)
+
+    lines = [LICENSE]
+    lines.append("// Generated by cmake/GenerateMethodTable.py, do not edit.")
+    lines.append("#pragma once")
+    lines.append("")
+    lines.append("#include <cstdint>")
+    lines.append("")
+    lines.append("namespace FireboltSDK")
+    lines.append("{")
+    lines.append("    using MethodId = uint16_t;")
+    lines.append("")
+    lines.append("    struct MethodInfo")
+    lines.append("    {")
+    lines.append("        const char* name; // as named by the specification")
+    lines.append("        uint32_t waitTime;")
+    lines.append("    };")
+    lines.append("")
+    lines.append("    struct MethodKey")
+    lines.append("    {")
+    lines.append("        const char* name; // lower-case, the lookup is case insensitive")
+    lines.append("        uint16_t length;")
+    lines.append("        MethodId id;")
+    lines.append("    };")
+    lines.append("")
+    lines.append("    // Indexed by MethodId")
+    lines.append("    static constexpr MethodInfo MethodTable[] = {")
+    for name in names:
+        lines.append("        { \"%s\", %d }," % (methods[name][0], waitTimes[methods[name][1]]))
+    lines.append("    };")
+    lines.append("")
+    lines.append("    static constexpr MethodKey MethodKeys[] = {")
+    for key, methodId in zip(keys, keyIds):
+        lines.append("        { \"%s\", %d, %d }," % (key, len(key), methodId))
+    lines.append("    };")
+    lines.append("")
+    lines.append("    static constexpr uint32_t MethodSeeds[] = {")
+    for index in range(0, len(seeds), 16):
+        lines.append("        " + " ".join("%d," % seed for seed in seeds[index:index + 16]))
+    lines.append("    };")
+    lines.append("")
+    lines.append("    static constexpr uint16_t MethodSlots[] = {")
+    for index in range(0, len(slots), 16):
+        lines.append("        " + " ".join("%d," % slot for slot in slots[index:index + 16]))
+    lines.append("    };")
+    lines.append("}")
+    lines.append("")
+
+    with open(args.output, "w") as file:
+        file.write("\n".join(lines))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,34 @@
+/*
+ * Copyright 2023 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <functional>
+
+namespace Firebolt {
+
+    // Hands the event callbacks over to a thread of the application, its UI or main loop typically
+    struct IDispatcher {
+        virtual ~IDispatcher() = default;
+
+        // Called from an SDK thread, batch runs all the callbacks queued so far and has to be called exactly
+        // once, on the thread of choice. No other Post() follows until it has started.
+        virtual void Post(std::function<void()>&& batch) = 0;
+    };
+
+}
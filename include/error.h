@@ -26,6 +26,7 @@ namespace Firebolt {
         Timedout = 2,
         NotConnected = 3,
         AlreadyConnected = 4,
+        Cancelled = 5,
         //AuthenticationError, ?
         InvalidRequest = -32600,
         MethodNotFound = -32601,
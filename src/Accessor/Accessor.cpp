@@ -25,7 +25,9 @@ namespace FireboltSDK {
     Accessor* Accessor::_singleton = nullptr;
 
     Accessor::Accessor(const string& configLine)
-        : _workerPool()
+        : _executor(nullptr)
+        , _workerPool()
+        , _executorPool()
         , _transport(nullptr)
         , _config()
     {
@@ -36,15 +38,35 @@ namespace FireboltSDK {
         Logger::SetLogLevel(WPEFramework::Core::EnumerateType<Logger::LogLevel>(_config.LogLevel.Value().c_str()).Value());
 
         FIREBOLT_LOG_INFO(Logger::Category::OpenRPC, Logger::Module<Accessor>(), "Url = %s", _config.WsUrl.Value().c_str());
-        _workerPool = WPEFramework::Core::ProxyType<WorkerPoolImplementation>::Create(_config.WorkerPool.ThreadCount.Value(), _config.WorkerPool.StackSize.Value(), _config.WorkerPool.QueueSize.Value());
-        WPEFramework::Core::WorkerPool::Assign(&(*_workerPool));
-        _workerPool->Run();
+        if (_config.WorkerPool.Executor.Value() == _T("caller")) {
+            FIREBOLT_LOG_INFO(Logger::Category::OpenRPC, Logger::Module<Accessor>(), "Jobs run from the application, on Process()");
+            _executor = new CallerExecutor();
+            CallerExecutor::Assign(_executor);
+        }
+        MessagePool::Configure({ _config.MessagePool.ThreadHighWater.Value(), _config.MessagePool.ThreadLowWater.Value(), _config.MessagePool.SharedHighWater.Value() });
+        if (_executor != nullptr) {
+            _executorPool = std::make_unique<ExecutorWorkerPool>(*_executor);
+            WPEFramework::Core::IWorkerPool::Assign(_executorPool.get());
+        } else {
+            _workerPool = WPEFramework::Core::ProxyType<WorkerPoolImplementation>::Create(_config.WorkerPool.ThreadCount.Value(), _config.WorkerPool.StackSize.Value(), _config.WorkerPool.QueueSize.Value(),
+                _config.WorkerPool.MaxThreadCount.Value(), _config.WorkerPool.GrowThreshold.Value(), _config.WorkerPool.IdleTime.Value());
+            WPEFramework::Core::WorkerPool::Assign(&(*_workerPool));
+            _workerPool->Run();
+        }
     }
 
     Accessor::~Accessor()
     {
         WPEFramework::Core::IWorkerPool::Assign(nullptr);
-        _workerPool->Stop();
+        if (_workerPool.IsValid() == true) {
+            _workerPool->Stop();
+        }
+        if (_executor != nullptr) {
+            _executorPool.reset();
+            CallerExecutor::Assign(nullptr);
+            delete _executor;
+            _executor = nullptr;
+        }
 
         ASSERT(_singleton != nullptr);
         _singleton = nullptr;
@@ -27,6 +27,7 @@
 #include "Logger/Logger.h"
 
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 
 namespace FireboltSDK {
@@ -52,19 +53,61 @@ namespace FireboltSDK {
                         : WPEFramework::Core::JSON::Container()
                         , QueueSize(8)
                         , ThreadCount(3)
+                        , MaxThreadCount(8)
+                        , GrowThreshold(WorkStealingPool::DefaultGrowThreshold)
+                        , IdleTime(WorkStealingPool::DefaultIdleTime)
                         , StackSize(WPEFramework::Core::Thread::DefaultStackSize())
+                        , Executor(_T("pool"))
                     {
                         Add("queueSize", &QueueSize);
                         Add("threadCount", &ThreadCount);
+                        Add("maxThreadCount", &MaxThreadCount);
+                        Add("growThreshold", &GrowThreshold);
+                        Add("idleTime", &IdleTime);
                         Add("stackSize", &StackSize);
+                        Add("executor", &Executor);
                     }
 
                     virtual ~WorkerPoolConfig() = default;
 
                 public:
+                    // Only bounds the jobs scheduled for later, submitted ones are queued without limit
                     WPEFramework::Core::JSON::DecUInt32 QueueSize;
+                    // Threads started with, more are added up to MaxThreadCount once queued jobs waited for
+                    // GrowThreshold ms, and retired again after IdleTime ms without work
                     WPEFramework::Core::JSON::DecUInt32 ThreadCount;
+                    WPEFramework::Core::JSON::DecUInt32 MaxThreadCount;
+                    WPEFramework::Core::JSON::DecUInt32 GrowThreshold;
+                    WPEFramework::Core::JSON::DecUInt32 IdleTime;
                     WPEFramework::Core::JSON::DecUInt32 StackSize;
+                    // "pool" runs the jobs on the threads above, "caller" leaves them to the application calling
+                    // Process() whenever Descriptor() turns readable
+                    WPEFramework::Core::JSON::String Executor;
+                };
+
+            class MessagePoolConfig : public WPEFramework::Core::JSON::Container {
+                public:
+                    MessagePoolConfig& operator=(const MessagePoolConfig&);
+
+                    MessagePoolConfig()
+                        : WPEFramework::Core::JSON::Container()
+                        , ThreadHighWater(MessagePool::DefaultLimits.threadHighWater)
+                        , ThreadLowWater(MessagePool::DefaultLimits.threadLowWater)
+                        , SharedHighWater(MessagePool::DefaultLimits.sharedHighWater)
+                    {
+                        Add("threadHighWater", &ThreadHighWater);
+                        Add("threadLowWater", &ThreadLowWater);
+                        Add("sharedHighWater", &SharedHighWater);
+                    }
+
+                    virtual ~MessagePoolConfig() = default;
+
+                public:
+                    // Released messages a thread keeps for itself, above ThreadHighWater it hands over all but
+                    // ThreadLowWater of them to a shared list holding up to SharedHighWater
+                    WPEFramework::Core::JSON::DecUInt32 ThreadHighWater;
+                    WPEFramework::Core::JSON::DecUInt32 ThreadLowWater;
+                    WPEFramework::Core::JSON::DecUInt32 SharedHighWater;
                 };
 
 
@@ -73,6 +116,7 @@ namespace FireboltSDK {
                 , WaitTime(1000)
                 , LogLevel(_T("Info"))
                 , WorkerPool()
+                , MessagePool()
                 , WsUrl(_T("ws://127.0.0.1:9998"))
 #ifdef GATEWAY_BIDIRECTIONAL
                 , RPCv2(true)
@@ -81,6 +125,7 @@ namespace FireboltSDK {
                 Add(_T("waitTime"), &WaitTime);
                 Add(_T("logLevel"), &LogLevel);
                 Add(_T("workerPool"), &WorkerPool);
+                Add(_T("messagePool"), &MessagePool);
                 Add(_T("wsUrl"), &WsUrl);
 #ifdef GATEWAY_BIDIRECTIONAL
                 Add(_T("rpcV2"), &RPCv2);
@@ -91,6 +136,7 @@ namespace FireboltSDK {
             WPEFramework::Core::JSON::DecUInt32 WaitTime;
             WPEFramework::Core::JSON::String LogLevel;
             WorkerPoolConfig WorkerPool;
+            MessagePoolConfig MessagePool;
             WPEFramework::Core::JSON::String WsUrl;
 #ifdef GATEWAY_BIDIRECTIONAL
             WPEFramework::Core::JSON::Boolean RPCv2;
@@ -128,8 +174,10 @@ namespace FireboltSDK {
                 Gateway::Instance().TransportUpdated(_transport);
                 status = CreateEventHandler();
             }
-            running = true;
-            reconnector = std::thread(std::bind(&Accessor::Reconnector, this));
+            if (_executor == nullptr) {
+                running = true;
+                reconnector = std::thread(std::bind(&Accessor::Reconnector, this));
+            }
             return status;
         }
 
@@ -160,6 +208,25 @@ namespace FireboltSDK {
 
         Event& GetEventManager();
 
+        void Dispatcher(Firebolt::IDispatcher* dispatcher)
+        {
+            CallbackDispatcher::Instance().Assign(dispatcher);
+        }
+
+        // -1 unless the application runs the SDK
+        int Descriptor() const
+        {
+            return (_executor != nullptr) ? _executor->Descriptor() : -1;
+        }
+        Firebolt::Error Process(const uint32_t waitTime)
+        {
+            if (_executor == nullptr) {
+                return Firebolt::Error::General;
+            }
+            _executor->Process(waitTime);
+            return Firebolt::Error::None;
+        }
+
     private:
         Firebolt::Error CreateEventHandler();
         Firebolt::Error DestroyEventHandler();
@@ -170,7 +237,9 @@ namespace FireboltSDK {
         void Reconnector();
 
     private:
-        WPEFramework::Core::ProxyType<WorkerPoolImplementation> _workerPool;
+        CallerExecutor* _executor;
+        WPEFramework::Core::ProxyType<WorkerPoolImplementation> _workerPool; // unless the application runs the SDK
+        std::unique_ptr<ExecutorWorkerPool> _executorPool; // if it does
         Transport<WPEFramework::Core::JSON::IElement>* _transport;
         static Accessor* _singleton;
         Config _config;
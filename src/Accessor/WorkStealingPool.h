@@ -0,0 +1,745 @@
+/*
+ * Copyright 2024 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "Module.h"
+#include "Logger/Logger.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace FireboltSDK {
+
+    // Runs IDispatch jobs on a set of minions, each owning a Chase-Lev deque. A job submitted from a
+    // minion goes to the bottom of its own deque, any other one to the unbounded injection queue. A minion
+    // out of work takes from the injection queue, then steals from the top of the others' deques and parks
+    // only once there is nothing left anywhere.
+    //
+    // Given a maximum above the initial thread count, the pool is elastic: a supervisor adds a minion
+    // whenever queued work waited longer than the grow threshold (typically every minion blocked in a
+    // synchronous request, waiting for a response that needs a minion to be dispatched), and a minion
+    // left idle for longer than the idle time retires, down to the initial count.
+    class WorkStealingPool {
+    public:
+        using Job = WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch>;
+
+        // Rounds of stealing attempts an idle minion makes before parking
+        static constexpr uint32_t SpinRounds = 16;
+        static constexpr uint32_t DefaultGrowThreshold = 100; // ms
+        static constexpr uint32_t DefaultIdleTime = 5000; // ms
+
+        struct Statistics {
+            uint8_t threads; // running now
+            uint8_t peak;
+            uint32_t grown;
+            uint32_t shrunk;
+        };
+
+    private:
+        struct Task {
+            enum State : uint8_t {
+                PENDING,
+                RUNNING,
+                REVOKED
+            };
+
+            Task(const Job& job)
+                : job(job)
+                , submitted(0)
+                , state(PENDING)
+                , previous(nullptr)
+                , next(nullptr)
+            {
+            }
+
+            Job job;
+            // Only stamped on the injection queue, in ns of the steady clock
+            uint64_t submitted;
+            std::atomic<uint8_t> state;
+            // Links of the shard the task is registered with
+            Task* previous;
+            Task* next;
+        };
+
+        // Chase-Lev deque (Le et al., "Correct and Efficient Work-Stealing for Weak Memory Models"). The owner
+        // pushes and pops at the bottom, thieves take from the top. Arrays outgrown are kept until destruction
+        // as a thief may still read from them.
+        class Deque {
+        private:
+            struct Array {
+                Array(const int64_t size)
+                    : mask(size - 1)
+                    , slots(new std::atomic<Task*>[size])
+                {
+                }
+
+                Task* Get(const int64_t index) const
+                {
+                    return slots[index & mask].load(std::memory_order_relaxed);
+                }
+                void Put(const int64_t index, Task* task)
+                {
+                    slots[index & mask].store(task, std::memory_order_relaxed);
+                }
+
+                const int64_t mask;
+                std::unique_ptr<std::atomic<Task*>[]> slots;
+            };
+
+        public:
+            Deque(const Deque&) = delete;
+            Deque& operator=(const Deque&) = delete;
+
+            Deque()
+                : _top(0)
+                , _bottom(0)
+                , _array(new Array(InitialSize))
+            {
+                _arrays.emplace_back(_array.load());
+            }
+            ~Deque() = default;
+
+            // Owner only
+            void Push(Task* task)
+            {
+                int64_t bottom = _bottom.load(std::memory_order_relaxed);
+                int64_t top = _top.load(std::memory_order_acquire);
+                Array* array = _array.load(std::memory_order_relaxed);
+                if ((bottom - top) > array->mask) {
+                    array = Grow(array, top, bottom);
+                }
+                array->Put(bottom, task);
+                _bottom.store(bottom + 1, std::memory_order_seq_cst);
+            }
+
+            // Owner only
+            Task* Pop()
+            {
+                int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+                Array* array = _array.load(std::memory_order_relaxed);
+                _bottom.store(bottom, std::memory_order_seq_cst);
+                int64_t top = _top.load(std::memory_order_seq_cst);
+
+                Task* task = nullptr;
+                if (top <= bottom) {
+                    task = array->Get(bottom);
+                    if (top == bottom) {
+                        // Last one, race the thieves for it
+                        if (_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed) == false) {
+                            task = nullptr;
+                        }
+                        _bottom.store(bottom + 1, std::memory_order_relaxed);
+                    }
+                } else {
+                    _bottom.store(bottom + 1, std::memory_order_relaxed);
+                }
+                return task;
+            }
+
+            // Any thread, may fail spuriously when racing another thief or the owner
+            Task* Steal()
+            {
+                int64_t top = _top.load(std::memory_order_seq_cst);
+                int64_t bottom = _bottom.load(std::memory_order_seq_cst);
+
+                Task* task = nullptr;
+                if (top < bottom) {
+                    Array* array = _array.load(std::memory_order_acquire);
+                    task = array->Get(top);
+                    if (_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed) == false) {
+                        task = nullptr;
+                    }
+                }
+                return task;
+            }
+
+            bool IsEmpty() const
+            {
+                return (_bottom.load(std::memory_order_seq_cst) <= _top.load(std::memory_order_seq_cst));
+            }
+
+        private:
+            Array* Grow(Array* array, const int64_t top, const int64_t bottom)
+            {
+                Array* grown = new Array((array->mask + 1) * 2);
+                for (int64_t index = top; index < bottom; ++index) {
+                    grown->Put(index, array->Get(index));
+                }
+                _arrays.emplace_back(grown);
+                _array.store(grown, std::memory_order_release);
+                return grown;
+            }
+
+        private:
+            static constexpr int64_t InitialSize = 64;
+
+            std::atomic<int64_t> _top;
+            std::atomic<int64_t> _bottom;
+            std::atomic<Array*> _array;
+            std::vector<std::unique_ptr<Array>> _arrays;
+        };
+
+        class Minion : public WPEFramework::Core::Thread {
+        public:
+            Minion() = delete;
+            Minion(const Minion&) = delete;
+            Minion& operator=(const Minion&) = delete;
+
+            Minion(WorkStealingPool& pool, const uint8_t index, const uint32_t stackSize)
+                : WPEFramework::Core::Thread(stackSize, _T("FireboltWorker"))
+                , _pool(pool)
+                , _index(index)
+                , _deque()
+                , _retired(false)
+            {
+            }
+            ~Minion() override
+            {
+                Stop();
+                Wait(WPEFramework::Core::Thread::STOPPED, WPEFramework::Core::infinite);
+            }
+
+        public:
+            const WorkStealingPool& Pool() const
+            {
+                return _pool;
+            }
+            uint8_t Index() const
+            {
+                return _index;
+            }
+            Deque& Queue()
+            {
+                return _deque;
+            }
+            // Left the pool for being idle, its deque is empty until it is run again
+            bool Retired() const
+            {
+                return _retired.load();
+            }
+            void Retired(const bool retired)
+            {
+                _retired.store(retired);
+            }
+
+        private:
+            uint32_t Worker() override
+            {
+                _pool.Process(*this);
+                Block();
+                return (WPEFramework::Core::infinite);
+            }
+
+        private:
+            WorkStealingPool& _pool;
+            const uint8_t _index;
+            Deque _deque;
+            std::atomic<bool> _retired;
+        };
+
+        class Supervisor : public WPEFramework::Core::Thread {
+        public:
+            Supervisor() = delete;
+            Supervisor(const Supervisor&) = delete;
+            Supervisor& operator=(const Supervisor&) = delete;
+
+            Supervisor(WorkStealingPool& pool)
+                : WPEFramework::Core::Thread(WPEFramework::Core::Thread::DefaultStackSize(), _T("FireboltPoolSupervisor"))
+                , _pool(pool)
+            {
+            }
+            ~Supervisor() override
+            {
+                Stop();
+                Wait(WPEFramework::Core::Thread::STOPPED, WPEFramework::Core::infinite);
+            }
+
+        private:
+            uint32_t Worker() override
+            {
+                return (_pool.Supervise());
+            }
+
+        private:
+            WorkStealingPool& _pool;
+        };
+
+        // Tasks submitted and not retired yet, for Revoke() to find them. Sharded by job to keep submitters
+        // from contending on it, intrusive so that registering does not allocate.
+        struct Shard {
+            std::mutex mtx;
+            std::condition_variable finished;
+            Task* tasks = nullptr;
+            uint32_t waiters = 0;
+
+            void Link(Task* task)
+            {
+                task->next = tasks;
+                if (tasks != nullptr) {
+                    tasks->previous = task;
+                }
+                tasks = task;
+            }
+            void Unlink(Task* task)
+            {
+                if (task->previous != nullptr) {
+                    task->previous->next = task->next;
+                } else {
+                    tasks = task->next;
+                }
+                if (task->next != nullptr) {
+                    task->next->previous = task->previous;
+                }
+            }
+        };
+        static constexpr uint8_t ShardCount = 16;
+
+    public:
+        WorkStealingPool() = delete;
+        WorkStealingPool(const WorkStealingPool&) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+        // A maxThreads not above threads keeps the pool at a fixed size
+        WorkStealingPool(const uint8_t threads, const uint32_t stackSize, const uint8_t maxThreads = 0,
+            const uint32_t growThreshold = DefaultGrowThreshold, const uint32_t idleTime = DefaultIdleTime)
+            : _minimum(std::max<uint8_t>(threads, 1))
+            , _maximum(std::max(_minimum, maxThreads))
+            , _stackSize(stackSize)
+            , _growThreshold(growThreshold)
+            , _idleTime(idleTime)
+            , _minions()
+            , _created(0)
+            , _active(0)
+            , _supervisor()
+            , _injected()
+            , _injectedCount(0)
+            , _injectLock()
+            , _parkLock()
+            , _wakeup()
+            , _sleepers(0)
+            , _stopping(true)
+            , _started(0)
+            , _lastStarted(0)
+            , _stalledSince(0)
+            , _saturated(false)
+            , _peak(0)
+            , _grown(0)
+            , _shrunk(0)
+        {
+            // Never reallocated, thieves read it while the supervisor adds minions
+            _minions.reserve(_maximum);
+            for (uint8_t index = 0; index < _minimum; ++index) {
+                Add();
+            }
+            if (_maximum > _minimum) {
+                _supervisor.reset(new Supervisor(*this));
+            }
+        }
+        ~WorkStealingPool()
+        {
+            Stop();
+            _supervisor.reset();
+            _minions.clear();
+        }
+
+    public:
+        void Run()
+        {
+            _stopping.store(false);
+            const uint8_t created = _created.load();
+            for (uint8_t index = 0; index < created; ++index) {
+                _minions[index]->Retired(index >= _minimum);
+            }
+            _active.store(_minimum);
+            _peak.store(std::max(_peak.load(), _minimum));
+            for (uint8_t index = 0; index < _minimum; ++index) {
+                _minions[index]->Run();
+            }
+            if (_supervisor != nullptr) {
+                _lastStarted = _started.load();
+                _stalledSince = 0;
+                _saturated = false;
+                _supervisor->Run();
+            }
+        }
+
+        // Jobs not started yet are dropped
+        void Stop()
+        {
+            _stopping.store(true);
+            if (_supervisor != nullptr) {
+                _supervisor->Block();
+                _supervisor->Wait(WPEFramework::Core::Thread::BLOCKED | WPEFramework::Core::Thread::STOPPED, WPEFramework::Core::infinite);
+            }
+            {
+                std::lock_guard lck(_parkLock);
+                _wakeup.notify_all();
+            }
+            const uint8_t created = _created.load();
+            for (uint8_t index = 0; index < created; ++index) {
+                _minions[index]->Wait(WPEFramework::Core::Thread::BLOCKED | WPEFramework::Core::Thread::STOPPED, WPEFramework::Core::infinite);
+            }
+            Task* task;
+            while ((task = TakeInjected()) != nullptr) {
+                Retire(task);
+            }
+            for (uint8_t index = 0; index < created; ++index) {
+                while ((task = _minions[index]->Queue().Steal()) != nullptr) {
+                    Retire(task);
+                }
+            }
+        }
+
+        void Submit(const Job& job)
+        {
+            Task* task = new Task(job);
+            {
+                Shard& shard = ShardOf(job.operator->());
+                std::lock_guard lck(shard.mtx);
+                shard.Link(task);
+            }
+
+            Minion* self = Self();
+            if ((self != nullptr) && (&(self->Pool()) == this)) {
+                self->Queue().Push(task);
+            } else {
+                task->submitted = Now();
+                std::lock_guard lck(_injectLock);
+                _injected.push_back(task);
+                _injectedCount.fetch_add(1);
+            }
+            Wake();
+        }
+
+        // A job still queued is not run anymore, one running is waited for unless it revokes itself.
+        // Returns ERROR_UNKNOWN_KEY for a job not submitted to this pool.
+        uint32_t Revoke(const Job& job, const uint32_t waitTime = WPEFramework::Core::infinite)
+        {
+            const WPEFramework::Core::IDispatch* key = job.operator->();
+            Shard& shard = ShardOf(key);
+            std::unique_lock lck(shard.mtx);
+
+            bool found = false;
+            bool running = false;
+            for (Task* task = shard.tasks; task != nullptr; task = task->next) {
+                if (task->job.operator->() == key) {
+                    uint8_t state = Task::PENDING;
+                    found = true;
+                    if (task->state.compare_exchange_strong(state, Task::REVOKED) == false) {
+                        running = running || (state == Task::RUNNING);
+                    }
+                }
+            }
+            if (found == false) {
+                return WPEFramework::Core::ERROR_UNKNOWN_KEY;
+            }
+            if ((running == false) || (Running() == key)) {
+                return WPEFramework::Core::ERROR_NONE;
+            }
+
+            auto done = [&shard, key]() {
+                for (Task* task = shard.tasks; task != nullptr; task = task->next) {
+                    if ((task->job.operator->() == key) && (task->state.load() == Task::RUNNING)) {
+                        return false;
+                    }
+                }
+                return true;
+            };
+            bool finished = true;
+            ++shard.waiters;
+            if (waitTime == WPEFramework::Core::infinite) {
+                shard.finished.wait(lck, done);
+            } else {
+                finished = shard.finished.wait_for(lck, std::chrono::milliseconds(waitTime), done);
+            }
+            --shard.waiters;
+            return (finished ? WPEFramework::Core::ERROR_NONE : WPEFramework::Core::ERROR_TIMEDOUT);
+        }
+
+        Statistics Stats() const
+        {
+            return { _active.load(), _peak.load(), _grown.load(), _shrunk.load() };
+        }
+
+    private:
+        static Minion*& Self()
+        {
+            static thread_local Minion* self = nullptr;
+            return self;
+        }
+        // Job run by the calling thread, if any
+        static const WPEFramework::Core::IDispatch*& Running()
+        {
+            static thread_local const WPEFramework::Core::IDispatch* running = nullptr;
+            return running;
+        }
+
+        static uint64_t Now()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        Shard& ShardOf(const WPEFramework::Core::IDispatch* key)
+        {
+            return _shards[(reinterpret_cast<uintptr_t>(key) >> 4) % ShardCount];
+        }
+
+        // Supervisor only, once the constructor is done
+        Minion* Add()
+        {
+            const uint8_t index = _created.load();
+            _minions.emplace_back(new Minion(*this, index, _stackSize));
+            _created.store(index + 1);
+            return _minions.back().get();
+        }
+
+        void Process(Minion& minion)
+        {
+            Self() = &minion;
+            uint32_t seed = minion.Index() + 1;
+            while (_stopping.load() == false) {
+                Task* task = minion.Queue().Pop();
+                if (task == nullptr) {
+                    task = TakeInjected();
+                }
+                for (uint32_t round = 0; (task == nullptr) && (round < SpinRounds); ++round) {
+                    task = Steal(minion, seed);
+                    if (task == nullptr) {
+                        std::this_thread::yield();
+                    }
+                }
+                if (task != nullptr) {
+                    Execute(task);
+                } else if (Park(minion) == false) {
+                    FIREBOLT_LOG_INFO(Logger::Category::OpenRPC, Logger::Module<WorkStealingPool>(), "Idle for %u ms, shrinking to %u threads", _idleTime, _active.load());
+                    break;
+                }
+            }
+            Self() = nullptr;
+        }
+
+        void Execute(Task* task)
+        {
+            uint8_t state = Task::PENDING;
+            if (task->state.compare_exchange_strong(state, Task::RUNNING) == true) {
+                _started.fetch_add(1, std::memory_order_relaxed);
+                const WPEFramework::Core::IDispatch* previous = Running();
+                Running() = task->job.operator->();
+                task->job->Dispatch();
+                Running() = previous;
+            }
+            Retire(task);
+        }
+
+        void Retire(Task* task)
+        {
+            const WPEFramework::Core::IDispatch* key = task->job.operator->();
+            Shard& shard = ShardOf(key);
+            {
+                std::lock_guard lck(shard.mtx);
+                shard.Unlink(task);
+                if (shard.waiters > 0) {
+                    shard.finished.notify_all();
+                }
+            }
+            delete task;
+        }
+
+        Task* TakeInjected()
+        {
+            Task* task = nullptr;
+            if (_injectedCount.load() > 0) {
+                std::lock_guard lck(_injectLock);
+                if (_injected.empty() == false) {
+                    task = _injected.front();
+                    _injected.pop_front();
+                    _injectedCount.fetch_sub(1);
+                }
+            }
+            return task;
+        }
+
+        Task* Steal(Minion& thief, uint32_t& seed)
+        {
+            // xorshift, to spread the thieves over the victims
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            const size_t count = _created.load();
+            const size_t start = seed % count;
+            for (size_t offset = 0; offset < count; ++offset) {
+                Minion& victim = *_minions[(start + offset) % count];
+                if (&victim != &thief) {
+                    Task* task = victim.Queue().Steal();
+                    if (task != nullptr) {
+                        return task;
+                    }
+                }
+            }
+            return TakeInjected();
+        }
+
+        bool HasWork() const
+        {
+            if (_injectedCount.load() > 0) {
+                return true;
+            }
+            const uint8_t created = _created.load();
+            for (uint8_t index = 0; index < created; ++index) {
+                if (_minions[index]->Queue().IsEmpty() == false) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Returns false when the minion retires, having been idle for too long
+        bool Park(Minion& minion)
+        {
+            bool stay = true;
+            std::unique_lock lck(_parkLock);
+            _sleepers.fetch_add(1);
+            if ((_stopping.load() == false) && (HasWork() == false)) {
+                if (_maximum == _minimum) {
+                    _wakeup.wait(lck);
+                } else if ((_wakeup.wait_for(lck, std::chrono::milliseconds(_idleTime)) == std::cv_status::timeout) && (HasWork() == false)) {
+                    uint8_t active = _active.load();
+                    while ((active > _minimum) && (_active.compare_exchange_weak(active, active - 1) == false)) {
+                    }
+                    if (active > _minimum) {
+                        minion.Retired(true);
+                        _shrunk.fetch_add(1);
+                        stay = false;
+                    }
+                }
+            }
+            _sleepers.fetch_sub(1);
+            return stay;
+        }
+
+        void Wake()
+        {
+            if (_sleepers.load() > 0) {
+                std::lock_guard lck(_parkLock);
+                _wakeup.notify_one();
+            }
+        }
+
+        // Supervisor only, returns the time until the next round
+        uint32_t Supervise()
+        {
+            const uint64_t now = Now();
+            uint64_t waited = 0;
+            {
+                std::lock_guard lck(_injectLock);
+                if (_injected.empty() == false) {
+                    waited = now - _injected.front()->submitted;
+                }
+            }
+            // Work queued on the deques carries no stamp, it is considered waiting for as long as no job started
+            const uint32_t started = _started.load(std::memory_order_relaxed);
+            if ((started != _lastStarted) || (HasWork() == false)) {
+                _stalledSince = 0;
+            } else if (_stalledSince == 0) {
+                _stalledSince = now;
+            } else {
+                waited = std::max(waited, now - _stalledSince);
+            }
+            _lastStarted = started;
+
+            if (waited < (static_cast<uint64_t>(_growThreshold) * 1000000)) {
+                _saturated = false;
+            } else if (_stopping.load() == false) {
+                Grow(static_cast<uint32_t>(waited / 1000000));
+            }
+            return std::max<uint32_t>(_growThreshold / 2, 1);
+        }
+
+        // Supervisor only, a minion at a time
+        void Grow(const uint32_t waited)
+        {
+            Minion* minion = nullptr;
+            bool created = false;
+            {
+                std::lock_guard lck(_parkLock);
+                if (_active.load() < _maximum) {
+                    const uint8_t count = _created.load();
+                    for (uint8_t index = 0; (minion == nullptr) && (index < count); ++index) {
+                        if (_minions[index]->Retired() == true) {
+                            minion = _minions[index].get();
+                        }
+                    }
+                    created = ((minion == nullptr) && (count < _maximum));
+                }
+            }
+            if (created == true) {
+                minion = Add();
+            } else if (minion != nullptr) {
+                // May not have blocked yet after retiring
+                minion->Wait(WPEFramework::Core::Thread::BLOCKED | WPEFramework::Core::Thread::STOPPED, WPEFramework::Core::infinite);
+                minion->Retired(false);
+            }
+            if (minion != nullptr) {
+                const uint8_t active = _active.fetch_add(1) + 1;
+                uint8_t peak = _peak.load();
+                while ((active > peak) && (_peak.compare_exchange_weak(peak, active) == false)) {
+                }
+                _grown.fetch_add(1);
+                minion->Run();
+                FIREBOLT_LOG_INFO(Logger::Category::OpenRPC, Logger::Module<WorkStealingPool>(), "Queued work waited %u ms, growing to %u threads", waited, active);
+            } else if (_saturated == false) {
+                _saturated = true;
+                FIREBOLT_LOG_WARNING(Logger::Category::OpenRPC, Logger::Module<WorkStealingPool>(), "Queued work waited %u ms, already at %u threads", waited, _maximum);
+            }
+        }
+
+    private:
+        const uint8_t _minimum;
+        const uint8_t _maximum;
+        const uint32_t _stackSize;
+        const uint32_t _growThreshold;
+        const uint32_t _idleTime;
+        std::vector<std::unique_ptr<Minion>> _minions;
+        std::atomic<uint8_t> _created;
+        std::atomic<uint8_t> _active;
+        std::unique_ptr<Supervisor> _supervisor;
+        std::deque<Task*> _injected;
+        std::atomic<uint32_t> _injectedCount;
+        std::mutex _injectLock;
+        std::mutex _parkLock;
+        std::condition_variable _wakeup;
+        std::atomic<uint32_t> _sleepers;
+        std::atomic<bool> _stopping;
+        std::atomic<uint32_t> _started;
+        // Supervisor only
+        uint32_t _lastStarted;
+        uint64_t _stalledSince;
+        bool _saturated;
+        std::atomic<uint8_t> _peak;
+        std::atomic<uint32_t> _grown;
+        std::atomic<uint32_t> _shrunk;
+        Shard _shards[ShardCount];
+    };
+}
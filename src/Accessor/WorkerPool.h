@@ -19,17 +19,24 @@
 #pragma once
 
 #include "Module.h"
+#include "WorkStealingPool.h"
+#include "Transport/executor.h"
+#include "Gateway/function.h"
 
 namespace FireboltSDK {
 
+    // Submitted jobs run on the SDK's work-stealing pool, the Thunder pool underneath is only left with the
+    // timer of the scheduled ones, which it runs on its single minion.
     class WorkerPoolImplementation : public WPEFramework::Core::WorkerPool {
     public:
         WorkerPoolImplementation() = delete;
         WorkerPoolImplementation(const WorkerPoolImplementation&) = delete;
         WorkerPoolImplementation& operator=(const WorkerPoolImplementation&) = delete;
 
-        WorkerPoolImplementation(const uint8_t threads, const uint32_t stackSize, const uint32_t queueSize)
-            : WorkerPool(threads, stackSize, queueSize, &_dispatcher)
+        WorkerPoolImplementation(const uint8_t threads, const uint32_t stackSize, const uint32_t queueSize, const uint8_t maxThreads = 0,
+            const uint32_t growThreshold = WorkStealingPool::DefaultGrowThreshold, const uint32_t idleTime = WorkStealingPool::DefaultIdleTime)
+            : WorkerPool(1, stackSize, queueSize, &_dispatcher)
+            , _pool(threads, stackSize, maxThreads, growThreshold, idleTime)
         {
         }
 
@@ -40,13 +47,35 @@ namespace FireboltSDK {
         }
 
     public:
+        void Submit(const WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch>& job) override
+        {
+            _pool.Submit(job);
+        }
+
+        uint32_t Revoke(const WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch>& job, const uint32_t waitTime = WPEFramework::Core::infinite) override
+        {
+            uint32_t result = _pool.Revoke(job, waitTime);
+            if (result == WPEFramework::Core::ERROR_UNKNOWN_KEY) {
+                // May be a scheduled one
+                result = WPEFramework::Core::WorkerPool::Revoke(job, waitTime);
+            }
+            return result;
+        }
+
+        WorkStealingPool::Statistics Stats() const
+        {
+            return _pool.Stats();
+        }
+
         void Stop()
         {
             WPEFramework::Core::WorkerPool::Stop();
+            _pool.Stop();
         }
 
         void Run()
         {
+            _pool.Run();
             WPEFramework::Core::WorkerPool::Run();
         }
 
@@ -67,15 +96,78 @@ namespace FireboltSDK {
         };
 
         Dispatcher _dispatcher;
+        WorkStealingPool _pool;
+    };
+
+    // The worker pool when the application runs the SDK: jobs are run from its calls to CallerExecutor::Process(),
+    // scheduled ones once the timer of the executor fires for them. Unlike the Thunder pool, it starts no thread.
+    class ExecutorWorkerPool : public WPEFramework::Core::IWorkerPool {
+    public:
+        ExecutorWorkerPool() = delete;
+        ExecutorWorkerPool(const ExecutorWorkerPool&) = delete;
+        ExecutorWorkerPool& operator=(const ExecutorWorkerPool&) = delete;
+
+        ExecutorWorkerPool(CallerExecutor& executor)
+            : _executor(executor)
+            , _metadata()
+        {
+        }
+        ~ExecutorWorkerPool() override = default;
+
+    public:
+        ::ThreadId Id(const uint8_t /* index */) const override
+        {
+            return (::ThreadId());
+        }
+
+        void Submit(const WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch>& job) override
+        {
+            _executor.Submit(job);
+        }
+
+        void Schedule(const WPEFramework::Core::Time& time, const WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch>& job) override
+        {
+            _executor.Trigger(time.Ticks(), job.operator->(), [this, job]() -> uint64_t {
+                _executor.Submit(job);
+                return (0);
+            });
+        }
+
+        uint32_t Revoke(const WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch>& job, const uint32_t waitTime = WPEFramework::Core::infinite) override
+        {
+            const bool scheduled = _executor.Revoke(static_cast<const void*>(job.operator->()));
+            uint32_t result = _executor.Revoke(job, waitTime);
+            return ((scheduled == true) && (result == WPEFramework::Core::ERROR_UNKNOWN_KEY) ? WPEFramework::Core::ERROR_NONE : result);
+        }
+
+        const Metadata& Snapshot() const override
+        {
+            return (_metadata);
+        }
+
+        // The application runs the jobs, there are no threads to start, stop or join
+        void Join() override
+        {
+        }
+        void Run() override
+        {
+        }
+        void Stop() override
+        {
+        }
+
+    private:
+        CallerExecutor& _executor;
+        Metadata _metadata;
     };
 
     class Worker : public WPEFramework::Core::IDispatch {
     public:
-        typedef std::function<void(const void*)> Dispatcher;
+        typedef InplaceFunction<void(const void*)> Dispatcher;
 
     protected:
-        Worker(const Dispatcher& dispatcher, const void* userData)
-            : _dispatcher(dispatcher)
+        Worker(Dispatcher&& dispatcher, const void* userData)
+            : _dispatcher(std::move(dispatcher))
             , _userData(userData)
         {
         }
@@ -88,7 +180,7 @@ namespace FireboltSDK {
         ~Worker() = default;
 
     public:
-        static WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch> Create(const Dispatcher& dispatcher, const void* userData);
+        static WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch> Create(Dispatcher&& dispatcher, const void* userData);
 
         void Dispatch() override
         {
@@ -22,8 +22,7 @@
 namespace FireboltSDK {
     Async* Async::_singleton = nullptr;
     Async::Async()
-        : _methodMap()
-        , _adminLock()
+        : _calls(std::make_shared<Calls>())
     {
         ASSERT(_singleton == nullptr);
         _singleton = this;
@@ -56,19 +55,6 @@ namespace FireboltSDK {
 
     void Async::Clear()
     {
-        _adminLock.Lock();
-        MethodMap::iterator index = _methodMap.begin();
-        while (index != _methodMap.end()) {
-            CallbackMap::iterator callbackIndex = index->second.begin();
-            while (callbackIndex != index->second.end()) {
-                if (IsValidJob(callbackIndex->second)) {
-                    WPEFramework::Core::IWorkerPool::Instance().Revoke(callbackIndex->second.job);
-                }
-                callbackIndex = index->second.erase(callbackIndex);
-            }
-            index = _methodMap.erase(index);
-        }
-        _adminLock.Unlock();
+        Cancel(_calls->Remove([](const Handle, const Call&) { return true; }));
     }
 }
-
@@ -21,8 +21,16 @@
 #include "Module.h"
 #include "Gateway/Gateway.h"
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
 namespace FireboltSDK {
 
+    // Requests answered through a callback. The request is sent from the calling thread and the callback runs
+    // straight from the response handler, so no worker is held while the platform answers.
     class Async {
     private:
         Async();
@@ -32,148 +40,160 @@ namespace FireboltSDK {
         Async& operator= (const Async&) = delete;
 
     public:
-        typedef std::function<Firebolt::Error(Async& parent, void*)> DispatchFunction;
-
-        class Job : public WPEFramework::Core::IDispatch {
-        protected:
-            Job(Async& parent, const string& method, const DispatchFunction lambda, void* usercb)
-                : _parent(parent)
-                , _method(method)
-                , _lambda(lambda)
-                , _usercb(usercb)
-            {
-            }
+        using Handle = uint32_t;
+        static constexpr Handle InvalidHandle = 0;
 
-       public:
-            Job() = delete;
-            Job(const Job&) = delete;
-            Job& operator=(const Job&) = delete;
+    private:
+        struct Call {
+            string method;
+            void* usercb;
+            CancellationToken token;
+            // Set while its callback runs, by the thread running it
+            bool running;
+            std::thread::id runner;
+        };
 
-            ~Job() = default;
+        // Shared with the completions of the requests in flight, which may outlive the Async instance
+        class Calls {
+        public:
+            Calls(const Calls&) = delete;
+            Calls& operator=(const Calls&) = delete;
+
+            Calls()
+                : _lock()
+                , _finished()
+                , _calls()
+                , _next(InvalidHandle)
+            {
+            }
+            ~Calls() = default;
 
         public:
-            static WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch> Create(Async& parent, const string& method, const DispatchFunction lambda, void* usercb);
+            Handle Add(const string& method, void* usercb, const CancellationToken& token)
+            {
+                std::lock_guard lck(_lock);
+                do {
+                    ++_next;
+                } while ((_next == InvalidHandle) || (_calls.find(_next) != _calls.end()));
+                _calls.emplace(std::piecewise_construct, std::forward_as_tuple(_next), std::forward_as_tuple(Call { method, usercb, token, false, std::thread::id() }));
+                return _next;
+            }
 
-            void Dispatch() override
+            // Completion side: false if the call got aborted, otherwise it is marked running until Done()
+            bool Start(const Handle handle)
             {
-                _lambda(_parent, _usercb);
+                std::lock_guard lck(_lock);
+                auto index = _calls.find(handle);
+                if (index == _calls.end()) {
+                    return false;
+                }
+                index->second.running = true;
+                index->second.runner = std::this_thread::get_id();
+                return true;
+            }
+            void Done(const Handle handle)
+            {
+                std::lock_guard lck(_lock);
+                _calls.erase(handle);
+                _finished.notify_all();
             }
 
-        private:
-            Async& _parent;
-            string _method;
-            DispatchFunction _lambda;
-            void* _usercb;
-        };
+            // Drops the calls matching, returns the tokens of the ones still waiting for their response.
+            // A callback running on another thread is waited for, not one that aborts its own call.
+            template <typename MATCH>
+            std::vector<CancellationToken> Remove(const MATCH& match)
+            {
+                std::vector<CancellationToken> tokens;
+                std::unique_lock lck(_lock);
+                for (auto index = _calls.begin(); index != _calls.end();) {
+                    if (match(index->first, index->second) == false) {
+                        ++index;
+                    } else if (index->second.running == false) {
+                        tokens.push_back(index->second.token);
+                        index = _calls.erase(index);
+                    } else if (index->second.runner == std::this_thread::get_id()) {
+                        ++index;
+                    } else {
+                        const Handle handle = index->first;
+                        _finished.wait(lck, [this, handle]() { return (_calls.find(handle) == _calls.end()); });
+                        index = _calls.begin();
+                    }
+                }
+                return tokens;
+            }
 
-   public:
-        struct CallbackData {
-            const DispatchFunction lambda;
-            WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch> job;
+        private:
+            std::mutex _lock;
+            std::condition_variable _finished;
+            std::unordered_map<Handle, Call> _calls;
+            Handle _next;
         };
 
-        using CallbackMap = std::map<void*, CallbackData>;
-        using MethodMap = std::map<string, CallbackMap>;
-
-    private:
-        static constexpr uint32_t DefaultWaitTime = WPEFramework::Core::infinite;
-
     public:
         static Async& Instance();
         static void Dispose();
         void Configure(Transport<WPEFramework::Core::JSON::IElement>* transport);
 
     public:
+        // Returns once the request is sent. The callback gets the response or, with an empty one, the failure
+        // (Timedout once waitTime passed, Cancelled if the connection dropped). An aborted call is not reported.
+        // handle, if given, receives the handle of the call for Abort().
         template <typename RESPONSE, typename PARAMETERS, typename CALLBACK>
-        Firebolt::Error Invoke(const string& method, const PARAMETERS& parameters, const CALLBACK& callback, void* usercb, uint32_t waitTime = DefaultWaitTime)
+        Firebolt::Error Invoke(const string& method, const PARAMETERS& parameters, const CALLBACK& callback, void* usercb, uint32_t waitTime = Config::DefaultWaitTime, Handle* handle = nullptr)
         {
-            Firebolt::Error status = Firebolt::Error::None;
-            std::function<void(void* usercb, void* response, Firebolt::Error status)> actualCallback = callback;
-            DispatchFunction lambda = [actualCallback, method, parameters, waitTime](Async& parent, void* usercb) -> Firebolt::Error {
-                RESPONSE response;
-                Firebolt::Error status = Gateway::Instance().Request(method, parameters, response);
-                if (status == Firebolt::Error::None && parent.IsActive(method, usercb) == true) {
-                    WPEFramework::Core::ProxyType<RESPONSE>* jsonResponse = new WPEFramework::Core::ProxyType<RESPONSE>();
-                    *jsonResponse = WPEFramework::Core::ProxyType<RESPONSE>::Create();
-                    (*jsonResponse)->FromString(response);
-                    actualCallback(usercb, jsonResponse, status);
-                    parent.RemoveEntry(method, usercb);
-
+            std::decay_t<CALLBACK> actualCallback(callback);
+            CancellationToken token = CancellationToken::Create();
+            std::shared_ptr<Calls> calls = _calls;
+            const Handle id = calls->Add(method, usercb, token);
+
+            RequestCallback completed = [calls, id, actualCallback, usercb](const Firebolt::Error status, const std::string& result) {
+                if (calls->Start(id) == false) {
+                    // Aborted
+                    return;
                 }
-                return (status);
+                WPEFramework::Core::ProxyType<RESPONSE> jsonResponse = WPEFramework::Core::ProxyType<RESPONSE>::Create();
+                if (status == Firebolt::Error::None) {
+                    jsonResponse->FromString(result);
+                }
+                actualCallback(usercb, &jsonResponse, status);
+                calls->Done(id);
             };
 
-
-            _adminLock.Lock();
-            WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch> job = WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch>(WPEFramework::Core::ProxyType<Async::Job>::Create(*this, method, lambda, usercb));
-            CallbackData callbackData = {lambda, job};
-            MethodMap::iterator index = _methodMap.find(method);
-            if (index != _methodMap.end()) {
-                CallbackMap::iterator callbackIndex = index->second.find(usercb);
-                if (callbackIndex == index->second.end()) {
-                    index->second.emplace(std::piecewise_construct, std::forward_as_tuple(usercb), std::forward_as_tuple(callbackData));
-                }
-            } else {
-                CallbackMap callbackMap;
-                callbackMap.emplace(std::piecewise_construct, std::forward_as_tuple(usercb), std::forward_as_tuple(callbackData));
-                _methodMap.emplace(std::piecewise_construct, std::forward_as_tuple(method), std::forward_as_tuple(callbackMap));
+            Firebolt::Error status = Gateway::Instance().RequestAsync(method, parameters, completed, waitTime, token);
+            if (status != Firebolt::Error::None) {
+                calls->Remove([id](const Handle handle, const Call&) { return (handle == id); });
+            }
+            if (handle != nullptr) {
+                *handle = (status == Firebolt::Error::None ? id : InvalidHandle);
             }
-            _adminLock.Unlock();
-
-            WPEFramework::Core::IWorkerPool::Instance().Submit(job);
-
             return status;
         }
 
+        // Aborts every call of the method made for usercb
         Firebolt::Error Abort(const string& method, void* usercb)
         {
-            RemoveEntry(method, usercb);
+            Cancel(_calls->Remove([&method, usercb](const Handle, const Call& call) { return ((call.usercb == usercb) && (call.method == method)); }));
             return (Firebolt::Error::None);
         }
 
-        void RemoveEntry(const string& method, void* usercb)
+        Firebolt::Error Abort(const Handle handle)
         {
-            _adminLock.Lock();
-            MethodMap::iterator index = _methodMap.find(method);
-            if (index != _methodMap.end()) {
-                CallbackMap::iterator callbackIndex = index->second.find(usercb);
-                if (callbackIndex != index->second.end()) {
-                    if (IsValidJob(callbackIndex->second)) {
-                        WPEFramework::Core::IWorkerPool::Instance().Revoke(callbackIndex->second.job);
-                    }
-                    index->second.erase(callbackIndex);
-                    if (index->second.size() == 0) {
-                        _methodMap.erase(index);
-                    }
-                }
-            }
-            _adminLock.Unlock();
-        }
-
-        bool IsActive(const string& method, void* usercb)
-        {
-            bool valid = false;
-            _adminLock.Lock();
-            MethodMap::iterator index = _methodMap.find(method);
-            if (index != _methodMap.end()) {
-                CallbackMap::iterator callbackIndex = index->second.find(usercb);
-                if (callbackIndex != index->second.end()) {
-                    valid = true;
-                }
-            }
-            _adminLock.Unlock();
-            return valid;
+            Cancel(_calls->Remove([handle](const Handle id, const Call&) { return (id == handle); }));
+            return (Firebolt::Error::None);
         }
 
     private:
         void Clear();
-        inline bool IsValidJob(CallbackData& callbackData) {
-            return (callbackData.job.IsValid());
+        // Outside of any lock, the transport completes the call from within Cancel()
+        static void Cancel(const std::vector<CancellationToken>& tokens)
+        {
+            for (const CancellationToken& token : tokens) {
+                token.Cancel();
+            }
         }
 
     private:
-        MethodMap _methodMap;
-        WPEFramework::Core::CriticalSection _adminLock;
+        std::shared_ptr<Calls> _calls;
 
         static Async* _singleton;
     };
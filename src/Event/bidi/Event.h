@@ -19,6 +19,8 @@
 
 #include "Module.h"
 #include "Gateway/Gateway.h"
+#include "Event/callbacks.h"
+#include "Event/sticky.h"
 
 namespace FireboltSDK {
 
@@ -54,12 +56,79 @@ namespace FireboltSDK {
         template <typename RESULT, typename CALLBACK>
         Firebolt::Error Subscribe(const string& eventName, JsonObject& jsonParameters, const CALLBACK& callback, void* usercb, const void* userdata, bool prioritize = false)
         {
-            return Gateway::Instance().Subscribe<RESULT>(eventName, jsonParameters, callback, usercb, userdata, prioritize);
+            StickyEvents::Callback listener = _sticky.Attach(eventName, usercb, Notifier<RESULT>(eventName, callback, usercb, prioritize));
+            Firebolt::Error status = Gateway::Instance().Subscribe<RESULT>(eventName, jsonParameters, listener, usercb, userdata, prioritize);
+            if (status == Firebolt::Error::None) {
+                _sticky.Replay(eventName, usercb, userdata);
+            } else {
+                _sticky.Detach(eventName, usercb);
+            }
+            return status;
+        }
+
+        // Keeps the event listened to and its last value at hand, a new listener gets it on Subscribe()
+        template <typename RESULT>
+        Firebolt::Error SetSticky(const string& eventName)
+        {
+            if (_sticky.IsSticky(eventName)) {
+                return Firebolt::Error::None;
+            }
+            JsonObject jsonParameters;
+            Firebolt::Error status = Gateway::Instance().Subscribe<RESULT>(eventName, jsonParameters, _sticky.Recorder<RESULT>(eventName), &_sticky, nullptr);
+            if (status == Firebolt::Error::None) {
+                std::function<Firebolt::Error(RESULT&)> getter;
+                string method = StickyEvents::Getter(eventName);
+                if (FindMethod(method) != UnknownMethod) {
+                    getter = [method](RESULT& value) {
+                        return Gateway::Instance().Request(method, JsonObject(), value);
+                    };
+                }
+                _sticky.Enable<RESULT>(eventName, getter);
+            }
+            return status;
+        }
+
+        Firebolt::Error ClearSticky(const string& eventName)
+        {
+            if (!_sticky.Disable(eventName)) {
+                return Firebolt::Error::None;
+            }
+            return Gateway::Instance().Unsubscribe(eventName, &_sticky);
+        }
+
+        // One entry of a batched subscription, the gateway fills in its status
+        using Subscription = Server::Subscription;
+
+        template <typename RESULT, typename CALLBACK>
+        static Subscription MakeSubscription(const string& eventName, const CALLBACK& callback, void* usercb, const void* userdata)
+        {
+            Event& instance = Instance();
+            StickyEvents::Callback listener = instance._sticky.Attach(eventName, usercb, instance.Notifier<RESULT>(eventName, callback, usercb, false));
+            return Subscription{eventName, JsonObject(), Server::Dispatcher<RESULT>(listener), usercb, userdata, Firebolt::Error::General};
+        }
+
+        // Subscribes to all events at once, their listen requests are pipelined rather than sent one round
+        // trip after the other. Returns the first failure, each entry reports its own status.
+        Firebolt::Error SubscribeMany(std::vector<Subscription>& subscriptions)
+        {
+            Firebolt::Error status = Gateway::Instance().SubscribeMany(subscriptions);
+            for (const Subscription& subscription : subscriptions) {
+                if (subscription.status == Firebolt::Error::None) {
+                    _sticky.Replay(subscription.event, subscription.usercb, subscription.userdata);
+                } else {
+                    _sticky.Detach(subscription.event, subscription.usercb);
+                }
+            }
+            return status;
         }
 
         Firebolt::Error Unsubscribe(const string& eventName, void* usercb)
         {
-            return Gateway::Instance().Unsubscribe(eventName);
+            // Notifications are run under the lock the Gateway takes to remove the listener, once it is gone
+            // nothing can be queued for it anymore
+            Firebolt::Error status = Gateway::Instance().Unsubscribe(eventName, usercb);
+            CallbackDispatcher::Instance().Revoke(eventName, usercb);
+            return status;
         }
 
         template <typename RESULT, typename CALLBACK>
@@ -68,5 +137,19 @@ namespace FireboltSDK {
             Firebolt::Error status = Firebolt::Error::General;
             return status;
         }
+
+    private:
+        // The application's listeners are notified through its dispatcher, the SDK's own ones right away
+        template <typename RESULT>
+        StickyEvents::Callback Notifier(const string& eventName, const StickyEvents::Callback& callback, void* usercb, const bool prioritize)
+        {
+            if (prioritize || usercb == &_sticky) {
+                return callback;
+            }
+            return CallbackDispatcher::Instance().Wrap<RESULT>(eventName, callback);
+        }
+
+    private:
+        StickyEvents _sticky;
     };
 }
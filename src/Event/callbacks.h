@@ -0,0 +1,164 @@
+/*
+ * Copyright 2023 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <core/core.h>
+#include "dispatcher.h"
+#include "Event/sticky.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace FireboltSDK
+{
+    // Queues the notifications of the listeners of the application for the IDispatcher it registered, they
+    // are run there in batches: one post is pending at most, whatever comes in meanwhile joins it. Without
+    // a dispatcher, notifications are run right away on the SDK thread that got them.
+    class CallbackDispatcher
+    {
+    private:
+        struct Delivery {
+            std::string event;
+            void* usercb;
+            std::function<void()> run;
+            std::function<void()> drop; // frees the parameters if it does not run
+        };
+
+    public:
+        CallbackDispatcher(const CallbackDispatcher&) = delete;
+        CallbackDispatcher& operator=(const CallbackDispatcher&) = delete;
+
+        static CallbackDispatcher& Instance()
+        {
+            static CallbackDispatcher instance;
+            return instance;
+        }
+
+        // nullptr goes back to delivering on the SDK threads, a batch already posted still runs
+        void Assign(Firebolt::IDispatcher* dispatcher)
+        {
+            std::lock_guard lck(mtx);
+            target = dispatcher;
+        }
+
+        // To be subscribed in place of callback, parameters are a WPEFramework::Core::ProxyType<RESULT>*
+        // owned by callback
+        template <typename RESULT>
+        StickyEvents::Callback Wrap(const std::string& event, const StickyEvents::Callback& callback)
+        {
+            return [this, event, callback](void* usercb, const void* userdata, void* parameters) {
+                Deliver(event, usercb, [callback, usercb, userdata, parameters]() { callback(usercb, userdata, parameters); },
+                    [parameters]() { delete static_cast<WPEFramework::Core::ProxyType<RESULT>*>(parameters); });
+            };
+        }
+
+        // Drops what is still queued for a listener leaving, and waits for a notification of it the dispatcher
+        // runs right now. Unless called from that notification: the thread cannot wait for itself.
+        void Revoke(const std::string& event, void* usercb)
+        {
+            std::deque<Delivery> dropped;
+            {
+                std::unique_lock lck(mtx);
+                for (auto it = queue.begin(); it != queue.end();) {
+                    if (it->usercb == usercb && it->event == event) {
+                        dropped.push_back(std::move(*it));
+                        it = queue.erase(it);
+                    } else {
+                        ++it;
+                    }
+                }
+                finished.wait(lck, [this, &event, usercb]() {
+                    return (running == nullptr) || (runner == std::this_thread::get_id()) || (running->usercb != usercb) || (running->event != event);
+                });
+            }
+            for (Delivery& delivery : dropped) {
+                delivery.drop();
+            }
+        }
+
+    private:
+        CallbackDispatcher() = default;
+
+        void Deliver(const std::string& event, void* usercb, std::function<void()>&& run, std::function<void()>&& drop)
+        {
+            Firebolt::IDispatcher* dispatcher = nullptr;
+            bool queued = false;
+            {
+                std::lock_guard lck(mtx);
+                if (target != nullptr) {
+                    queue.push_back(Delivery{ event, usercb, std::move(run), std::move(drop) });
+                    queued = true;
+                    if (!posted) {
+                        posted = true;
+                        dispatcher = target;
+                    }
+                }
+            }
+            if (!queued) {
+                run();
+            } else if (dispatcher != nullptr) {
+                dispatcher->Post([this]() { Flush(); });
+            }
+        }
+
+        // Runs what was queued by the time the batch started, one at a time so a callback revoking another
+        // listener takes its deliveries out of the batch too. Later ones have a post of their own.
+        void Flush()
+        {
+            size_t count;
+            {
+                std::lock_guard lck(mtx);
+                count = queue.size();
+                posted = false;
+            }
+            while (count-- > 0) {
+                Delivery delivery;
+                {
+                    std::lock_guard lck(mtx);
+                    if (queue.empty()) {
+                        break;
+                    }
+                    delivery = std::move(queue.front());
+                    queue.pop_front();
+                    running = &delivery;
+                    runner = std::this_thread::get_id();
+                }
+                delivery.run();
+                {
+                    std::lock_guard lck(mtx);
+                    running = nullptr;
+                }
+                finished.notify_all();
+            }
+        }
+
+    private:
+        std::mutex mtx;
+        Firebolt::IDispatcher* target = nullptr;
+        std::deque<Delivery> queue;
+        bool posted = false;
+        const Delivery* running = nullptr; // by runner, out of the queue
+        std::thread::id runner;
+        std::condition_variable finished;
+    };
+}
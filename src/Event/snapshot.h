@@ -0,0 +1,251 @@
+/*
+ * Copyright 2024 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace FireboltSDK
+{
+    // Epoch based reclamation. A thread in a read section publishes the epoch it entered at in its own slot,
+    // whatever was unpublished before a later epoch may be freed once no slot shows an older one. Threads
+    // waiting for that sleep, a reader leaving its section wakes them only if there are any.
+    class Epoch
+    {
+        struct Slot {
+            std::atomic<uint64_t> epoch{0}; // 0 while out of any read section
+            std::atomic<bool> taken{false};
+            Slot* next = nullptr;
+        };
+
+        struct Local {
+            Slot* slot = nullptr;
+            uint32_t depth = 0;
+            std::vector<std::pair<uint64_t, std::function<void()>>> deferred;
+
+            ~Local()
+            {
+                if (slot != nullptr) {
+                    slot->taken.store(false);
+                }
+            }
+        };
+
+    public:
+        class Section
+        {
+        public:
+            Section(const Section&) = delete;
+            Section& operator=(const Section&) = delete;
+
+            Section()
+            {
+                Local& local = Self();
+                if (local.depth++ == 0) {
+                    if (local.slot == nullptr) {
+                        local.slot = Acquire();
+                    }
+                    local.slot->epoch.store(Global().load());
+                }
+            }
+            ~Section()
+            {
+                Local& local = Self();
+                if (--local.depth == 0) {
+                    local.slot->epoch.store(0);
+                    if (Waiting().load() != 0) {
+                        // Under the lock, a waiter checks the slots with it held
+                        std::lock_guard lck(Lock());
+                        Left().notify_all();
+                    }
+                    if (local.deferred.empty() == false) {
+                        std::vector<std::pair<uint64_t, std::function<void()>>> deferred;
+                        deferred.swap(local.deferred);
+                        for (auto& reclaim : deferred) {
+                            WaitFor(reclaim.first);
+                            reclaim.second();
+                        }
+                    }
+                }
+            }
+        };
+
+        // Runs reclaim once no read section entered so far is left. Right away, after waiting for the other
+        // threads, unless the calling thread is in a read section itself: it cannot wait for itself, so it
+        // is done when that section is left.
+        static void Retire(std::function<void()>&& reclaim)
+        {
+            uint64_t target = Global().fetch_add(1) + 1;
+            Local& local = Self();
+            if (local.depth > 0) {
+                local.deferred.emplace_back(target, std::move(reclaim));
+            } else {
+                WaitFor(target);
+                reclaim();
+            }
+        }
+
+    private:
+        static std::atomic<uint64_t>& Global()
+        {
+            static std::atomic<uint64_t> epoch{1};
+            return epoch;
+        }
+
+        static std::atomic<Slot*>& Slots()
+        {
+            static std::atomic<Slot*> slots{nullptr};
+            return slots;
+        }
+
+        // The number of threads in WaitFor(), the readers leave their sections without any lock otherwise
+        static std::atomic<uint32_t>& Waiting()
+        {
+            static std::atomic<uint32_t> waiting{0};
+            return waiting;
+        }
+
+        static std::mutex& Lock()
+        {
+            static std::mutex lock;
+            return lock;
+        }
+
+        static std::condition_variable& Left()
+        {
+            static std::condition_variable left;
+            return left;
+        }
+
+        static Local& Self()
+        {
+            static thread_local Local local;
+            return local;
+        }
+
+        // Slots are reused once their thread is gone, never freed
+        static Slot* Acquire()
+        {
+            for (Slot* slot = Slots().load(); slot != nullptr; slot = slot->next) {
+                bool taken = false;
+                if (slot->taken.compare_exchange_strong(taken, true)) {
+                    return slot;
+                }
+            }
+            Slot* slot = new Slot();
+            slot->taken.store(true);
+            slot->next = Slots().load();
+            while (Slots().compare_exchange_weak(slot->next, slot) == false) {
+            }
+            return slot;
+        }
+
+        static void WaitFor(const uint64_t target)
+        {
+            for (Slot* slot = Slots().load(); slot != nullptr; slot = slot->next) {
+                auto left = [slot, target]() {
+                    uint64_t epoch = slot->epoch.load();
+                    return ((epoch == 0) || (epoch >= target));
+                };
+                if (left() == false) {
+                    // Announced before the slot is checked again, a reader leaving after that sees it
+                    std::unique_lock lck(Lock());
+                    Waiting().fetch_add(1);
+                    Left().wait(lck, left);
+                    Waiting().fetch_sub(1);
+                }
+            }
+        }
+    };
+
+    // Read-copy-update of a read-mostly structure: readers get the current snapshot without taking any lock,
+    // writers publish a modified copy and the former one is reclaimed once no reader can see it anymore.
+    template <typename T>
+    class RcuSnapshot
+    {
+    public:
+        RcuSnapshot(const RcuSnapshot&) = delete;
+        RcuSnapshot& operator=(const RcuSnapshot&) = delete;
+
+        RcuSnapshot()
+            : _current(new T())
+        {
+        }
+        ~RcuSnapshot()
+        {
+            delete _current.load();
+        }
+
+        // Pins the snapshot current at construction time, keep it short lived
+        class Reader
+        {
+        public:
+            Reader(const Reader&) = delete;
+            Reader& operator=(const Reader&) = delete;
+
+            Reader(const RcuSnapshot& owner)
+                : _section()
+                , _snapshot(owner._current.load())
+            {
+            }
+            ~Reader() = default;
+
+            const T& operator*() const
+            {
+                return *_snapshot;
+            }
+            const T* operator->() const
+            {
+                return _snapshot;
+            }
+
+        private:
+            Epoch::Section _section;
+            const T* _snapshot;
+        };
+
+        // For writers only, which serialize among themselves
+        const T& Current() const
+        {
+            return *_current.load();
+        }
+
+        // For writers only, returns the former snapshot to be handed over to Retire()
+        std::unique_ptr<const T> Exchange(std::unique_ptr<T> next)
+        {
+            return std::unique_ptr<const T>(_current.exchange(next.release()));
+        }
+
+        // Blocks until the readers of other threads left their sections: not to be called with a lock held
+        // that a reader may take, that would never return
+        static void Retire(std::unique_ptr<const T> former)
+        {
+            const T* snapshot = former.release();
+            Epoch::Retire([snapshot]() { delete snapshot; });
+        }
+
+    private:
+        std::atomic<T*> _current;
+    };
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright 2024 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <core/core.h>
+#include "error.h"
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace FireboltSDK
+{
+    // Keeps the last value of the events put in sticky mode, parsed the way their listeners get it. A
+    // listener subscribing to such an event is handed that value right away instead of having to call the
+    // getter, which is only done while no value has been seen yet. Events are sticky whatever their
+    // subscription parameters, this is meant for the "...Changed" events of properties.
+    class StickyEvents
+    {
+    public:
+        using Callback = std::function<void(void* usercb, const void* userdata, void* parameters)>;
+
+    private:
+        using Value = std::shared_ptr<void>; // a WPEFramework::Core::ProxyType<RESULT>
+        using Deliver = std::function<void(const Value& value, const Callback& callback, void* usercb, const void* userdata)>;
+        using Seed = std::function<Value()>;
+
+        // A listener waiting for its replay, a notification reaching it first makes the replay moot
+        struct Listener {
+            std::mutex mtx;
+            bool delivered = false;
+            Callback callback;
+        };
+
+        struct Entry {
+            Value value;
+            Deliver deliver;
+            Seed seed;
+            std::map<void*, std::shared_ptr<Listener>> pending;
+        };
+
+    public:
+        // module.onFooChanged notifies what module.foo answers, empty if the event does not follow that scheme
+        static std::string Getter(const std::string& event)
+        {
+            static constexpr char Prefix[] = "on";
+            static constexpr char Suffix[] = "Changed";
+            constexpr size_t prefixLength = sizeof(Prefix) - 1;
+            constexpr size_t suffixLength = sizeof(Suffix) - 1;
+
+            std::string getter;
+            size_t dot = event.find('.');
+            if (dot != std::string::npos && event.size() > dot + 1 + prefixLength + suffixLength &&
+                event.compare(dot + 1, prefixLength, Prefix) == 0 &&
+                event.compare(event.size() - suffixLength, suffixLength, Suffix) == 0) {
+                getter = event.substr(0, dot + 1);
+                getter.append(event, dot + 1 + prefixLength, event.size() - suffixLength - dot - 1 - prefixLength);
+                getter[dot + 1] = std::tolower(getter[dot + 1]);
+            }
+            return getter;
+        }
+
+        // getter may be empty, new listeners then wait for the first notification
+        template <typename RESULT>
+        void Enable(const std::string& event, const std::function<Firebolt::Error(RESULT& value)>& getter)
+        {
+            using Proxy = WPEFramework::Core::ProxyType<RESULT>;
+
+            Entry entry;
+            entry.deliver = [](const Value& value, const Callback& callback, void* usercb, const void* userdata) {
+                // Same ownership as a notification, the callback gets its own reference on the shared value
+                Proxy* parameters = new Proxy(*static_cast<Proxy*>(value.get()));
+                callback(usercb, userdata, static_cast<void*>(parameters));
+            };
+            if (getter != nullptr) {
+                entry.seed = [getter]() -> Value {
+                    std::shared_ptr<Proxy> value = std::make_shared<Proxy>(Proxy::Create());
+                    if (getter(**value) != Firebolt::Error::None) {
+                        return nullptr;
+                    }
+                    return value;
+                };
+            }
+
+            std::lock_guard lck(mtx);
+            entries.emplace(event, std::move(entry));
+        }
+
+        // Returns true if the event was sticky
+        bool Disable(const std::string& event)
+        {
+            std::lock_guard lck(mtx);
+            return (entries.erase(event) > 0);
+        }
+
+        bool IsSticky(const std::string& event) const
+        {
+            std::lock_guard lck(mtx);
+            return (entries.find(event) != entries.end());
+        }
+
+        // Callback of the listener keeping the value of the event up to date
+        template <typename RESULT>
+        Callback Recorder(const std::string& event)
+        {
+            return [this, event](void* /* usercb */, const void* /* userdata */, void* parameters) {
+                Value value(static_cast<WPEFramework::Core::ProxyType<RESULT>*>(parameters));
+                std::lock_guard lck(mtx);
+                auto it = entries.find(event);
+                if (it != entries.end()) {
+                    it->second.value = std::move(value);
+                }
+            };
+        }
+
+        // To be subscribed in place of callback, Replay() or Detach() follow once the subscription is done
+        Callback Attach(const std::string& event, void* usercb, const Callback& callback)
+        {
+            std::lock_guard lck(mtx);
+            auto it = entries.find(event);
+            if (it == entries.end()) {
+                return callback;
+            }
+            std::shared_ptr<Listener> listener = std::make_shared<Listener>();
+            listener->callback = callback;
+            it->second.pending[usercb] = listener;
+            return [listener](void* usercb, const void* userdata, void* parameters) {
+                std::lock_guard lck(listener->mtx);
+                listener->delivered = true;
+                listener->callback(usercb, userdata, parameters);
+            };
+        }
+
+        void Detach(const std::string& event, void* usercb)
+        {
+            std::lock_guard lck(mtx);
+            auto it = entries.find(event);
+            if (it != entries.end()) {
+                it->second.pending.erase(usercb);
+            }
+        }
+
+        // Hands the last value to a listener just subscribed, synchronously
+        void Replay(const std::string& event, void* usercb, const void* userdata)
+        {
+            std::shared_ptr<Listener> listener;
+            Value value;
+            Deliver deliver;
+            Seed seed;
+            {
+                std::lock_guard lck(mtx);
+                auto it = entries.find(event);
+                if (it == entries.end()) {
+                    return;
+                }
+                auto pending = it->second.pending.find(usercb);
+                if (pending == it->second.pending.end()) {
+                    return;
+                }
+                listener = pending->second;
+                it->second.pending.erase(pending);
+                value = it->second.value;
+                deliver = it->second.deliver;
+                seed = it->second.seed;
+            }
+
+            if (value == nullptr && seed != nullptr) {
+                // Nothing seen yet, the only round trip sticky mode cannot spare
+                Value seeded = seed();
+                std::lock_guard lck(mtx);
+                auto it = entries.find(event);
+                if (it != entries.end()) {
+                    if (it->second.value == nullptr) {
+                        it->second.value = seeded;
+                    }
+                    value = it->second.value;
+                }
+            }
+
+            if (value != nullptr) {
+                std::lock_guard lck(listener->mtx);
+                if (!listener->delivered) {
+                    listener->delivered = true;
+                    deliver(value, listener->callback, usercb, userdata);
+                }
+            }
+        }
+
+    private:
+        std::map<std::string, Entry> entries;
+        mutable std::mutex mtx;
+    };
+}
@@ -22,9 +22,11 @@
 namespace FireboltSDK {
     Event* Event::_singleton = nullptr;
     Event::Event()
-        : _internalEventMap()
-        , _externalEventMap()
+        : _eventMaps()
         , _adminLock()
+        , _subscriptions(Config::UnsubscribeGracePeriod)
+        , _transport(nullptr)
+        , _sticky()
     {
         ASSERT(_singleton == nullptr);
         _singleton = this;
@@ -53,22 +55,39 @@ namespace FireboltSDK {
 
     void Event::Configure(Transport<WPEFramework::Core::JSON::IElement>* transport)
     {
+        _transport = transport;
         transport->SetEventHandler(this);
     }
 
     Firebolt::Error Event::Unsubscribe(const string& eventName, void* usercb)
     {
-        Firebolt::Error status = Revoke(eventName, usercb);
-
-        if (status == Firebolt::Error::None) {
-            const string parameters("{\"listen\":false}");
-            status = Gateway::Instance().Unsubscribe(eventName, parameters);
-        } else {
-            status = Firebolt::Error::None;
+        // Gone from the event maps first, Revoke() waits for the dispatches which may still see the listener.
+        // Only then can nothing be queued for it anymore.
+        bool idle = false;
+        Firebolt::Error status = Revoke(eventName, usercb, idle);
+        CallbackDispatcher::Instance().Revoke(eventName, usercb);
+        uint64_t dropAt = 0;
+
+        if (status == Firebolt::Error::None && idle == true && _subscriptions.Release(eventName, dropAt) == true) {
+            if (dropAt == 0) {
+                const string parameters("{\"listen\":false}");
+                status = Gateway::Instance().Unsubscribe(eventName, parameters);
+            } else if (_transport != nullptr) {
+                // Dropped by Timed() unless a listener comes back in the meantime
+                _transport->ScheduleTimeout(dropAt);
+            }
         }
         return status;
     }
 
+    uint64_t Event::Timed(const uint64_t currentTime) /* override */
+    {
+        return _subscriptions.Expire(currentTime, [](const string& eventName) {
+            const string parameters("{\"listen\":false}");
+            Gateway::Instance().Unsubscribe(eventName, parameters);
+        });
+    }
+
     Firebolt::Error Event::ValidateResponse(const WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message>& jsonResponse, bool& enabled) /* override */
     {
         Firebolt::Error result = Firebolt::Error::General;
@@ -82,109 +101,110 @@ namespace FireboltSDK {
     }
     
     
-    /* This function combines both internal and external event maps, and iterates over them to find the specified event.
-       If the event is found, it iterates over its associated callbacks, updating their states and executing them if applicable.
-       Callbacks in the REVOKED state are removed. 
+    Firebolt::Error Event::Assign(const bool prioritize, const string& eventName, DispatchFunction&& implementation, void* usercb, const void* userdata)
+    {
+        Firebolt::Error status = Firebolt::Error::General;
+        std::unique_ptr<const EventMaps> former;
+
+        _adminLock.Lock();
+        const EventMap& eventMap = prioritize ? _eventMaps.Current().internal : _eventMaps.Current().external;
+        EventMap::const_iterator eventIndex = eventMap.find(eventName);
+        if ((eventIndex == eventMap.end()) || (eventIndex->second.find(usercb) == eventIndex->second.end())) {
+            std::cout << "Registering new callback for event: " << eventName << std::endl;
+            std::unique_ptr<EventMaps> next(new EventMaps(_eventMaps.Current()));
+            CallbackMap& callbacks = (prioritize ? next->internal : next->external)[eventName];
+            callbacks.emplace(usercb, std::make_shared<CallbackData>(std::move(implementation), userdata));
+            former = _eventMaps.Exchange(std::move(next));
+            status = Firebolt::Error::None;
+        }
+        _adminLock.Unlock();
+
+        if (former != nullptr) {
+            RcuSnapshot<EventMaps>::Retire(std::move(former));
+        }
+        return status;
+    }
+
+    /* Runs the callbacks of the event from both the internal and the external event maps, as found in the
+       current snapshot, without taking any lock. A callback revoked meanwhile is skipped, Revoke() waits for
+       the ones already running.
     */
     Firebolt::Error Event::Dispatch(const string& eventName, const WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message>& jsonResponse) /* override */
     {
         string response = jsonResponse->Result.Value();
-        std::vector<EventMap*> eventMaps = {&_internalEventMap, &_externalEventMap};
+        RcuSnapshot<EventMaps>::Reader eventMaps(_eventMaps);
 
-        // Combine both _internalEventMap and _externalEventMap into a single loop
-        for (auto eventMap : eventMaps) {        
-            _adminLock.Lock();
-            EventMap::iterator eventIndex = eventMap->find(eventName);
+        for (const EventMap* eventMap : { &eventMaps->internal, &eventMaps->external }) {
+            EventMap::const_iterator eventIndex = eventMap->find(eventName);
             if (eventIndex != eventMap->end()) {
-                CallbackMap& callbacks = eventIndex->second;
-                for (CallbackMap::iterator callbackIndex = callbacks.begin(); callbackIndex != callbacks.end();) {
-                    State state;
-                    if (callbackIndex->second.state != State::REVOKED) {
-                        callbackIndex->second.state = State::EXECUTING;
-                    }
-                    state = callbackIndex->second.state;
-                    _adminLock.Unlock();
-                    if (state == State::EXECUTING) {
-                        callbackIndex->second.lambda(callbackIndex->first, callbackIndex->second.userdata, response);
-                    }
-                    _adminLock.Lock();
-                    if (callbackIndex->second.state == State::REVOKED) {
-                        callbackIndex = callbacks.erase(callbackIndex);
-                        if (callbacks.empty()) {
-                            eventMap->erase(eventIndex); // Erase from the correct eventMap
-                            break; // No need to continue iterating if map is empty
-                        }
-                    } else {
-                        callbackIndex->second.state = State::IDLE;
-                        ++callbackIndex;
+                for (const auto& callback : eventIndex->second) {
+                    if (callback.second->revoked.load() == false) {
+                        callback.second->lambda(callback.first, callback.second->userdata, response);
                     }
                 }
             }
-            _adminLock.Unlock();
         }
         return Firebolt::Error::None;
     }
 
-
-    Firebolt::Error Event::Revoke(const string& eventName, void* usercb)
+    /* Publishes the event maps without the callback and waits for the dispatches which may still see it, once
+       done the callback does not run anymore. Called from a callback nothing is waited for, as the calling
+       thread cannot wait for itself: the revoked flag keeps later dispatches from running the callback and the
+       former maps are reclaimed once the callback returned. Fails if the callback was not listening to the event,
+       idle tells whether it was the last one that was.
+    */
+    Firebolt::Error Event::Revoke(const string& eventName, void* usercb, bool& idle)
     {
-        Firebolt::Error status = Firebolt::Error::None;
-
-        // Combine both _internalEventMap and _externalEventMap into a single loop
-        std::vector<EventMap*> eventMaps = {&_internalEventMap, &_externalEventMap};
-
-        for (auto eventMap : eventMaps) { 
-            _adminLock.Lock(); // Lock inside the loop
-
-            // Find the eventIndex for eventName in the current eventMap
+        Firebolt::Error status = Firebolt::Error::General;
+        std::unique_ptr<const EventMaps> former;
+        idle = false;
+
+        _adminLock.Lock();
+        std::unique_ptr<EventMaps> next(new EventMaps(_eventMaps.Current()));
+        bool found = false;
+        for (EventMap* eventMap : { &next->internal, &next->external }) {
             EventMap::iterator eventIndex = eventMap->find(eventName);
             if (eventIndex != eventMap->end()) {
-                // Find the callbackIndex for usercb in the current CallbackMap
                 CallbackMap::iterator callbackIndex = eventIndex->second.find(usercb);
                 if (callbackIndex != eventIndex->second.end()) {
-                    // Check if callback is not executing, then erase it
-                    if (callbackIndex->second.state != State::EXECUTING) {
-                        eventIndex->second.erase(callbackIndex);
-                    } else {
-                        // Mark the callback as revoked
-                        callbackIndex->second.state = State::REVOKED;
-                    }
+                    callbackIndex->second->revoked.store(true);
+                    eventIndex->second.erase(callbackIndex);
+                    found = true;
 
-                    // Check if the CallbackMap is empty after potential erasure
                     if (eventIndex->second.empty()) {
                         eventMap->erase(eventIndex);
-                    } else {
-                        // Set status to General error if CallbackMap is not empty
-                        status = Firebolt::Error::General;
                     }
                 }
             }
-
-            _adminLock.Unlock(); // Unlock after processing each eventMap
         }
+        if (found) {
+            status = Firebolt::Error::None;
+            // The internal and the external listeners share the wire subscription
+            idle = (next->internal.find(eventName) == next->internal.end()) && (next->external.find(eventName) == next->external.end());
+            former = _eventMaps.Exchange(std::move(next));
+        }
+        _adminLock.Unlock();
 
+        if (former != nullptr) {
+            RcuSnapshot<EventMaps>::Retire(std::move(former));
+        }
         return status;
     }
 
     void Event::Clear()
     {
-        // Clear both _internalEventMap and _externalEventMap
-        std::vector<EventMap*> eventMaps = {&_internalEventMap, &_externalEventMap};
-
-        for (auto eventMap : eventMaps) { 
-            _adminLock.Lock(); // Lock before clearing
-
-            EventMap::iterator eventIndex = eventMap->begin();
-            while (eventIndex != eventMap->end()) {
-                CallbackMap::iterator callbackIndex = eventIndex->second.begin();
-                while (callbackIndex != eventIndex->second.end()) {
-                    callbackIndex = eventIndex->second.erase(callbackIndex);
+        _adminLock.Lock();
+        for (const EventMap* eventMap : { &_eventMaps.Current().internal, &_eventMaps.Current().external }) {
+            for (const auto& event : *eventMap) {
+                for (const auto& callback : event.second) {
+                    callback.second->revoked.store(true);
                 }
-                eventIndex = eventMap->erase(eventIndex);
             }
-
-            _adminLock.Unlock(); // Unlock after clearing
         }
+        std::unique_ptr<const EventMaps> former = _eventMaps.Exchange(std::unique_ptr<EventMaps>(new EventMaps()));
+        _adminLock.Unlock();
+
+        RcuSnapshot<EventMaps>::Retire(std::move(former));
     }
 
 }
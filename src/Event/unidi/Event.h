@@ -20,27 +20,50 @@
 
 #include "Module.h"
 #include "Gateway/Gateway.h"
+#include "Gateway/function.h"
+#include "Event/callbacks.h"
+#include "Event/snapshot.h"
+#include "Event/sticky.h"
 
 namespace FireboltSDK
 {
     class Event : public IEventHandler {
     public:
-        typedef std::function<Firebolt::Error(void*, const void*, const string& parameters)> DispatchFunction;
-    private:
-        enum State : uint8_t {
-            IDLE,
-            EXECUTING,
-            REVOKED
-        };
+        typedef InplaceFunction<Firebolt::Error(void*, const void*, const string& parameters)> DispatchFunction;
 
+        // One entry of a batched subscription, status is filled in with the outcome of the entry
+        struct Subscription {
+            string event;
+            JsonObject parameters;
+            DispatchFunction dispatch;
+            void* usercb;
+            const void* userdata;
+            Firebolt::Error status;
+        };
+    private:
         struct CallbackData {
+            CallbackData(DispatchFunction&& lambda, const void* userdata)
+                : lambda(std::move(lambda))
+                , userdata(userdata)
+                , revoked(false)
+            {
+            }
+
             const DispatchFunction lambda;
             const void* userdata;
-            State state;
+            std::atomic<bool> revoked; // for the snapshots still being dispatched
         };
-        using CallbackMap = std::map<void*, CallbackData>;
+        using CallbackMap = std::map<void*, std::shared_ptr<CallbackData>>;
+        // Keyed by name, not MethodId: the transport matches notifications on the id of their listen request
+        // and hands over the name that request was sent with
         using EventMap = std::map<string, CallbackMap>;
 
+        // Never modified once published, Dispatch() reads them without taking any lock
+        struct EventMaps {
+            EventMap internal;
+            EventMap external;
+        };
+
         class Response : public WPEFramework::Core::JSON::Container {
         public:
             Response& operator=(const Response&) = delete;
@@ -83,11 +106,12 @@ namespace FireboltSDK
         {
             Firebolt::Error status = Firebolt::Error::General;
 
-            EventMap& eventMap = prioritize ? _internalEventMap : _externalEventMap;
-            
-            status = Assign<RESULT, CALLBACK>(eventMap, eventName, callback, usercb, userdata);
+            StickyEvents::Callback listener = _sticky.Attach(eventName, usercb, Notifier<RESULT>(eventName, callback, usercb, prioritize));
 
-            if (status == Firebolt::Error::None) {
+            status = Assign<RESULT>(prioritize, eventName, listener, usercb, userdata);
+
+            // The event might be listened to on the wire already, once the request on its way if any made it
+            if (status == Firebolt::Error::None && _subscriptions.Acquire(eventName) == true) {
                 Response response;
                 WPEFramework::Core::JSON::Variant Listen = true;
                 jsonParameters.Set(_T("listen"), Listen);
@@ -97,14 +121,51 @@ namespace FireboltSDK
                 status = Gateway::Instance().Subscribe<Response>(eventName, parameters, response);
 
                 if (status != Firebolt::Error::None) {
-                    Revoke(eventName, usercb);
-                } else if (response.Listening.IsSet() && response.Listening.Value()) {
-                    status = Firebolt::Error::None;
+                    bool idle;
+                    _subscriptions.Abandon(eventName);
+                    Revoke(eventName, usercb, idle);
+                } else {
+                    _subscriptions.Confirm(eventName);
                 }
             }
+            if (status == Firebolt::Error::None) {
+                _sticky.Replay(eventName, usercb, userdata);
+            } else {
+                _sticky.Detach(eventName, usercb);
+            }
         return status;
         }
 
+        // Keeps the event listened to and its last value at hand, a new listener gets it on Subscribe()
+        template <typename RESULT>
+        Firebolt::Error SetSticky(const string& eventName)
+        {
+            if (_sticky.IsSticky(eventName)) {
+                return Firebolt::Error::None;
+            }
+            JsonObject jsonParameters;
+            Firebolt::Error status = Subscribe<RESULT>(eventName, jsonParameters, _sticky.Recorder<RESULT>(eventName), &_sticky, nullptr);
+            if (status == Firebolt::Error::None) {
+                std::function<Firebolt::Error(RESULT&)> getter;
+                string method = StickyEvents::Getter(eventName);
+                if (FindMethod(method) != UnknownMethod) {
+                    getter = [method](RESULT& value) {
+                        return Gateway::Instance().Request(method, JsonObject(), value);
+                    };
+                }
+                _sticky.Enable<RESULT>(eventName, getter);
+            }
+            return status;
+        }
+
+        Firebolt::Error ClearSticky(const string& eventName)
+        {
+            if (!_sticky.Disable(eventName)) {
+                return Firebolt::Error::None;
+            }
+            return Unsubscribe(eventName, &_sticky);
+        }
+
         // To prioritize internal and external events and its corresponding callbacks
         template <typename RESULT, typename CALLBACK>
         Firebolt::Error Prioritize(const string& eventName,JsonObject& jsonParameters, const CALLBACK& callback, void* usercb, const void* userdata)
@@ -116,56 +177,144 @@ namespace FireboltSDK
         }
 
 
+        template <typename RESULT, typename CALLBACK>
+        static Subscription MakeSubscription(const string& eventName, const CALLBACK& callback, void* usercb, const void* userdata)
+        {
+            Event& instance = Instance();
+            StickyEvents::Callback listener = instance._sticky.Attach(eventName, usercb, instance.Notifier<RESULT>(eventName, callback, usercb, false));
+            return Subscription{eventName, JsonObject(), Dispatcher<RESULT>(listener), usercb, userdata, Firebolt::Error::General};
+        }
+
+        // Subscribes to all events at once, their listen requests are pipelined rather than sent one round
+        // trip after the other. Returns the first failure, each entry reports its own status. Events with a
+        // request of another caller on its way are waited for once this batch is done with its own.
+        Firebolt::Error SubscribeMany(std::vector<Subscription>& subscriptions)
+        {
+            std::vector<std::pair<string, string>> requests;
+            std::vector<size_t> pending;
+            std::vector<size_t> busy;
+            requests.reserve(subscriptions.size());
+            pending.reserve(subscriptions.size());
+            for (size_t i = 0; i < subscriptions.size(); ++i) {
+                Subscription& subscription = subscriptions[i];
+                subscription.status = Assign(false, subscription.event, std::move(subscription.dispatch), subscription.usercb, subscription.userdata);
+                if (subscription.status == Firebolt::Error::None) {
+                    switch (_subscriptions.TryAcquire(subscription.event)) {
+                    case WireSubscriptions::Claim::Send:
+                        requests.emplace_back(subscription.event, ListenParameters(subscription.parameters));
+                        pending.push_back(i);
+                        break;
+                    case WireSubscriptions::Claim::Busy:
+                        busy.push_back(i);
+                        break;
+                    default:
+                        break;
+                    }
+                }
+            }
+
+            std::vector<Firebolt::Error> statuses;
+            Gateway::Instance().SubscribeMany<Response>(requests, statuses);
+
+            for (size_t i = 0; i < pending.size(); ++i) {
+                Subscription& subscription = subscriptions[pending[i]];
+                subscription.status = statuses[i];
+                Settle(subscription);
+            }
+            // Holding none of the requests anymore, waiting cannot block the callers these events wait for
+            for (const size_t index : busy) {
+                Subscription& subscription = subscriptions[index];
+                if (_subscriptions.Acquire(subscription.event) == true) {
+                    Response response;
+                    subscription.status = Gateway::Instance().Subscribe<Response>(subscription.event, ListenParameters(subscription.parameters), response);
+                    Settle(subscription);
+                }
+            }
+
+            Firebolt::Error result = Firebolt::Error::None;
+            for (const Subscription& subscription : subscriptions) {
+                if (subscription.status == Firebolt::Error::None) {
+                    _sticky.Replay(subscription.event, subscription.usercb, subscription.userdata);
+                } else {
+                    _sticky.Detach(subscription.event, subscription.usercb);
+                    if (result == Firebolt::Error::None) {
+                        result = subscription.status;
+                    }
+                }
+            }
+            return result;
+        }
+
+        // Returns once the callback does not run anymore, it waits for the notifications being dispatched:
+        // not to be called with a lock held that a callback takes, unless from within a callback
         Firebolt::Error Unsubscribe(const string& eventName, void* usercb);
 
     private:
+        static string ListenParameters(JsonObject& parameters)
+        {
+            WPEFramework::Core::JSON::Variant Listen = true;
+            parameters.Set(_T("listen"), Listen);
+            string text;
+            parameters.ToString(text);
+            return text;
+        }
+
+        // Confirms the wire subscription of an entry whose listen request made it, drops the entry otherwise
+        void Settle(Subscription& subscription)
+        {
+            if (subscription.status != Firebolt::Error::None) {
+                bool idle;
+                _subscriptions.Abandon(subscription.event);
+                Revoke(subscription.event, subscription.usercb, idle);
+            } else {
+                _subscriptions.Confirm(subscription.event);
+            }
+        }
+
+        // The application's listeners are notified through its dispatcher, the SDK's own ones right away
+        template <typename RESULT>
+        StickyEvents::Callback Notifier(const string& eventName, const StickyEvents::Callback& callback, void* usercb, const bool prioritize)
+        {
+            if (prioritize || usercb == &_sticky) {
+                return callback;
+            }
+            return CallbackDispatcher::Instance().Wrap<RESULT>(eventName, callback);
+        }
+
         template <typename PARAMETERS, typename CALLBACK>
-        Firebolt::Error Assign(EventMap& eventMap, const string& eventName, const CALLBACK& callback, void* usercb, const void* userdata)
+        static DispatchFunction Dispatcher(const CALLBACK& callback)
         {
-            
-            Firebolt::Error status = Firebolt::Error::General;
-            std::function<void(void* usercb, const void* userdata, void* parameters)> actualCallback = callback;
-            DispatchFunction implementation = [actualCallback](void* usercb, const void* userdata, const string& parameters) -> Firebolt::Error {
+            std::decay_t<CALLBACK> actualCallback(callback);
+            return [actualCallback](void* usercb, const void* userdata, const string& parameters) -> Firebolt::Error {
                 WPEFramework::Core::ProxyType<PARAMETERS>* inbound = new WPEFramework::Core::ProxyType<PARAMETERS>();
                 *inbound = WPEFramework::Core::ProxyType<PARAMETERS>::Create();
                 (*inbound)->FromString(parameters);
                 actualCallback(usercb, userdata, static_cast<void*>(inbound));
                 return (Firebolt::Error::None);
             };
-            CallbackData callbackData = {implementation, userdata, State::IDLE};
-            _adminLock.Lock();
-            EventMap::iterator eventIndex = eventMap.find(eventName);
-            if (eventIndex != eventMap.end()) {
-                CallbackMap::iterator callbackIndex = eventIndex->second.find(usercb);
-               
-                if (callbackIndex == eventIndex->second.end()) {
-                     std::cout << "Registering new callback for event: " << eventName << std::endl;
-                    eventIndex->second.emplace(std::piecewise_construct, std::forward_as_tuple(usercb), std::forward_as_tuple(callbackData));
-                    status = Firebolt::Error::None;
-                }
-            } else {
-
-                CallbackMap callbackMap;
-                callbackMap.emplace(std::piecewise_construct, std::forward_as_tuple(usercb), std::forward_as_tuple(callbackData));
-                eventMap.emplace(std::piecewise_construct, std::forward_as_tuple(eventName), std::forward_as_tuple(callbackMap));
-                status = Firebolt::Error::None;
-
-            }
+        }
 
-            _adminLock.Unlock();
-            return status;
+        template <typename PARAMETERS, typename CALLBACK>
+        Firebolt::Error Assign(const bool prioritize, const string& eventName, const CALLBACK& callback, void* usercb, const void* userdata)
+        {
+            return Assign(prioritize, eventName, Dispatcher<PARAMETERS>(callback), usercb, userdata);
         }
-        Firebolt::Error Revoke(const string& eventName, void* usercb);
+
+        Firebolt::Error Assign(const bool prioritize, const string& eventName, DispatchFunction&& implementation, void* usercb, const void* userdata);
+        Firebolt::Error Revoke(const string& eventName, void* usercb, bool& idle);
 
     private:
         void Clear();
         Firebolt::Error ValidateResponse(const WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message>& jsonResponse, bool& enabled) override;
         Firebolt::Error Dispatch(const string& eventName, const WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message>& jsonResponse) override;
+        uint64_t Timed(const uint64_t currentTime) override;
  
     private: 
-        EventMap _internalEventMap;
-        EventMap _externalEventMap;
-        WPEFramework::Core::CriticalSection _adminLock;
+        RcuSnapshot<EventMaps> _eventMaps;
+        WPEFramework::Core::CriticalSection _adminLock; // serializes the writers of _eventMaps
+        WireSubscriptions _subscriptions;
+        Transport<WPEFramework::Core::JSON::IElement>* _transport;
+        StickyEvents _sticky;
 
         static Event* _singleton;
     };
@@ -19,6 +19,9 @@
 #pragma once
 
 #include "Transport/Transport.h"
+#include "Gateway/arena.h"
+#include "Gateway/jsonwriter.h"
+#include "Gateway/jsonreader.h"
 #include "Properties/Properties.h"
 #include "Accessor/Accessor.h"
 #include "Async/Async.h"
@@ -29,6 +29,8 @@
 
 #include <functional>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #ifdef GATEWAY_BIDIRECTIONAL
 #include "bidi/gateway_impl.h"
@@ -57,10 +59,27 @@ namespace FireboltSDK
 
         void TransportUpdated(Transport<WPEFramework::Core::JSON::IElement>* transport);
 
+        // waitTime is the deadline of the call in ms, Config::DefaultWaitTime picks the default of the method.
+        // Cancelling the token wakes the caller up with Firebolt::Error::Cancelled.
         template <typename RESPONSE>
-        Firebolt::Error Request(const std::string &method, const JsonObject &parameters, RESPONSE &response)
+        Firebolt::Error Request(const std::string &method, const JsonObject &parameters, RESPONSE &response, const uint32_t waitTime = Config::DefaultWaitTime, const CancellationToken& token = CancellationToken())
         {
-            return implementation->Request(method, parameters, response);
+            return implementation->Request(method, parameters, response, waitTime, token);
+        }
+
+        // Same, with the parameters already serialized, as a JsonWriter produces them
+        template <typename RESPONSE>
+        Firebolt::Error Request(const std::string &method, const std::string_view parameters, RESPONSE &response, const uint32_t waitTime = Config::DefaultWaitTime, const CancellationToken& token = CancellationToken())
+        {
+            return implementation->Request(method, parameters, response, waitTime, token);
+        }
+
+        // Returns without waiting for the response, completed is called once with the outcome: from the thread
+        // dispatching the response, noticing the timeout or cancelling the token. It is not called when the
+        // request could not be sent, that error is returned instead.
+        Firebolt::Error RequestAsync(const std::string &method, const JsonObject &parameters, const RequestCallback &completed, const uint32_t waitTime = Config::DefaultWaitTime, const CancellationToken& token = CancellationToken())
+        {
+            return implementation->RequestAsync(method, parameters, completed, waitTime, token);
         }
 
 #ifdef GATEWAY_BIDIRECTIONAL
@@ -70,9 +89,14 @@ namespace FireboltSDK
             return implementation->Subscribe<RESULT>(event, parameters, callback, usercb, userdata, prioritize);
         }
 
-        Firebolt::Error Unsubscribe(const std::string& event)
+        Firebolt::Error SubscribeMany(std::vector<Server::Subscription>& subscriptions)
         {
-            return implementation->Unsubscribe(event);
+            return implementation->SubscribeMany(subscriptions);
+        }
+
+        Firebolt::Error Unsubscribe(const std::string& event, void* usercb = nullptr)
+        {
+            return implementation->Unsubscribe(event, usercb);
         }
 #else
         template <typename RESPONSE>
@@ -81,6 +105,12 @@ namespace FireboltSDK
             return implementation->Subscribe(event, parameters, response);
         }
 
+        template <typename RESPONSE>
+        Firebolt::Error SubscribeMany(const std::vector<std::pair<string, string>>& requests, std::vector<Firebolt::Error>& statuses)
+        {
+            return implementation->template SubscribeMany<RESPONSE>(requests, statuses);
+        }
+
         Firebolt::Error Unsubscribe(const string& event, const string& parameters)
         {
             return implementation->Unsubscribe(event, parameters);
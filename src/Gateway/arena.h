@@ -0,0 +1,139 @@
+/*
+ * Copyright 2023 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+namespace FireboltSDK
+{
+    // Monotonic memory for the temporaries of one request or event: what is allocated while it is the
+    // innermost arena of the thread is released in one go when it goes out of scope. Optional: helpers
+    // allocate through Arena::Resource(), the heap when no arena is open. Only what dies with the call may
+    // come from it, never what is handed over to another thread or to the application.
+    class Arena
+    {
+    public:
+        static constexpr size_t InlineSize = 2048;
+
+        struct Statistics
+        {
+            uint32_t allocations; // served by the arena
+            uint32_t blocks;      // taken from the heap once the inline block was used up
+            size_t bytes;
+        };
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        Arena()
+            : _counted(this)
+            , _upstream(this)
+            , _monotonic(_inline, sizeof(_inline), &_upstream)
+            , _statistics()
+            , _previous(_current)
+        {
+            _current = this;
+        }
+        ~Arena()
+        {
+            _current = _previous;
+        }
+
+    public:
+        static std::pmr::memory_resource* Resource()
+        {
+            return ((_current != nullptr) ? &_current->_counted : std::pmr::new_delete_resource());
+        }
+        static Arena* Current()
+        {
+            return (_current);
+        }
+        const Statistics& Stats() const
+        {
+            return (_statistics);
+        }
+
+    private:
+        class Counted : public std::pmr::memory_resource
+        {
+        public:
+            explicit Counted(Arena* parent)
+                : _parent(*parent)
+            {
+            }
+
+        private:
+            void* do_allocate(const size_t bytes, const size_t alignment) override
+            {
+                ++_parent._statistics.allocations;
+                _parent._statistics.bytes += bytes;
+                return (_parent._monotonic.allocate(bytes, alignment));
+            }
+            void do_deallocate(void*, size_t, size_t) override
+            {
+            }
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+            {
+                return (this == &other);
+            }
+
+        private:
+            Arena& _parent;
+        };
+
+        class Upstream : public std::pmr::memory_resource
+        {
+        public:
+            explicit Upstream(Arena* parent)
+                : _parent(*parent)
+            {
+            }
+
+        private:
+            void* do_allocate(const size_t bytes, const size_t alignment) override
+            {
+                ++_parent._statistics.blocks;
+                return (std::pmr::new_delete_resource()->allocate(bytes, alignment));
+            }
+            void do_deallocate(void* pointer, const size_t bytes, const size_t alignment) override
+            {
+                std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+            }
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+            {
+                return (this == &other);
+            }
+
+        private:
+            Arena& _parent;
+        };
+
+    private:
+        alignas(std::max_align_t) std::byte _inline[InlineSize];
+        Counted _counted;
+        Upstream _upstream;
+        std::pmr::monotonic_buffer_resource _monotonic;
+        Statistics _statistics;
+        Arena* _previous;
+
+        static inline thread_local Arena* _current = nullptr;
+    };
+}
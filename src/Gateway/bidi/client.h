@@ -24,15 +24,17 @@
 #include "error.h"
 
 #include "../common.h"
+#include "Logger/Logger.h"
 
 #include "Transport/Transport.h"
+#include "Transport/executor.h"
 
 #include <chrono>
 #include <condition_variable>
 #include <map>
 #include <mutex>
 #include <string>
-#include <thread>
+#include <vector>
 
 namespace FireboltSDK
 {
@@ -40,18 +42,21 @@ namespace FireboltSDK
     {
         struct Caller
         {
-            Caller(MessageID id_)
+            Caller(MessageID id_, uint64_t expiry_)
                 : id(id_)
-                , timestamp(std::chrono::steady_clock::now())
+                , expiry(expiry_)
             {}
 
             MessageID id;
-            Timestamp timestamp;
+            uint64_t expiry; // Core::Time ticks, 0 if the call has no deadline
             std::string response;
             Firebolt::Error error = Firebolt::Error::None;
             bool ready = false;
             std::mutex mtx;
             std::condition_variable waiter;
+            // Set for a call nobody waits for, run instead of waking the waiter up
+            RequestCallback completed;
+            CancellationToken token;
         };
 
         std::map <MessageID, std::shared_ptr<Caller>> queue;
@@ -59,45 +64,11 @@ namespace FireboltSDK
         Transport<WPEFramework::Core::JSON::IElement>* transport;
         Config config;
 
-        std::atomic<bool> running { false };
-        std::thread watchdogThread;
-
-        void watchdog()
-        {
-            auto watchdogTimer = std::chrono::milliseconds(config.watchdogCycle_ms);
-            std::vector<std::shared_ptr<Caller>> outdated;
-
-            while (running) {
-                Timestamp now = std::chrono::steady_clock::now();
-                {
-                    std::lock_guard lck(queue_mtx);
-                    for (auto it = queue.begin(); it != queue.end();) {
-                        if (std::chrono::duration_cast<std::chrono::milliseconds>(now - it->second->timestamp).count() > config.watchdogThreshold_ms) {
-                            outdated.push_back(it->second);
-                            it = queue.erase(it);
-                        } else {
-                            ++it;
-                        }
-                    }
-                }
-                for (auto &c : outdated) {
-                    std::unique_lock<std::mutex> lk(c->mtx);
-                    std::cout << "Watchdog : message-id: " << c->id << " - timed out" << std::endl;
-                    c->ready = true;
-                    c->error = Firebolt::Error::Timedout;
-                    c->waiter.notify_one();
-                }
-                outdated.clear();
-                std::this_thread::sleep_for(watchdogTimer);
-            }
-        }
-
     public:
         Client(const Config &config_)
-          : config(config_)
+          : transport(nullptr)
+          , config(config_)
         {
-            running = true;
-            watchdogThread = std::thread(std::bind(&Client::watchdog, this));
         }
 
         void SetTransport(Transport<WPEFramework::Core::JSON::IElement>* transport)
@@ -105,56 +76,224 @@ namespace FireboltSDK
             this->transport = transport;
         }
 
-        virtual ~Client()
+        virtual ~Client() = default;
+
+#ifdef UNIT_TEST
+        template <typename RESPONSE, typename PARAMETERS>
+        Firebolt::Error Request(const std::string &method, const PARAMETERS &parameters, RESPONSE &response, const uint32_t waitTime = Config::DefaultWaitTime, const CancellationToken& token = CancellationToken())
         {
-            running = false;
-            if (watchdogThread.joinable()) {
-                watchdogThread.join();
+            if (token.IsCancelled()) {
+                return Firebolt::Error::Cancelled;
             }
+            std::cout << "Inside Mock Request() function, event: " << method << std::endl;
+            return Firebolt::Error::None;
         }
 
-#ifdef UNIT_TEST
-        template <typename RESPONSE>
-        Firebolt::Error Request(const std::string &method, const JsonObject &parameters, RESPONSE &response)
+        Firebolt::Error RequestAsync(const std::string &method, const JsonObject &parameters, const RequestCallback &completed, const uint32_t waitTime = Config::DefaultWaitTime, const CancellationToken& token = CancellationToken())
         {
+            if (token.IsCancelled()) {
+                return Firebolt::Error::Cancelled;
+            }
             std::cout << "Inside Mock Request() function, event: " << method << std::endl;
+            completed(Firebolt::Error::None, std::string());
             return Firebolt::Error::None;
         }
-#else
+
         template <typename RESPONSE>
-        Firebolt::Error Request(const std::string &method, const JsonObject &parameters, RESPONSE &response)
+        Firebolt::Error RequestMany(const std::vector<std::pair<std::string, std::string>> &requests, std::vector<RESPONSE> &responses, std::vector<Firebolt::Error> &statuses)
+        {
+            responses.resize(requests.size());
+            statuses.assign(requests.size(), Firebolt::Error::None);
+            for (const auto &request : requests) {
+                std::cout << "Inside Mock RequestMany() function, event: " << request.first << std::endl;
+            }
+            return Firebolt::Error::None;
+        }
+#else
+        template <typename RESPONSE, typename PARAMETERS>
+        Firebolt::Error Request(const std::string &method, const PARAMETERS &parameters, RESPONSE &response, const uint32_t waitTime = Config::DefaultWaitTime, const CancellationToken& token = CancellationToken())
         {
             if (transport == nullptr) {
                 return Firebolt::Error::NotConnected;
             }
+            uint32_t deadline = config.WaitTime(method, waitTime);
+            uint64_t expiry = (deadline != Config::InfiniteWaitTime) ? WPEFramework::Core::Time::Now().Add(deadline).Ticks() : 0;
+
             MessageID id = transport->GetNextMessageID();
-            std::shared_ptr<Caller> c = std::make_shared<Caller>(id);
+            std::shared_ptr<Caller> c = std::make_shared<Caller>(id, expiry);
             {
                 std::lock_guard lck(queue_mtx);
                 queue[id] = c;
             }
+            if (!token.Bind([this, id]() { Cancel(id); })) {
+                std::lock_guard lck(queue_mtx);
+                queue.erase(id);
+                return Firebolt::Error::Cancelled;
+            }
+            if (expiry != 0) {
+                transport->ScheduleTimeout(expiry);
+            }
 
             Firebolt::Error result = transport->Send(method, parameters, id);
             if (result == Firebolt::Error::None) {
-                {
-                    std::unique_lock<std::mutex> lk(c->mtx);
-                    c->waiter.wait(lk, [&]{ return c->ready; });
-                    {
-                        std::lock_guard lck(queue_mtx);
-                        queue.erase(c->id);
-                    }
-                }
+                Wait(c);
                 if (c->error == Firebolt::Error::None) {
                     response.FromString(c->response);
                 } else {
                     result = c->error;
                 }
             }
+            token.Unbind();
+            {
+                std::lock_guard lck(queue_mtx);
+                queue.erase(id);
+            }
+
+            return result;
+        }
+
+        // Does not block: completed runs once, on the thread delivering the response, noticing the timeout
+        // or cancelling the token. It is not run if the request could not be sent, the error is returned then.
+        Firebolt::Error RequestAsync(const std::string &method, const JsonObject &parameters, const RequestCallback &completed, const uint32_t waitTime = Config::DefaultWaitTime, const CancellationToken& token = CancellationToken())
+        {
+            if (transport == nullptr) {
+                return Firebolt::Error::NotConnected;
+            }
+            uint32_t deadline = config.WaitTime(method, waitTime);
+            uint64_t expiry = (deadline != Config::InfiniteWaitTime) ? WPEFramework::Core::Time::Now().Add(deadline).Ticks() : 0;
+
+            MessageID id = transport->GetNextMessageID();
+            std::shared_ptr<Caller> c = std::make_shared<Caller>(id, expiry);
+            c->completed = completed;
+            c->token = token;
+            {
+                std::lock_guard lck(queue_mtx);
+                queue[id] = c;
+            }
+            if (!token.Bind([this, id]() { Cancel(id); })) {
+                std::lock_guard lck(queue_mtx);
+                queue.erase(id);
+                return Firebolt::Error::Cancelled;
+            }
+            if (expiry != 0) {
+                transport->ScheduleTimeout(expiry);
+            }
+
+            Firebolt::Error result = transport->Send(method, parameters, id);
+            if (result != Firebolt::Error::None) {
+                token.Unbind();
+                std::lock_guard lck(queue_mtx);
+                queue.erase(id);
+            }
+            return result;
+        }
+
+        // Pipelines the requests: all of them are sent before waiting for the first response, so a batch
+        // costs about one round trip. Returns the first failure, statuses holds the outcome of each request.
+        template <typename RESPONSE>
+        Firebolt::Error RequestMany(const std::vector<std::pair<std::string, std::string>> &requests, std::vector<RESPONSE> &responses, std::vector<Firebolt::Error> &statuses)
+        {
+            responses.resize(requests.size());
+            statuses.assign(requests.size(), Firebolt::Error::NotConnected);
+            if (transport == nullptr) {
+                return Firebolt::Error::NotConnected;
+            }
+
+            std::vector<std::shared_ptr<Caller>> callers;
+            callers.reserve(requests.size());
+            uint64_t firstExpiry = 0;
+            for (const auto &request : requests) {
+                uint32_t deadline = config.WaitTime(request.first);
+                uint64_t expiry = (deadline != Config::InfiniteWaitTime) ? WPEFramework::Core::Time::Now().Add(deadline).Ticks() : 0;
+                if (expiry != 0 && (firstExpiry == 0 || expiry < firstExpiry)) {
+                    firstExpiry = expiry;
+                }
+                MessageID id = transport->GetNextMessageID();
+                callers.push_back(std::make_shared<Caller>(id, expiry));
+            }
+            {
+                std::lock_guard lck(queue_mtx);
+                for (const auto &c : callers) {
+                    queue[c->id] = c;
+                }
+            }
+            if (firstExpiry != 0) {
+                transport->ScheduleTimeout(firstExpiry);
+            }
+
+            for (size_t i = 0; i < requests.size(); ++i) {
+                statuses[i] = transport->Send(requests[i].first, requests[i].second, callers[i]->id);
+            }
+
+            Firebolt::Error result = Firebolt::Error::None;
+            for (size_t i = 0; i < requests.size(); ++i) {
+                auto &c = callers[i];
+                if (statuses[i] == Firebolt::Error::None) {
+                    Wait(c);
+                    if (c->error == Firebolt::Error::None) {
+                        responses[i].FromString(c->response);
+                    } else {
+                        statuses[i] = c->error;
+                    }
+                }
+                if (result == Firebolt::Error::None) {
+                    result = statuses[i];
+                }
+            }
+            {
+                std::lock_guard lck(queue_mtx);
+                for (const auto &c : callers) {
+                    queue.erase(c->id);
+                }
+            }
 
             return result;
         }
 #endif
 
+        // Releases the slot of a pending request and wakes its caller up, a late response is dropped
+        void Cancel(MessageID id)
+        {
+            std::shared_ptr<Caller> c;
+            {
+                std::lock_guard lck(queue_mtx);
+                auto it = queue.find(id);
+                if (it == queue.end()) {
+                    return;
+                }
+                c = it->second;
+                queue.erase(it);
+            }
+            Complete(c, Firebolt::Error::Cancelled);
+        }
+
+        // Driven by the transport timer, fails the callers whose deadline has passed
+        uint64_t Timed(const uint64_t currentTime)
+        {
+            uint64_t next = 0;
+            std::vector<std::shared_ptr<Caller>> outdated;
+            {
+                std::lock_guard lck(queue_mtx);
+                for (auto it = queue.begin(); it != queue.end();) {
+                    uint64_t expiry = it->second->expiry;
+                    if (expiry != 0 && expiry <= currentTime) {
+                        outdated.push_back(it->second);
+                        it = queue.erase(it);
+                    } else {
+                        if (expiry != 0 && (next == 0 || expiry < next)) {
+                            next = expiry;
+                        }
+                        ++it;
+                    }
+                }
+            }
+            for (auto &c : outdated) {
+                FIREBOLT_LOG_WARNING(Logger::Category::OpenRPC, Logger::Module<Client>(), "Request %u timed out", c->id);
+                Complete(c, Firebolt::Error::Timedout);
+            }
+            return next;
+        }
+
         bool IdRequested(MessageID id)
         {
             std::lock_guard lck(queue_mtx);
@@ -164,20 +303,58 @@ namespace FireboltSDK
         void Response(const WPEFramework::Core::JSONRPC::Message& message)
         {
             MessageID id = message.Id.Value();
-            try {
+            std::shared_ptr<Caller> c;
+            {
                 std::lock_guard lck(queue_mtx);
-                auto c = queue.at(id);
-                std::unique_lock<std::mutex> lk(c->mtx);
-
-                if (!message.Error.IsSet()) {
-                    c->response = message.Result.Value();
-                } else {
-                    c->error = static_cast<Firebolt::Error>(message.Error.Code.Value());
+                auto it = queue.find(id);
+                if (it == queue.end()) {
+                    // Timed out or cancelled already
+                    return;
+                }
+                c = it->second;
+                if (c->completed) {
+                    // No caller waits to take it out of the queue
+                    queue.erase(it);
                 }
+            }
+            if (!message.Error.IsSet()) {
+                Complete(c, Firebolt::Error::None, message.Result.Value());
+            } else {
+                Complete(c, static_cast<Firebolt::Error>(message.Error.Code.Value()));
+            }
+        }
+
+    private:
+        void Wait(const std::shared_ptr<Caller> &c)
+        {
+            std::unique_lock<std::mutex> lk(c->mtx);
+            if (c->expiry == 0 || CallerExecutor::Instance() == nullptr) {
+                c->waiter.wait(lk, [&]{ return c->ready; });
+                return;
+            }
+            // Timeouts are noticed from Process(), which the application may be blocked from calling by this very wait
+            uint64_t now = WPEFramework::Core::Time::Now().Ticks();
+            std::chrono::microseconds remaining((c->expiry > now) ? (c->expiry - now) : 0);
+            if (!c->waiter.wait_for(lk, remaining, [&]{ return c->ready; })) {
+                c->error = Firebolt::Error::Timedout;
+                c->ready = true;
+            }
+        }
+
+        // The caller left the queue already if it has a completion, which then runs outside of any lock
+        void Complete(const std::shared_ptr<Caller> &c, const Firebolt::Error error, const std::string &response = std::string())
+        {
+            if (c->completed) {
+                c->token.Unbind();
+                CallerExecutor::Deliver([completed = c->completed, error, response]() { completed(error, response); });
+                return;
+            }
+            std::unique_lock<std::mutex> lk(c->mtx);
+            if (!c->ready) {
+                c->response = response;
+                c->error = error;
                 c->ready = true;
                 c->waiter.notify_one();
-            } catch (const std::out_of_range &e) {
-                std::cout << "No receiver for message-id: " << id << std::endl;
             }
         }
     };
@@ -30,6 +30,7 @@
 #include "server.h"
 
 #include <string>
+#include <vector>
 
 namespace FireboltSDK
 {
@@ -59,6 +60,7 @@ namespace FireboltSDK
         Config config;
         Client client;
         Server server;
+        WireSubscriptions subscriptions;
         Transport<WPEFramework::Core::JSON::IElement>* transport;
 
         std::string jsonObject2String(const JsonObject &obj) {
@@ -71,6 +73,8 @@ namespace FireboltSDK
         GatewayImpl()
           : client(config)
           , server(config)
+          , subscriptions(Config::UnsubscribeGracePeriod)
+          , transport(nullptr)
         {
         }
 
@@ -86,23 +90,47 @@ namespace FireboltSDK
         virtual void Receive(const WPEFramework::Core::JSONRPC::Message& message) override
         {
             if (message.Designator.IsSet()) { // designator -> method
+                InboundMessage::Parse(message);
                 if (message.Id.IsSet()) {
                     server.Request(transport, message.Id.Value(), message.Designator.Value(), message.Parameters.Value());
                 } else {
                     server.Notify(message.Designator.Value(), message.Parameters.Value());
                 }
-            } else {
+            } else if (client.IdRequested(message.Id.Value())) {
+                // A response nobody waits for anymore is dropped unparsed
+                InboundMessage::Parse(message);
                 client.Response(message);
             }
         }
 
-        template <typename RESPONSE>
-        Firebolt::Error Request(const std::string &method, const JsonObject &parameters, RESPONSE &response)
+        virtual uint64_t Timed(const uint64_t currentTime) override
+        {
+            uint64_t next = client.Timed(currentTime);
+            uint64_t drop = subscriptions.Expire(currentTime, [this](const std::string& event) {
+                // Nobody waits for the answer, the client drops it as unknown
+                transport->Send(event, std::string("{\"listen\":false}"), transport->GetNextMessageID());
+            });
+            if (drop != 0 && (next == 0 || drop < next)) {
+                next = drop;
+            }
+            return next;
+        }
+
+        template <typename RESPONSE, typename PARAMETERS>
+        Firebolt::Error Request(const std::string &method, const PARAMETERS &parameters, RESPONSE &response, const uint32_t waitTime = Config::DefaultWaitTime, const CancellationToken& token = CancellationToken())
         {
             if (transport == nullptr) {
                 return Firebolt::Error::NotConnected;
             }
-            return client.Request(method, parameters, response);
+            return client.Request(method, parameters, response, waitTime, token);
+        }
+
+        Firebolt::Error RequestAsync(const std::string &method, const JsonObject &parameters, const RequestCallback &completed, const uint32_t waitTime = Config::DefaultWaitTime, const CancellationToken& token = CancellationToken())
+        {
+            if (transport == nullptr) {
+                return Firebolt::Error::NotConnected;
+            }
+            return client.RequestAsync(method, parameters, completed, waitTime, token);
         }
 
         template <typename RESULT, typename CALLBACK>
@@ -113,7 +141,8 @@ namespace FireboltSDK
             }
 
             Firebolt::Error status = server.Subscribe<RESULT>(event, parameters, callback, usercb, userdata);
-            if (status != Firebolt::Error::None) {
+            if (status != Firebolt::Error::None || !subscriptions.Acquire(event)) {
+                // Failed, or the event is listened to on the wire already, once the request on its way if any made it
                 return status;
             }
 
@@ -124,15 +153,108 @@ namespace FireboltSDK
                 status == Firebolt::Error::General;
             }
             if (status != Firebolt::Error::None) {
-                server.Unsubscribe(event);
+                bool idle;
+                subscriptions.Abandon(event);
+                server.Unsubscribe(event, usercb, idle);
+            } else {
+                subscriptions.Confirm(event);
             }
             return status;
         }
 
-        Firebolt::Error Unsubscribe(const string& event)
+        // Registers every callback first, then sends all the listen requests still needed in one go. Events
+        // with a request of another caller on its way are waited for once this batch is done with its own.
+        Firebolt::Error SubscribeMany(std::vector<Server::Subscription>& entries)
         {
-            Firebolt::Error status = server.Unsubscribe(event);
-            if (status != Firebolt::Error::None) {
+            if (transport == nullptr) {
+                return Firebolt::Error::NotConnected;
+            }
+
+            std::vector<std::pair<std::string, std::string>> requests;
+            std::vector<size_t> pending;
+            std::vector<size_t> busy;
+            requests.reserve(entries.size());
+            pending.reserve(entries.size());
+            for (size_t i = 0; i < entries.size(); ++i) {
+                Server::Subscription& subscription = entries[i];
+                subscription.status = server.Subscribe(subscription.event, std::move(subscription.dispatch), subscription.usercb, subscription.userdata);
+                if (subscription.status == Firebolt::Error::None) {
+                    switch (subscriptions.TryAcquire(subscription.event)) {
+                    case WireSubscriptions::Claim::Send:
+                        subscription.parameters.Set(_T("listen"), WPEFramework::Core::JSON::Variant(true));
+                        requests.emplace_back(subscription.event, jsonObject2String(subscription.parameters));
+                        pending.push_back(i);
+                        break;
+                    case WireSubscriptions::Claim::Busy:
+                        busy.push_back(i);
+                        break;
+                    default:
+                        break;
+                    }
+                }
+            }
+
+            std::vector<ListeningResponse> responses;
+            std::vector<Firebolt::Error> statuses;
+            client.RequestMany(requests, responses, statuses);
+
+            for (size_t i = 0; i < pending.size(); ++i) {
+                Server::Subscription& subscription = entries[pending[i]];
+                subscription.status = statuses[i];
+                if (subscription.status == Firebolt::Error::None && responses[i].Listening.IsSet() && !responses[i].Listening.Value()) {
+                    subscription.status = Firebolt::Error::General;
+                }
+                if (subscription.status != Firebolt::Error::None) {
+                    bool idle;
+                    subscriptions.Abandon(subscription.event);
+                    server.Unsubscribe(subscription.event, subscription.usercb, idle);
+                } else {
+                    subscriptions.Confirm(subscription.event);
+                }
+            }
+            // Holding none of the requests anymore, waiting cannot block the callers these events wait for
+            for (const size_t index : busy) {
+                Server::Subscription& subscription = entries[index];
+                if (subscriptions.Acquire(subscription.event)) {
+                    subscription.parameters.Set(_T("listen"), WPEFramework::Core::JSON::Variant(true));
+                    ListeningResponse response;
+                    subscription.status = client.Request(subscription.event, jsonObject2String(subscription.parameters), response);
+                    if (subscription.status == Firebolt::Error::None && response.Listening.IsSet() && !response.Listening.Value()) {
+                        subscription.status = Firebolt::Error::General;
+                    }
+                    if (subscription.status != Firebolt::Error::None) {
+                        bool idle;
+                        subscriptions.Abandon(subscription.event);
+                        server.Unsubscribe(subscription.event, subscription.usercb, idle);
+                    } else {
+                        subscriptions.Confirm(subscription.event);
+                    }
+                }
+            }
+
+            Firebolt::Error result = Firebolt::Error::None;
+            for (const Server::Subscription& subscription : entries) {
+                if (subscription.status != Firebolt::Error::None) {
+                    result = subscription.status;
+                    break;
+                }
+            }
+            return result;
+        }
+
+        Firebolt::Error Unsubscribe(const string& event, void* usercb = nullptr)
+        {
+            bool idle = false;
+            Firebolt::Error status = server.Unsubscribe(event, usercb, idle);
+            uint64_t dropAt = 0;
+            if (status != Firebolt::Error::None || !idle || !subscriptions.Release(event, dropAt)) {
+                return status;
+            }
+            if (dropAt != 0) {
+                // Sent by Timed() unless a listener comes back in the meantime
+                if (transport != nullptr) {
+                    transport->ScheduleTimeout(dropAt);
+                }
                 return status;
             }
             JsonObject parameters;
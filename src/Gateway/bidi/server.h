@@ -26,49 +26,103 @@
 #include "Transport/Transport.h"
 
 #include "../common.h"
+#include "../function.h"
 
-#include <string>
+#include <algorithm>
 #include <map>
-#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 #include <mutex>
 
 namespace FireboltSDK
 {
     class Server
     {
-        using DispatchFunctionEvent = std::function<void(void*, const void*, const string& parameters)>;
+    public:
+        using DispatchFunctionEvent = InplaceFunction<void(void*, const void*, const string& parameters)>;
 
+        // One entry of a batched subscription, status is filled in with the outcome of the entry
+        struct Subscription {
+            std::string event;
+            JsonObject parameters;
+            DispatchFunctionEvent dispatch;
+            void* usercb;
+            const void* userdata;
+            Firebolt::Error status;
+        };
+
+    private:
         struct CallbackDataEvent {
-            const DispatchFunctionEvent lambda;
+            DispatchFunctionEvent lambda;
             void* usercb;
             const void* userdata;
         };
 
-        using EventMap = std::map<std::string, CallbackDataEvent>;
+        using Listeners = std::map<void*, CallbackDataEvent>;
+
+        // Keyed by the id the notification name resolves to. That is the id of the event, unless the name is a
+        // method of its own: capabilities.onAvailable is notified as capabilities.available.
+        using EventMap = std::unordered_map<MethodId, Listeners>;
+        // Events missing from the method table, keyed by the name they are notified with
+        using NamedEventMap = std::unordered_map<std::string, Listeners>;
 
         EventMap eventMap;
+        NamedEventMap namedEventMap;
         mutable std::mutex eventMap_mtx;
 
-        using DispatchFunctionProvider = std::function<std::string(const std::string &parameters, void*)>;
+        using DispatchFunctionProvider = InplaceFunction<std::string(const std::string &parameters, void*)>;
 
         struct Method {
-            std::string name;
-            JsonObject parameters;
             DispatchFunctionProvider lambda;
-            void* usercb;
+            void* usercb = nullptr;
         };
 
-        struct Interface {
-            std::string name;
-            std::list<Method> methods;
-        };
+        // Keyed by "<interface>.<method>", the way requests designate them. Shared with the requests being
+        // served, which run the provider once out of the lock.
+        using ProviderMap = std::unordered_map<std::string, std::vector<std::shared_ptr<const Method>>>;
 
-        std::map<std::string, Interface> providers;
+        ProviderMap providers;
         mutable std::mutex providers_mtx;
 
+        static constexpr const char ParametersPrefix[] = "{ \"parameters\":";
+
+        class ProviderJob : public WPEFramework::Core::IDispatch
+        {
+        protected:
+            ProviderJob(Transport<WPEFramework::Core::JSON::IElement>* transport, const unsigned id, std::shared_ptr<const Method>&& provider, std::string&& parameters)
+                : _transport(transport)
+                , _id(id)
+                , _provider(std::move(provider))
+                , _parameters(std::move(parameters))
+            {
+            }
+
+        public:
+            ProviderJob() = delete;
+            ProviderJob(const ProviderJob&) = delete;
+            ProviderJob& operator=(const ProviderJob&) = delete;
+
+            ~ProviderJob() = default;
+
+        public:
+            void Dispatch() override
+            {
+                std::string response = _provider->lambda(_parameters, _provider->usercb);
+                _transport->SendResponse(_id, response);
+            }
+
+        private:
+            Transport<WPEFramework::Core::JSON::IElement>* _transport;
+            const unsigned _id;
+            const std::shared_ptr<const Method> _provider;
+            const std::string _parameters;
+        };
+
         Config config;
 
-        std::string getKeyFromEvent(const std::string &event)
+        static std::string getKeyFromEvent(const std::string &event)
         {
             std::string key = event;
             size_t dotPos = key.find('.');
@@ -79,6 +133,39 @@ namespace FireboltSDK
             return key;
         }
 
+        // Must be called with eventMap_mtx held
+        template <typename MAP>
+        static Firebolt::Error removeListener(MAP& map, const typename MAP::key_type& key, void* usercb, bool& idle)
+        {
+            Firebolt::Error status = Firebolt::Error::General;
+            typename MAP::iterator eventIndex = map.find(key);
+            idle = (eventIndex == map.end());
+            if (!idle && eventIndex->second.erase(usercb) > 0) {
+                status = Firebolt::Error::None;
+                if (eventIndex->second.empty()) {
+                    map.erase(eventIndex);
+                    idle = true;
+                }
+            }
+            return status;
+        }
+
+        static void notifyListeners(Listeners& listeners, const std::string &parameters)
+        {
+            for (auto& listener : listeners) {
+                CallbackDataEvent& callback = listener.second;
+                callback.lambda(callback.usercb, callback.userdata, parameters);
+            }
+        }
+
+        static std::string providerKey(const std::string &interface, const std::string &method)
+        {
+            std::string key;
+            key.reserve(interface.size() + 1 + method.size());
+            key.append(interface).append(1, '.').append(method);
+            return key;
+        }
+
     public:
         Server(const Config &config_)
           : config(config_)
@@ -89,81 +176,99 @@ namespace FireboltSDK
         {
             std::lock_guard lck(eventMap_mtx);
             eventMap.clear();
+            namedEventMap.clear();
         }
 
         template <typename RESULT, typename CALLBACK>
-        Firebolt::Error Subscribe(const std::string& event, JsonObject& parameters, const CALLBACK& callback, void* usercb, const void* userdata)
+        static DispatchFunctionEvent Dispatcher(const CALLBACK& callback)
         {
-            Firebolt::Error status = Firebolt::Error::General;
-
-            std::function<void(void* usercb, const void* userdata, void* parameters)> actualCallback = callback;
-            DispatchFunctionEvent implementation = [actualCallback](void* usercb, const void* userdata, const string& parameters) {
+            std::decay_t<CALLBACK> actualCallback(callback);
+            return [actualCallback](void* usercb, const void* userdata, const string& parameters) {
                 WPEFramework::Core::ProxyType<RESULT>* inbound = new WPEFramework::Core::ProxyType<RESULT>();
                 *inbound = WPEFramework::Core::ProxyType<RESULT>::Create();
                 (*inbound)->FromString(parameters);
                 actualCallback(usercb, userdata, static_cast<void*>(inbound));
             };
-            CallbackDataEvent callbackData = {implementation, usercb, userdata};
+        }
 
-            std::string key = getKeyFromEvent(event);
+        template <typename RESULT, typename CALLBACK>
+        Firebolt::Error Subscribe(const std::string& event, JsonObject& parameters, const CALLBACK& callback, void* usercb, const void* userdata)
+        {
+            return Subscribe(event, Dispatcher<RESULT>(callback), usercb, userdata);
+        }
+
+        Firebolt::Error Subscribe(const std::string& event, DispatchFunctionEvent&& implementation, void* usercb, const void* userdata)
+        {
+            Firebolt::Error status = Firebolt::Error::General;
+
+            std::string name = getKeyFromEvent(event);
+            MethodId key = FindMethod(name);
 
             std::lock_guard lck(eventMap_mtx);
-            EventMap::iterator eventIndex = eventMap.find(key);
-            if (eventIndex == eventMap.end()) {
-                eventMap.emplace(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(callbackData));
+            Listeners& listeners = (key != UnknownMethod ? eventMap[key] : namedEventMap[name]);
+            if (listeners.find(usercb) == listeners.end()) {
+                listeners.emplace(usercb, CallbackDataEvent{std::move(implementation), usercb, userdata});
                 status = Firebolt::Error::None;
             }
 
             return status;
         }
 
-        Firebolt::Error Unsubscribe(const std::string& event)
+        // idle tells whether that was the last listener of the event
+        Firebolt::Error Unsubscribe(const std::string& event, void* usercb, bool& idle)
         {
+            std::string name = getKeyFromEvent(event);
+            MethodId key = FindMethod(name);
             std::lock_guard lck(eventMap_mtx);
-            return eventMap.erase(getKeyFromEvent(event)) > 0 ? Firebolt::Error::None : Firebolt::Error::General;
+            if (key != UnknownMethod) {
+                return removeListener(eventMap, key, usercb, idle);
+            }
+            return removeListener(namedEventMap, name, usercb, idle);
         }
 
         void Notify(const std::string &method, const std::string &parameters)
         {
-            std::string key = method;
+            MethodId key = FindMethod(method);
             std::lock_guard lck(eventMap_mtx);
-            EventMap::iterator eventIt = eventMap.find(method);
-            if (eventIt != eventMap.end()) {
-                CallbackDataEvent& callback = eventIt->second;
-                callback.lambda(callback.usercb, callback.userdata, parameters);
+            if (key != UnknownMethod) {
+                EventMap::iterator eventIt = eventMap.find(key);
+                if (eventIt != eventMap.end()) {
+                    notifyListeners(eventIt->second, parameters);
+                }
+            } else {
+                NamedEventMap::iterator eventIt = namedEventMap.find(method);
+                if (eventIt != namedEventMap.end()) {
+                    notifyListeners(eventIt->second, parameters);
+                }
             }
         }
 
+        // The provider is run by a job of its own, on the worker pool or the application's executor, which sends
+        // the response as well. A slow provider holds up neither the thread dispatching the inbound messages nor
+        // the other providers, and it runs without any lock held.
         void Request(Transport<WPEFramework::Core::JSON::IElement>* transport, unsigned id, const std::string &method, const std::string &parameters)
         {
-            size_t dotPos = method.find('.');
-            if (dotPos == std::string::npos) {
-                return;
-            }
-            std::string interface = method.substr(0, dotPos);;
-            std::string methodName = method.substr(dotPos + 1);
-            std::lock_guard lck(providers_mtx);
-            auto provider = providers.find(interface);
-            if (provider == providers.end()) {
-                return;
-            }
-            auto& methods = provider->second.methods;
-            auto it = methods.begin();
-            while (it != methods.end()) {
-                it = std::find_if(it, methods.end(), [&methodName](const Method &m) { return m.name == methodName; });
-                if (it != methods.end()) {
-                    std::string response = it->lambda("{ \"parameters\":" + parameters + "}", it->usercb);
-                    transport->SendResponse(id, response);
-                    break;
+            std::shared_ptr<const Method> provider;
+            {
+                std::lock_guard lck(providers_mtx);
+                auto it = providers.find(method);
+                if (it == providers.end() || it->second.empty()) {
+                    return;
                 }
+                provider = it->second.front();
             }
+
+            std::string wrapped;
+            wrapped.reserve(sizeof(ParametersPrefix) + parameters.size() + 1);
+            wrapped.append(ParametersPrefix, sizeof(ParametersPrefix) - 1).append(parameters).push_back('}');
+
+            WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch> job(WPEFramework::Core::ProxyType<ProviderJob>::Create(transport, id, std::move(provider), std::move(wrapped)));
+            WPEFramework::Core::IWorkerPool::Instance().Submit(job);
         }
 
         template <typename RESPONSE, typename PARAMETERS, typename CALLBACK>
         Firebolt::Error RegisterProviderInterface(const std::string &fullMethod, const PARAMETERS &parameters, const CALLBACK &callback, void* usercb)
         {
-            uint32_t waitTime = config.DefaultWaitTime;
-
             size_t dotPos = fullMethod.find('.');
             std::string interface = fullMethod.substr(0, dotPos);
             std::string method = fullMethod.substr(dotPos + 1);
@@ -172,48 +277,42 @@ namespace FireboltSDK
                 method.erase(0, 2); // erase "on"
             }
 
-            std::function<std::string(void* usercb, void* params)> actualCallback = callback;
-            DispatchFunctionProvider lambda = [actualCallback, method, waitTime](const std::string &params, void* usercb) {
+            std::decay_t<CALLBACK> actualCallback(callback);
+            DispatchFunctionProvider lambda = [actualCallback](const std::string &params, void* usercb) {
                 WPEFramework::Core::ProxyType<RESPONSE>* jsonParams = new WPEFramework::Core::ProxyType<RESPONSE>();
                 *jsonParams = WPEFramework::Core::ProxyType<RESPONSE>::Create();
                 (*jsonParams)->FromString(params);
                 return actualCallback(usercb, jsonParams);
             };
+            std::string key = providerKey(interface, method);
+
             std::lock_guard lck(providers_mtx);
-            if (providers.find(interface) == providers.end()) {
-                Interface i = {
-                    .name = interface,
-                };
-                i.methods.push_back({
-                    .name = method,
-                    .lambda = lambda,
+            auto &methods = providers[key];
+            auto it = std::find_if(methods.begin(), methods.end(), [usercb](const std::shared_ptr<const Method> &m) { return m->usercb == usercb; });
+            if (it == methods.end()) {
+                methods.push_back(std::make_shared<const Method>(Method{
+                    .lambda = std::move(lambda),
                     .usercb = usercb,
-                });
-                providers[interface] = i;
-            } else {
-                auto &i = providers[interface];
-                auto it = std::find_if(i.methods.begin(), i.methods.end(), [&method, usercb](const Method &m) { return m.name == method && m.usercb == usercb; });
-                if (it == i.methods.end()) {
-                    i.methods.push_back({
-                        .name = method,
-                        .lambda = lambda,
-                        .usercb = usercb,
-                    });
-                }
+                }));
             }
             return Firebolt::Error::None;
         }
 
         Firebolt::Error UnregisterProviderInterface(const std::string &interface, const std::string &method, void* usercb)
         {
+            std::string key = providerKey(interface, method);
+
             std::lock_guard lck(providers_mtx);
-            try {
-                Interface &i = providers.at(interface);
-                auto it = std::find_if(i.methods.begin(), i.methods.end(), [&method, usercb](const Method &m) { return m.name == method && m.usercb == usercb; });
-                if (it != i.methods.end()) {
-                    i.methods.erase(it);
+            auto provider = providers.find(key);
+            if (provider != providers.end()) {
+                auto &methods = provider->second;
+                auto it = std::find_if(methods.begin(), methods.end(), [usercb](const std::shared_ptr<const Method> &m) { return m->usercb == usercb; });
+                if (it != methods.end()) {
+                    methods.erase(it);
+                }
+                if (methods.empty()) {
+                    providers.erase(provider);
                 }
-            } catch (const std::out_of_range &e) {
             }
             return Firebolt::Error::None;
         }
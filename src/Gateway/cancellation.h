@@ -0,0 +1,102 @@
+/*
+ * Copyright 2024 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace FireboltSDK
+{
+    // Copies share the same state, so a token handed to a request can be cancelled from any other thread.
+    // A default constructed token can never be cancelled and costs nothing to pass around.
+    class CancellationToken
+    {
+    public:
+        using Handler = std::function<void()>;
+
+        CancellationToken() = default;
+
+        static CancellationToken Create()
+        {
+            CancellationToken token;
+            token.state = std::make_shared<State>();
+            return token;
+        }
+
+        void Cancel() const
+        {
+            if (!state) {
+                return;
+            }
+            Handler handler;
+            {
+                std::lock_guard lck(state->mtx);
+                if (state->cancelled) {
+                    return;
+                }
+                state->cancelled = true;
+                handler = std::move(state->handler);
+                state->handler = nullptr;
+            }
+            if (handler) {
+                handler();
+            }
+        }
+
+        bool IsCancelled() const
+        {
+            if (!state) {
+                return false;
+            }
+            std::lock_guard lck(state->mtx);
+            return state->cancelled;
+        }
+
+        // Installs the handler run by Cancel(), returns false if the token is cancelled already
+        bool Bind(const Handler& handler) const
+        {
+            if (!state) {
+                return true;
+            }
+            std::lock_guard lck(state->mtx);
+            if (!state->cancelled) {
+                state->handler = handler;
+            }
+            return !state->cancelled;
+        }
+
+        void Unbind() const
+        {
+            if (state) {
+                std::lock_guard lck(state->mtx);
+                state->handler = nullptr;
+            }
+        }
+
+    private:
+        struct State
+        {
+            std::mutex mtx;
+            bool cancelled = false;
+            Handler handler;
+        };
+
+        std::shared_ptr<State> state;
+    };
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2023 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
+namespace FireboltSDK
+{
+    // One member of a public struct as it goes on the wire: the JSON key, its length and the member it maps to
+    template <typename CLASS, typename MEMBER>
+    struct Field
+    {
+        const char* name;
+        uint8_t length;
+        MEMBER CLASS::* member;
+    };
+
+    template <typename CLASS, typename MEMBER, size_t LENGTH>
+    constexpr Field<CLASS, MEMBER> MakeField(const char (&name)[LENGTH], MEMBER CLASS::* member)
+    {
+        static_assert(LENGTH - 1 <= UINT8_MAX, "field names are at most 255 characters");
+        return { name, static_cast<uint8_t>(LENGTH - 1), member };
+    }
+
+    // Specialized next to the JsonData_ definitions of a module for every struct the JsonWriter and JsonReader
+    // should encode and decode through its field table, instead of a container copied member by member:
+    //
+    //     template <>
+    //     struct Reflect<Firebolt::Entertainment::Entitlement> {
+    //         static constexpr auto Fields = std::make_tuple(
+    //             MakeField("entitlementId", &Firebolt::Entertainment::Entitlement::entitlementId),
+    //             ...);
+    //     };
+    //
+    // The tables are constexpr, they end up in read-only data and the walks over them are unrolled.
+    template <typename TYPE>
+    struct Reflect;
+
+    template <typename TYPE, typename = void>
+    struct IsReflected : std::false_type {
+    };
+    template <typename TYPE>
+    struct IsReflected<TYPE, std::void_t<decltype(Reflect<TYPE>::Fields)>> : std::true_type {
+    };
+
+    // Calls function(field) for every field of TYPE, in table order. Stops at the first call returning true,
+    // and returns whether one did.
+    template <typename TYPE, typename FUNCTION>
+    constexpr bool ForEachField(FUNCTION&& function)
+    {
+        return std::apply([&function](const auto&... field) { return (function(field) || ...); }, Reflect<TYPE>::Fields);
+    }
+}
@@ -17,19 +17,44 @@
  */
 #pragma once
 
+#include "methodid.h"
+#include "cancellation.h"
+#include "subscriptions.h"
+
 #include <chrono>
 #include <functional>
+#include <string>
+
+#ifndef FIREBOLT_UNSUBSCRIBE_GRACE_PERIOD
+#define FIREBOLT_UNSUBSCRIBE_GRACE_PERIOD 2000
+#endif
 
 namespace FireboltSDK
 {
     using Timestamp = std::chrono::time_point<std::chrono::steady_clock>;
     using MessageID = uint32_t;
+    // Completion of a request nobody waits for: its status, and the raw result when it succeeded
+    using RequestCallback = std::function<void(const Firebolt::Error status, const std::string& result)>;
 
     struct Config
     {
-        static constexpr uint64_t watchdogThreshold_ms = 3000;
-        static constexpr uint64_t watchdogCycle_ms = 500;
-        static constexpr uint32_t DefaultWaitTime = WPEFramework::Core::infinite;
+        // Passing DefaultWaitTime as a deadline selects the per-method default from MethodTable
+        static constexpr uint32_t DefaultWaitTime = 0;
+        static constexpr uint32_t InfiniteWaitTime = WPEFramework::Core::infinite;
+        static constexpr uint32_t FallbackWaitTime = 3000;
+        // How long an event stays listened to on the wire once its last listener is gone
+        static constexpr uint32_t UnsubscribeGracePeriod = FIREBOLT_UNSUBSCRIBE_GRACE_PERIOD;
+
+        static uint32_t WaitTime(const std::string& method, const uint32_t waitTime = DefaultWaitTime)
+        {
+            if (waitTime != DefaultWaitTime) {
+                return waitTime;
+            }
+            MethodId id = FindMethod(method);
+            if (id != UnknownMethod) {
+                return MethodTable[id].waitTime;
+            }
+            return FallbackWaitTime;
+        }
     };
 }
-
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2023 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace FireboltSDK
+{
+    // Room for a callback plus a few pointers, or a std::function, without going to the heap
+    static constexpr size_t InplaceFunctionCapacity = 6 * sizeof(void*);
+
+    template <typename SIGNATURE, size_t CAPACITY = InplaceFunctionCapacity>
+    class InplaceFunction;
+
+    // A std::function that never allocates: the callable is stored inside, a callable not fitting CAPACITY
+    // does not compile. Move-only, so whatever it captures is handed over rather than copied. Calling an
+    // empty one is undefined.
+    template <typename RESULT, typename... ARGUMENTS, size_t CAPACITY>
+    class InplaceFunction<RESULT(ARGUMENTS...), CAPACITY>
+    {
+        struct Operations
+        {
+            RESULT (*invoke)(void* callable, ARGUMENTS&&... arguments);
+            void (*move)(void* to, void* from);
+            void (*destroy)(void* callable);
+        };
+
+        template <typename CALLABLE>
+        static constexpr Operations OperationsOf = {
+            [](void* callable, ARGUMENTS&&... arguments) -> RESULT {
+                return (*static_cast<CALLABLE*>(callable))(std::forward<ARGUMENTS>(arguments)...);
+            },
+            [](void* to, void* from) {
+                ::new (to) CALLABLE(std::move(*static_cast<CALLABLE*>(from)));
+                static_cast<CALLABLE*>(from)->~CALLABLE();
+            },
+            [](void* callable) {
+                static_cast<CALLABLE*>(callable)->~CALLABLE();
+            }
+        };
+
+    public:
+        static constexpr size_t Capacity = CAPACITY;
+
+        InplaceFunction(const InplaceFunction&) = delete;
+        InplaceFunction& operator=(const InplaceFunction&) = delete;
+
+        InplaceFunction() noexcept
+            : _operations(nullptr)
+        {
+        }
+        InplaceFunction(std::nullptr_t) noexcept
+            : _operations(nullptr)
+        {
+        }
+        template <typename FUNCTION, typename CALLABLE = std::decay_t<FUNCTION>,
+            typename std::enable_if<(std::is_same<CALLABLE, InplaceFunction>::value == false) && std::is_invocable_r<RESULT, CALLABLE&, ARGUMENTS...>::value, int>::type = 0>
+        InplaceFunction(FUNCTION&& function)
+            : _operations(&OperationsOf<CALLABLE>)
+        {
+            static_assert(sizeof(CALLABLE) <= CAPACITY, "the callable does not fit the InplaceFunction, capture less or raise its capacity");
+            static_assert(alignof(CALLABLE) <= alignof(std::max_align_t), "the callable is over-aligned for an InplaceFunction");
+            static_assert(std::is_nothrow_move_constructible<CALLABLE>::value, "an InplaceFunction moves its callable, which may not throw doing so");
+            ::new (static_cast<void*>(_storage)) CALLABLE(std::forward<FUNCTION>(function));
+        }
+        InplaceFunction(InplaceFunction&& other) noexcept
+            : _operations(other._operations)
+        {
+            if (_operations != nullptr) {
+                _operations->move(_storage, other._storage);
+                other._operations = nullptr;
+            }
+        }
+        InplaceFunction& operator=(InplaceFunction&& other) noexcept
+        {
+            if (this != &other) {
+                Reset();
+                if (other._operations != nullptr) {
+                    other._operations->move(_storage, other._storage);
+                    _operations = other._operations;
+                    other._operations = nullptr;
+                }
+            }
+            return (*this);
+        }
+        InplaceFunction& operator=(std::nullptr_t) noexcept
+        {
+            Reset();
+            return (*this);
+        }
+        ~InplaceFunction()
+        {
+            Reset();
+        }
+
+    public:
+        explicit operator bool() const noexcept
+        {
+            return (_operations != nullptr);
+        }
+        // Const, as std::function: the callable itself may still keep state between calls
+        RESULT operator()(ARGUMENTS... arguments) const
+        {
+            return _operations->invoke(_storage, std::forward<ARGUMENTS>(arguments)...);
+        }
+
+    private:
+        void Reset() noexcept
+        {
+            if (_operations != nullptr) {
+                _operations->destroy(_storage);
+                _operations = nullptr;
+            }
+        }
+
+    private:
+        const Operations* _operations;
+        alignas(std::max_align_t) mutable unsigned char _storage[CAPACITY];
+    };
+}
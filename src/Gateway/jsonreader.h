@@ -0,0 +1,570 @@
+/*
+ * Copyright 2023 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <core/core.h>
+#include "arena.h"
+#include "codec.h"
+
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <forward_list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace FireboltSDK
+{
+    // Empties a value ahead of a decode into it, keeping the storage it owns where it can: strings keep their
+    // capacity, and so do the strings of a reflected struct.
+    inline void Reset(std::string& value)
+    {
+        value.clear();
+    }
+    template <typename TYPE>
+    inline void Reset(std::optional<TYPE>& value)
+    {
+        value.reset();
+    }
+    template <typename TYPE>
+    inline void Reset(std::vector<TYPE>& values)
+    {
+        values.clear();
+    }
+    template <typename TYPE, typename std::enable_if<IsReflected<TYPE>::value == false, int>::type = 0>
+    inline void Reset(TYPE& value)
+    {
+        value = TYPE();
+    }
+    template <typename TYPE, typename std::enable_if<IsReflected<TYPE>::value, int>::type = 0>
+    inline void Reset(TYPE& value)
+    {
+        ForEachField<TYPE>([&value](const auto& field) {
+            Reset(value.*(field.member));
+            return false;
+        });
+    }
+
+    // Pulls values out of a JSON text in the order they come, for results to be decoded straight into the
+    // public structs instead of a JsonData_ container copied member by member afterwards. Any error is
+    // sticky: once Failed(), every further call returns false. Scratch strings come from the Arena of the call
+    // when there is one. Keys, and strings read as a std::string_view, are views over the text where they
+    // have no escapes: nothing is copied until the caller materializes them.
+    class JsonReader
+    {
+    public:
+        JsonReader(const JsonReader&) = delete;
+        JsonReader& operator=(const JsonReader&) = delete;
+
+        explicit JsonReader(const std::string_view json)
+            : _json(json)
+            , _offset(0)
+            , _failed(false)
+            , _first(false)
+            , _key(Arena::Resource())
+            , _unescaped(Arena::Resource())
+        {
+        }
+
+    public:
+        bool Failed() const
+        {
+            return _failed;
+        }
+        // All of the text was consumed, but for trailing whitespace
+        bool Done()
+        {
+            return (_failed == false) && (Peek() == '\0');
+        }
+        bool IsNull()
+        {
+            if ((Peek() == 'n') && (_json.compare(_offset, 4, "null") == 0)) {
+                _offset += 4;
+                return true;
+            }
+            return false;
+        }
+
+        bool BeginObject()
+        {
+            _first = true;
+            return Expect('{');
+        }
+        // Moves to the next member of the current object and hands out its key, valid till the next call.
+        // Returns false at the end of the object, which is consumed then, or on an error.
+        bool Next(std::string_view& key)
+        {
+            if (Separated('}') == false) {
+                return false;
+            }
+            if (Peek() != '"') {
+                return Fail();
+            }
+            if (Plain(key) == false) {
+                if (String(_key) == false) {
+                    return false;
+                }
+                key = _key;
+            }
+            return Expect(':');
+        }
+        bool BeginArray()
+        {
+            _first = true;
+            return Expect('[');
+        }
+        // Same as Next(), for the elements of the current array
+        bool NextElement()
+        {
+            return Separated(']');
+        }
+
+        bool Read(std::string& value)
+        {
+            return (Peek() == '"') ? String(value) : Fail();
+        }
+        // A view over the text, valid as long as the text is. A string with escapes is unescaped into storage
+        // of the reader instead, valid as long as the reader is.
+        bool Read(std::string_view& value)
+        {
+            if (Peek() != '"') {
+                return Fail();
+            }
+            if (Plain(value) == false) {
+                std::pmr::string& unescaped = _unescaped.emplace_front();
+                if (String(unescaped) == false) {
+                    return false;
+                }
+                value = unescaped;
+            }
+            return true;
+        }
+        bool Read(bool& value)
+        {
+            Peek();
+            if (_json.compare(_offset, 4, "true") == 0) {
+                _offset += 4;
+                value = true;
+            } else if (_json.compare(_offset, 5, "false") == 0) {
+                _offset += 5;
+                value = false;
+            } else {
+                return Fail();
+            }
+            return true;
+        }
+        template <typename TYPE, typename std::enable_if<std::is_integral<TYPE>::value && !std::is_same<TYPE, bool>::value, int>::type = 0>
+        bool Read(TYPE& value)
+        {
+            Peek();
+            const char* begin = _json.data() + _offset;
+            const char* end = _json.data() + _json.size();
+            if ((begin != end) && (*begin == '+')) {
+                return Fail();
+            }
+            std::from_chars_result result = std::from_chars(begin, end, value);
+            if ((result.ec != std::errc()) || ((result.ptr != end) && ((*result.ptr == '.') || (*result.ptr == 'e') || (*result.ptr == 'E')))) {
+                return Fail();
+            }
+            _offset += (result.ptr - begin);
+            return true;
+        }
+        // Whatever the locale of the application, JSON has a decimal point
+        bool Read(double& value)
+        {
+            Peek();
+            const char* begin = _json.data() + _offset;
+            const char* end = _json.data() + _json.size();
+            // A digit has to come first, from_chars() would take inf and nan as well
+            const char* first = ((begin != end) && (*begin == '-')) ? begin + 1 : begin;
+            if ((first == end) || (*first < '0') || (*first > '9')) {
+                return Fail();
+            }
+            std::from_chars_result result = std::from_chars(begin, end, value);
+            if (result.ec != std::errc()) {
+                return Fail();
+            }
+            _offset += (result.ptr - begin);
+            return true;
+        }
+        bool Read(float& value)
+        {
+            double converted;
+            if (Read(converted) == false) {
+                return false;
+            }
+            if (std::fabs(converted) > std::numeric_limits<float>::max()) {
+                return Fail();
+            }
+            value = static_cast<float>(converted);
+            return true;
+        }
+        // Enums are sent by the name they are registered with, an unknown name fails the read
+        template <typename TYPE, typename std::enable_if<std::is_enum<TYPE>::value, int>::type = 0>
+        bool Read(TYPE& value)
+        {
+            std::pmr::string name(Arena::Resource());
+            if (Peek() != '"') {
+                return Fail();
+            }
+            if (String(name) == false) {
+                return false;
+            }
+            WPEFramework::Core::EnumerateType<TYPE> converted(name.c_str(), false);
+            if (converted.IsSet() == false) {
+                return Fail();
+            }
+            value = converted.Value();
+            return true;
+        }
+        // A null leaves the optional empty
+        template <typename TYPE>
+        bool Read(std::optional<TYPE>& value)
+        {
+            if (IsNull() == true) {
+                value.reset();
+                return true;
+            }
+            return Read(value.emplace());
+        }
+
+        // Elements already in values are decoded over, rather than destroyed and allocated again, the ones
+        // left over are dropped
+        template <typename TYPE>
+        bool Read(std::vector<TYPE>& values)
+        {
+            size_t count = 0;
+            if (BeginArray() == false) {
+                values.clear();
+                return false;
+            }
+            while (NextElement() == true) {
+                if (count < values.size()) {
+                    Reset(values[count]);
+                } else {
+                    values.emplace_back();
+                }
+                if (Read(values[count++]) == false) {
+                    values.resize(count);
+                    return false;
+                }
+            }
+            values.resize(count);
+            return (_failed == false);
+        }
+        // A struct with a Reflect<> field table. Keys are matched against the table, members it does not
+        // list are skipped, fields missing from the text are left untouched.
+        template <typename TYPE, typename std::enable_if<IsReflected<TYPE>::value, int>::type = 0>
+        bool Read(TYPE& value)
+        {
+            std::string_view key;
+            if (BeginObject() == false) {
+                return false;
+            }
+            while (Next(key) == true) {
+                const bool known = ForEachField<TYPE>([this, &key, &value](const auto& field) {
+                    if ((key.size() != field.length) || (::memcmp(key.data(), field.name, field.length) != 0)) {
+                        return false;
+                    }
+                    Read(value.*(field.member));
+                    return true;
+                });
+                if (((known == false) && (Skip() == false)) || (_failed == true)) {
+                    return false;
+                }
+            }
+            return (_failed == false);
+        }
+
+        // Steps over a value of any kind, for members the decoder does not know of
+        bool Skip()
+        {
+            switch (Peek()) {
+            case '{': {
+                std::string_view key;
+                if (BeginObject() == false) {
+                    return false;
+                }
+                while (Next(key) == true) {
+                    if (Skip() == false) {
+                        return false;
+                    }
+                }
+                return (_failed == false);
+            }
+            case '[':
+                if (BeginArray() == false) {
+                    return false;
+                }
+                while (NextElement() == true) {
+                    if (Skip() == false) {
+                        return false;
+                    }
+                }
+                return (_failed == false);
+            case '"':
+                return SkipString();
+            case 't':
+            case 'f': {
+                bool ignored;
+                return Read(ignored);
+            }
+            case 'n':
+                return IsNull() ? true : Fail();
+            default: {
+                double ignored;
+                return Read(ignored);
+            }
+            }
+        }
+
+    private:
+        bool Fail()
+        {
+            _failed = true;
+            return false;
+        }
+        char Peek()
+        {
+            while ((_offset < _json.size()) && ((_json[_offset] == ' ') || (_json[_offset] == '\t') || (_json[_offset] == '\n') || (_json[_offset] == '\r'))) {
+                ++_offset;
+            }
+            return (_offset < _json.size()) ? _json[_offset] : '\0';
+        }
+        bool Expect(const char c)
+        {
+            if ((_failed == true) || (Peek() != c)) {
+                return Fail();
+            }
+            ++_offset;
+            return true;
+        }
+        // Consumes the comma in between members or elements, or the closing character at the end
+        bool Separated(const char close)
+        {
+            if (_failed == true) {
+                return false;
+            }
+            if (Peek() == close) {
+                ++_offset;
+                _first = false;
+                return false;
+            }
+            if ((_first == false) && (Expect(',') == false)) {
+                return false;
+            }
+            _first = false;
+            return true;
+        }
+        // The string at the current position, when it has no escapes: value is a view over it then
+        bool Plain(std::string_view& value)
+        {
+            const size_t end = _json.find_first_of("\"\\", _offset + 1);
+            if ((end == std::string_view::npos) || (_json[end] != '"')) {
+                return false;
+            }
+            value = _json.substr(_offset + 1, end - _offset - 1);
+            _offset = end + 1;
+            return true;
+        }
+        bool SkipString()
+        {
+            ++_offset;
+            while (true) {
+                const size_t end = _json.find_first_of("\"\\", _offset);
+                if (end == std::string_view::npos) {
+                    return Fail();
+                }
+                if (_json[end] == '"') {
+                    _offset = end + 1;
+                    return true;
+                }
+                // Past the escaped character, the digits of a \u escape need no looking at
+                _offset = end + 2;
+            }
+        }
+        template <typename STRING>
+        bool String(STRING& value)
+        {
+            value.clear();
+            ++_offset;
+            while (_offset < _json.size()) {
+                size_t end = _json.find_first_of("\"\\", _offset);
+                if (end == std::string_view::npos) {
+                    break;
+                }
+                value.append(_json.data() + _offset, end - _offset);
+                _offset = end + 1;
+                if (_json[end] == '"') {
+                    return true;
+                }
+                if (Escaped(value) == false) {
+                    return false;
+                }
+            }
+            return Fail();
+        }
+        template <typename STRING>
+        bool Escaped(STRING& value)
+        {
+            if (_offset >= _json.size()) {
+                return Fail();
+            }
+            const char c = _json[_offset++];
+            switch (c) {
+            case '"': value.push_back('"'); break;
+            case '\\': value.push_back('\\'); break;
+            case '/': value.push_back('/'); break;
+            case 'b': value.push_back('\b'); break;
+            case 'f': value.push_back('\f'); break;
+            case 'n': value.push_back('\n'); break;
+            case 'r': value.push_back('\r'); break;
+            case 't': value.push_back('\t'); break;
+            case 'u': {
+                uint32_t code;
+                if (Hex(code) == false) {
+                    return false;
+                }
+                if ((code >= 0xD800) && (code < 0xDC00) && (_json.compare(_offset, 2, "\\u") == 0)) {
+                    uint32_t low;
+                    _offset += 2;
+                    if ((Hex(low) == false) || (low < 0xDC00) || (low > 0xDFFF)) {
+                        return Fail();
+                    }
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                }
+                Utf8(code, value);
+                break;
+            }
+            default:
+                return Fail();
+            }
+            return true;
+        }
+        bool Hex(uint32_t& code)
+        {
+            if (_offset + 4 > _json.size()) {
+                return Fail();
+            }
+            std::from_chars_result result = std::from_chars(_json.data() + _offset, _json.data() + _offset + 4, code, 16);
+            if ((result.ec != std::errc()) || (result.ptr != _json.data() + _offset + 4)) {
+                return Fail();
+            }
+            _offset += 4;
+            return true;
+        }
+        template <typename STRING>
+        static void Utf8(const uint32_t code, STRING& value)
+        {
+            if (code < 0x80) {
+                value.push_back(static_cast<char>(code));
+            } else if (code < 0x800) {
+                value.push_back(static_cast<char>(0xC0 | (code >> 6)));
+                value.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+            } else if (code < 0x10000) {
+                value.push_back(static_cast<char>(0xE0 | (code >> 12)));
+                value.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+                value.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+            } else {
+                value.push_back(static_cast<char>(0xF0 | (code >> 18)));
+                value.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+                value.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+                value.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+            }
+        }
+
+    private:
+        std::string_view _json;
+        size_t _offset;
+        bool _failed;
+        bool _first;
+        std::pmr::string _key;
+        std::pmr::forward_list<std::pmr::string> _unescaped;
+    };
+
+    // A plain string result
+    inline bool Decode(JsonReader& reader, std::string& value)
+    {
+        return reader.Read(value);
+    }
+    // A list result, of anything the reader decodes
+    template <typename TYPE>
+    inline bool Decode(JsonReader& reader, std::vector<TYPE>& values)
+    {
+        return reader.Read(values);
+    }
+    // Structs with a field table need no decoder of their own
+    template <typename TYPE, typename std::enable_if<IsReflected<TYPE>::value, int>::type = 0>
+    inline bool Decode(JsonReader& reader, TYPE& value)
+    {
+        return reader.Read(value);
+    }
+
+    // Response of a request decoded by a Decode(JsonReader&, TYPE&) found next to TYPE, or by its field table,
+    // straight into the value the caller hands out. The value is reset first: members missing from the result
+    // are left as a JsonData_ container would have them, value-initialized. Whatever storage the value already
+    // owns is reused, so a caller decoding into the same value call after call stops allocating once it is
+    // large enough.
+    template <typename TYPE>
+    class Decoded
+    {
+    public:
+        Decoded(const Decoded&) = delete;
+        Decoded& operator=(const Decoded&) = delete;
+
+        explicit Decoded(TYPE& value)
+            : _value(value)
+        {
+        }
+
+    public:
+        bool FromString(const std::string_view json)
+        {
+            Prepare(_value);
+            JsonReader reader(json);
+            return (Decode(reader, _value) == true) && (reader.Done() == true);
+        }
+        // The value at the start of text, which runs on with the rest of the frame it was received in
+        bool FromFrame(const std::string_view text)
+        {
+            Prepare(_value);
+            JsonReader reader(text);
+            return (Decode(reader, _value) == true);
+        }
+
+    private:
+        // Read() decodes over the elements of a list and trims it to size itself
+        template <typename VALUE>
+        static void Prepare(std::vector<VALUE>&)
+        {
+        }
+        template <typename VALUE>
+        static void Prepare(VALUE& value)
+        {
+            Reset(value);
+        }
+
+    private:
+        TYPE& _value;
+    };
+}
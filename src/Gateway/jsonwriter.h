@@ -0,0 +1,264 @@
+/*
+ * Copyright 2023 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <core/core.h>
+#include "arena.h"
+#include "codec.h"
+
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace FireboltSDK
+{
+    // Serializes request parameters as they are added, into the one string that goes out as the params of
+    // the request. Spares building a JsonObject out of Variant temporaries only to serialize it right after.
+    // Keys are expected to be plain identifiers, they are not escaped. Absent optionals are left out.
+    // The text is kept in the Arena of the call when there is one.
+    class JsonWriter
+    {
+    public:
+        JsonWriter(const JsonWriter&) = delete;
+        JsonWriter& operator=(const JsonWriter&) = delete;
+
+        explicit JsonWriter(const size_t reserve = 256)
+            : _json(Arena::Resource())
+            , _first(true)
+        {
+            _json.reserve(reserve);
+            _json.push_back('{');
+        }
+
+    public:
+        JsonWriter& Add(const char* key, const std::string& value)
+        {
+            Key(key);
+            Quoted(value.data(), value.size());
+            return *this;
+        }
+        JsonWriter& Add(const char* key, const char* value)
+        {
+            Key(key);
+            Quoted(value, ::strlen(value));
+            return *this;
+        }
+        JsonWriter& Add(const char* key, const bool value)
+        {
+            Key(key);
+            _json.append(value ? "true" : "false");
+            return *this;
+        }
+        template <typename TYPE, typename std::enable_if<std::is_integral<TYPE>::value && !std::is_same<TYPE, bool>::value, int>::type = 0>
+        JsonWriter& Add(const char* key, const TYPE value)
+        {
+            Key(key);
+            char buffer[24];
+            std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            _json.append(buffer, result.ptr - buffer);
+            return *this;
+        }
+        // Shortest text reading back as the same double, whatever the locale of the application
+        JsonWriter& Add(const char* key, const double value)
+        {
+            Key(key);
+            if (std::isfinite(value)) {
+                char buffer[32];
+                std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+                _json.append(buffer, result.ptr - buffer);
+            } else {
+                _json.append("null");
+            }
+            return *this;
+        }
+        // Shortest text reading back as the same float, not the digits of its promotion to double
+        JsonWriter& Add(const char* key, const float value)
+        {
+            Key(key);
+            if (std::isfinite(value)) {
+                char buffer[24];
+                std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+                _json.append(buffer, result.ptr - buffer);
+            } else {
+                _json.append("null");
+            }
+            return *this;
+        }
+        // Enums go by the name they are registered with, as a JSON::EnumType would have it
+        template <typename TYPE, typename std::enable_if<std::is_enum<TYPE>::value, int>::type = 0>
+        JsonWriter& Add(const char* key, const TYPE value)
+        {
+            return Add(key, WPEFramework::Core::EnumerateType<TYPE>(value).Data());
+        }
+        // A FlatMap, an object of strings
+        JsonWriter& Add(const char* key, const std::unordered_map<std::string, std::string>& map)
+        {
+            BeginObject(key);
+            for (const auto& element : map) {
+                Key(element.first.c_str(), true);
+                Quoted(element.second.data(), element.second.size());
+            }
+            return EndObject();
+        }
+        template <typename TYPE>
+        JsonWriter& Add(const char* key, const std::optional<TYPE>& value)
+        {
+            if (value.has_value()) {
+                Add(key, value.value());
+            }
+            return *this;
+        }
+        template <typename TYPE>
+        JsonWriter& Add(const char* key, const std::vector<TYPE>& values)
+        {
+            BeginArray(key);
+            for (const TYPE& value : values) {
+                Add(nullptr, value);
+            }
+            return EndArray();
+        }
+        // A struct with a Reflect<> field table, as an object of its fields in table order
+        template <typename TYPE, typename std::enable_if<IsReflected<TYPE>::value, int>::type = 0>
+        JsonWriter& Add(const char* key, const TYPE& value)
+        {
+            BeginObject(key);
+            ForEachField<TYPE>([this, &value](const auto& field) {
+                Add(field.name, value.*(field.member));
+                return false;
+            });
+            return EndObject();
+        }
+
+        // Already serialized JSON, a container the generated code still builds for instance
+        JsonWriter& AddJson(const char* key, const std::string_view json)
+        {
+            Key(key);
+            _json.append(json.empty() ? "null" : json);
+            return *this;
+        }
+        // A JsonData_ container the generated code built, serialized once, in place: it is not turned into a
+        // Variant to be serialized again with the parameters
+        template <typename CONTAINER>
+        JsonWriter& AddContainer(const char* key, const CONTAINER& container)
+        {
+            Key(key);
+            std::string json;
+            container.ToString(json);
+            _json.append(json);
+            return *this;
+        }
+
+        // Members added in between belong to the nested object, or are the elements of the nested array
+        // when added with a nullptr key
+        JsonWriter& BeginObject(const char* key = nullptr)
+        {
+            Key(key);
+            _json.push_back('{');
+            _first = true;
+            return *this;
+        }
+        JsonWriter& EndObject()
+        {
+            _json.push_back('}');
+            _first = false;
+            return *this;
+        }
+        JsonWriter& BeginArray(const char* key = nullptr)
+        {
+            Key(key);
+            _json.push_back('[');
+            _first = true;
+            return *this;
+        }
+        JsonWriter& EndArray()
+        {
+            _json.push_back(']');
+            _first = false;
+            return *this;
+        }
+
+        // Closes the parameters object, the writer is done with afterwards. The text is the writer's, it
+        // has to outlive the request.
+        std::string_view Finish()
+        {
+            _json.push_back('}');
+            return (_json);
+        }
+
+    private:
+        void Key(const char* key, const bool escape = false)
+        {
+            if (!_first) {
+                _json.push_back(',');
+            }
+            _first = false;
+            if (key != nullptr) {
+                if (escape) {
+                    Quoted(key, ::strlen(key));
+                } else {
+                    _json.push_back('"');
+                    _json.append(key);
+                    _json.push_back('"');
+                }
+                _json.push_back(':');
+            }
+        }
+
+        void Quoted(const char* value, const size_t length)
+        {
+            static constexpr char Hex[] = "0123456789abcdef";
+            _json.push_back('"');
+            size_t start = 0;
+            for (size_t index = 0; index < length; ++index) {
+                const unsigned char c = static_cast<unsigned char>(value[index]);
+                if (c >= 0x20 && c != '"' && c != '\\') {
+                    continue;
+                }
+                _json.append(value + start, index - start);
+                start = index + 1;
+                switch (c) {
+                case '"': _json.append("\\\""); break;
+                case '\\': _json.append("\\\\"); break;
+                case '\b': _json.append("\\b"); break;
+                case '\f': _json.append("\\f"); break;
+                case '\n': _json.append("\\n"); break;
+                case '\r': _json.append("\\r"); break;
+                case '\t': _json.append("\\t"); break;
+                default:
+                    _json.append("\\u00");
+                    _json.push_back(Hex[c >> 4]);
+                    _json.push_back(Hex[c & 0x0F]);
+                    break;
+                }
+            }
+            _json.append(value + start, length - start);
+            _json.push_back('"');
+        }
+
+    private:
+        std::pmr::string _json;
+        bool _first;
+    };
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2024 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "MethodTable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace FireboltSDK
+{
+    // Method ids are generated from the OpenRPC specification, see cmake/GenerateMethodTable.py.
+    // Names are resolved once, routing within the SDK is done on the id.
+    static constexpr MethodId UnknownMethod = 0xFFFF;
+
+    // Has to match method_hash() of the generator, names are hashed 8 bytes at a time and folded to
+    // lower-case by setting bit 5 of every byte, which holds for the [A-Za-z0-9.] names of the specification
+    constexpr uint64_t MethodWord(const char* name, const size_t length)
+    {
+        uint64_t word = 0;
+        for (size_t byte = 0; byte < length; ++byte) {
+            word |= static_cast<uint64_t>(static_cast<uint8_t>(name[byte])) << (8 * byte);
+        }
+        return word;
+    }
+
+    constexpr uint64_t MethodWord(const char* name)
+    {
+        // Spelled out, compilers merge this into a single load on little endian targets
+        return static_cast<uint64_t>(static_cast<uint8_t>(name[0]))
+            | (static_cast<uint64_t>(static_cast<uint8_t>(name[1])) << 8)
+            | (static_cast<uint64_t>(static_cast<uint8_t>(name[2])) << 16)
+            | (static_cast<uint64_t>(static_cast<uint8_t>(name[3])) << 24)
+            | (static_cast<uint64_t>(static_cast<uint8_t>(name[4])) << 32)
+            | (static_cast<uint64_t>(static_cast<uint8_t>(name[5])) << 40)
+            | (static_cast<uint64_t>(static_cast<uint8_t>(name[6])) << 48)
+            | (static_cast<uint64_t>(static_cast<uint8_t>(name[7])) << 56);
+    }
+
+    constexpr uint64_t MethodMix(const uint64_t value, const uint64_t word)
+    {
+        const uint64_t mixed = (value ^ (word | 0x2020202020202020ull)) * 0x9E3779B97F4A7C15ull;
+        return mixed ^ (mixed >> 32);
+    }
+
+    constexpr uint32_t MethodHash(const char* name, const size_t length)
+    {
+        uint64_t value = 0xCBF29CE484222325ull ^ length;
+        size_t index = 0;
+        for (; index + 8 <= length; index += 8) {
+            value = MethodMix(value, MethodWord(name + index));
+        }
+        if (index < length) {
+            value = MethodMix(value, MethodWord(name + index, length - index));
+        }
+        return static_cast<uint32_t>(value);
+    }
+
+    // Has to match displace() of the generator
+    constexpr uint32_t MethodDisplace(uint32_t value, const uint32_t seed)
+    {
+        value ^= seed;
+        value ^= value >> 16;
+        value *= 0x85EBCA6Bu;
+        value ^= value >> 13;
+        value *= 0xC2B2AE35u;
+        value ^= value >> 16;
+        return value;
+    }
+
+    constexpr MethodId FindMethod(const char* name, const size_t length)
+    {
+        constexpr size_t bucketCount = sizeof(MethodSeeds) / sizeof(MethodSeeds[0]);
+        constexpr size_t slotCount = sizeof(MethodSlots) / sizeof(MethodSlots[0]);
+
+        const uint32_t hash = MethodHash(name, length);
+        const uint16_t slot = MethodSlots[MethodDisplace(hash, MethodSeeds[hash % bucketCount]) % slotCount];
+        if (slot >= (sizeof(MethodKeys) / sizeof(MethodKeys[0]))) {
+            return UnknownMethod;
+        }
+        if (MethodKeys[slot].length != length) {
+            return UnknownMethod;
+        }
+        // Keys are stored folded already
+        const char* key = MethodKeys[slot].name;
+        size_t index = 0;
+        for (; index + 8 <= length; index += 8) {
+            if ((MethodWord(name + index) | 0x2020202020202020ull) != MethodWord(key + index)) {
+                return UnknownMethod;
+            }
+        }
+        if (index < length) {
+            const uint64_t fold = 0x2020202020202020ull >> (8 * (8 - (length - index)));
+            if ((MethodWord(name + index, length - index) | fold) != MethodWord(key + index, length - index)) {
+                return UnknownMethod;
+            }
+        }
+        return MethodKeys[slot].id;
+    }
+
+    inline MethodId FindMethod(const std::string& name)
+    {
+        return FindMethod(name.c_str(), name.size());
+    }
+
+    // Usable in constant expressions, e.g. static_assert(MethodIdOf("device.name") != UnknownMethod)
+    template <size_t N>
+    constexpr MethodId MethodIdOf(const char (&name)[N])
+    {
+        return FindMethod(name, N - 1);
+    }
+
+    inline const char* MethodName(const MethodId id)
+    {
+        return (id < (sizeof(MethodTable) / sizeof(MethodTable[0]))) ? MethodTable[id].name : nullptr;
+    }
+}
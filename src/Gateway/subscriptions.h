@@ -0,0 +1,182 @@
+/*
+ * Copyright 2024 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <core/core.h>
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace FireboltSDK
+{
+    // Tracks the "listen" subscriptions on the wire, one per event whatever the number of local listeners.
+    // Local listener bookkeeping stays with the owner, which calls Release() once the last listener of an
+    // event is gone. The wire subscription is then kept for a grace period, a listener coming back within
+    // it does not cost any message. Expired subscriptions are dropped out of the lock.
+    // While listen:true or listen:false of an event is on its way, the other listeners of the event wait for
+    // its outcome: they are not told the event is listened to before it is, and listen:true cannot overtake
+    // listen:false.
+    class WireSubscriptions
+    {
+    public:
+        using Drop = std::function<void(const std::string& event)>;
+
+        enum class Claim : uint8_t {
+            Send,      // listen:true has to be sent, then Confirm() or Abandon() it
+            Listening, // listened to on the wire already
+            Busy       // a request of the event is on its way, Acquire() waits for it
+        };
+
+        WireSubscriptions(const uint32_t gracePeriod)
+            : gracePeriod(gracePeriod)
+        {
+        }
+
+        // Returns true if listen:true has to be sent for the event, then Confirm() or Abandon() it. Must not
+        // be called while holding a Claim::Send of another event, see TryAcquire().
+        bool Acquire(const std::string& event)
+        {
+            std::unique_lock lck(mtx);
+            settled.wait(lck, [&]() {
+                auto it = entries.find(event);
+                return (it == entries.end()) || (Settled(it->second) == true);
+            });
+            return (Take(event) == Claim::Send);
+        }
+
+        // Does not wait, for batches which hold several events at once: those found Busy are acquired again
+        // once the batch is done with its own requests.
+        Claim TryAcquire(const std::string& event)
+        {
+            std::lock_guard lck(mtx);
+            auto it = entries.find(event);
+            if ((it != entries.end()) && (Settled(it->second) == false)) {
+                return Claim::Busy;
+            }
+            return Take(event);
+        }
+
+        // The listen request following Acquire() made it
+        void Confirm(const std::string& event)
+        {
+            {
+                std::lock_guard lck(mtx);
+                auto it = entries.find(event);
+                if (it != entries.end()) {
+                    it->second = 0;
+                }
+            }
+            settled.notify_all();
+        }
+
+        // The listen request following Acquire() did not make it, the next listener waiting tries again
+        void Abandon(const std::string& event)
+        {
+            {
+                std::lock_guard lck(mtx);
+                entries.erase(event);
+            }
+            settled.notify_all();
+        }
+
+        // Returns true if listen:false has to be sent for the event: right away when dropAt is 0, otherwise
+        // through Expire() once dropAt (Core::Time ticks) has passed.
+        bool Release(const std::string& event, uint64_t& dropAt)
+        {
+            std::lock_guard lck(mtx);
+            auto it = entries.find(event);
+            if (it == entries.end() || Settled(it->second) == false) {
+                return false;
+            }
+            if (gracePeriod == 0) {
+                entries.erase(it);
+                dropAt = 0;
+            } else {
+                dropAt = WPEFramework::Core::Time::Now().Add(gracePeriod).Ticks();
+                it->second = dropAt;
+            }
+            return true;
+        }
+
+        // Runs drop for every subscription whose grace period is over, out of the lock. Returns the next drop
+        // time, 0 if none.
+        uint64_t Expire(const uint64_t currentTime, const Drop& drop)
+        {
+            uint64_t next = 0;
+            std::vector<std::string> expired;
+            std::unique_lock lck(mtx);
+            for (auto& entry : entries) {
+                uint64_t dropAt = entry.second;
+                if (dropAt == 0 || Settled(dropAt) == false) {
+                    continue;
+                }
+                if (dropAt <= currentTime) {
+                    entry.second = Dropping;
+                    expired.push_back(entry.first);
+                } else if (next == 0 || dropAt < next) {
+                    next = dropAt;
+                }
+            }
+            lck.unlock();
+
+            for (const std::string& event : expired) {
+                drop(event);
+            }
+
+            if (expired.empty() == false) {
+                lck.lock();
+                for (const std::string& event : expired) {
+                    entries.erase(event);
+                }
+                lck.unlock();
+                settled.notify_all();
+            }
+            return next;
+        }
+
+    private:
+        static constexpr uint64_t Dropping = ~0ULL;
+        static constexpr uint64_t Requested = ~0ULL - 1;
+
+        static bool Settled(const uint64_t state)
+        {
+            return ((state != Dropping) && (state != Requested));
+        }
+
+        // With the lock held and the entry of the event settled, if any
+        Claim Take(const std::string& event)
+        {
+            auto it = entries.find(event);
+            if (it != entries.end()) {
+                it->second = 0; // whatever the drop was pending for, it is in use again
+                return Claim::Listening;
+            }
+            entries.emplace(event, Requested);
+            return Claim::Send;
+        }
+
+        std::unordered_map<std::string, uint64_t> entries; // event -> drop time, 0 while in use, or the request on its way
+        std::mutex mtx;
+        std::condition_variable settled;
+        const uint32_t gracePeriod;
+    };
+}
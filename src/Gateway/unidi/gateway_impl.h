@@ -51,13 +51,21 @@ namespace FireboltSDK
            this->transport = transport;
         }
 
-        template <typename RESPONSE>
-        Firebolt::Error Request(const std::string &method, const JsonObject &parameters, RESPONSE &response)
+        template <typename RESPONSE, typename PARAMETERS>
+        Firebolt::Error Request(const std::string &method, const PARAMETERS &parameters, RESPONSE &response, const uint32_t waitTime = Config::DefaultWaitTime, const CancellationToken& token = CancellationToken())
+        {
+            if (transport == nullptr) {
+                return Firebolt::Error::NotConnected;
+            }
+            return transport->Invoke(method, parameters, response, Config::WaitTime(method, waitTime), token);
+        }
+
+        Firebolt::Error RequestAsync(const std::string &method, const JsonObject &parameters, const RequestCallback &completed, const uint32_t waitTime = Config::DefaultWaitTime, const CancellationToken& token = CancellationToken())
         {
             if (transport == nullptr) {
                 return Firebolt::Error::NotConnected;
             }
-            return transport->Invoke(method, parameters, response);
+            return transport->InvokeAsync(method, parameters, Config::WaitTime(method, waitTime), completed, token);
         }
 
         template <typename RESPONSE>
@@ -69,6 +77,16 @@ namespace FireboltSDK
             return transport->Subscribe(event, parameters, response);
         }
 
+        template <typename RESPONSE>
+        Firebolt::Error SubscribeMany(const std::vector<std::pair<string, string>>& requests, std::vector<Firebolt::Error>& statuses)
+        {
+            if (transport == nullptr) {
+                statuses.assign(requests.size(), Firebolt::Error::NotConnected);
+                return Firebolt::Error::NotConnected;
+            }
+            return transport->template SubscribeMany<RESPONSE>(requests, statuses);
+        }
+
         Firebolt::Error Unsubscribe(const string& event, const string& parameters)
         {
             if (transport == nullptr) {
@@ -34,23 +34,23 @@ namespace FireboltSDK {
 
     public:
         template <typename RESPONSETYPE>
-        static Firebolt::Error Get(const string& propertyName, RESPONSETYPE& response)
+        static Firebolt::Error Get(const string& propertyName, RESPONSETYPE& response, const uint32_t waitTime = Config::DefaultWaitTime)
         {
             JsonObject parameters;
-            return Gateway::Instance().Request<RESPONSETYPE>(propertyName, parameters, response);
+            return Gateway::Instance().Request<RESPONSETYPE>(propertyName, parameters, response, waitTime);
         }
 
         template <typename PARAMETERS, typename RESPONSETYPE>
-        static Firebolt::Error Get(const string& propertyName, const PARAMETERS& parameters, RESPONSETYPE& response)
+        static Firebolt::Error Get(const string& propertyName, const PARAMETERS& parameters, RESPONSETYPE& response, const uint32_t waitTime = Config::DefaultWaitTime)
         {
-            return Gateway::Instance().Request(propertyName, parameters, response);
+            return Gateway::Instance().Request(propertyName, parameters, response, waitTime);
         }
 
         template <typename PARAMETERS>
-        static Firebolt::Error Set(const string& propertyName, const PARAMETERS& parameters)
+        static Firebolt::Error Set(const string& propertyName, const PARAMETERS& parameters, const uint32_t waitTime = Config::DefaultWaitTime)
         {
             JsonObject responseType;
-            return Gateway::Instance().Request(propertyName, parameters, responseType);
+            return Gateway::Instance().Request(propertyName, parameters, responseType, waitTime);
         }
 
         template <typename RESULT, typename CALLBACK>
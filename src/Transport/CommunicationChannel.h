@@ -18,17 +18,32 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <type_traits>
 #include "Module.h"
 #include "error.h"
+#include "Gateway/function.h"
+#include "executor.h"
+#include "inbound.h"
 #include "json_engine.h"
+#include "messagepool.h"
+#ifdef ENABLE_IO_URING
+#include "uringstream.h"
+#endif
 
 namespace FireboltSDK
 {
+#ifdef ENABLE_IO_URING
+    using ChannelSocket = UringSocketStream;
+#else
+    using ChannelSocket = WPEFramework::Core::SocketStream;
+#endif
+
     template <typename SOCKETTYPE, typename INTERFACE, typename CLIENT, typename MESSAGETYPE>
     class CommunicationChannel
     {
     public:
-        typedef std::function<void(const INTERFACE &)> Callback;
+        typedef InplaceFunction<void(const INTERFACE &)> Callback;
         class Entry
         {
         private:
@@ -45,8 +60,8 @@ namespace FireboltSDK
             };
             struct ASynchronous
             {
-                ASynchronous(const uint32_t waitTime, const Callback &completed)
-                    : _waitTime(WPEFramework::Core::Time::Now().Add(waitTime).Ticks()), _completed(completed)
+                ASynchronous(const uint32_t waitTime, Callback &&completed)
+                    : _waitTime(WPEFramework::Core::Time::Now().Add(waitTime).Ticks()), _completed(std::move(completed))
                 {
                 }
                 uint64_t _waitTime;
@@ -58,8 +73,8 @@ namespace FireboltSDK
                 : _synchronous(true), _info()
             {
             }
-            Entry(const uint32_t waitTime, const Callback &completed)
-                : _synchronous(false), _info(waitTime, completed)
+            Entry(const uint32_t waitTime, Callback &&completed)
+                : _synchronous(false), _info(waitTime, std::move(completed))
             {
             }
             ~Entry()
@@ -75,6 +90,10 @@ namespace FireboltSDK
             }
 
         public:
+            bool HasResponse() const
+            {
+                return (_info.sync._response.empty() == false);
+            }
             const WPEFramework::Core::ProxyType<MESSAGETYPE> &Response() const
             {
                 return (*(_info.sync._response.begin()));
@@ -166,8 +185,8 @@ namespace FireboltSDK
                     : sync()
                 {
                 }
-                Info(const uint32_t waitTime, const Callback &completed)
-                    : async(waitTime, completed)
+                Info(const uint32_t waitTime, Callback &&completed)
+                    : async(waitTime, std::move(completed))
                 {
                 }
                 ~Info()
@@ -226,7 +245,7 @@ namespace FireboltSDK
             friend WPEFramework::Core::SingletonType<FactoryImpl>;
 
             FactoryImpl()
-                : _messageFactory(2), _watchDog(WPEFramework::Core::Thread::DefaultStackSize(), _T("TransportCleaner"))
+                : _watchDogCreated(), _watchDog()
             {
             }
 
@@ -243,20 +262,49 @@ namespace FireboltSDK
         public:
             WPEFramework::Core::ProxyType<MESSAGETYPE> Element(const string &)
             {
-                return (_messageFactory.Element());
+                return (WPEFramework::Core::ProxyType<MESSAGETYPE>(MessagePoolType<ElementType>::Instance().Element()));
             }
+            // Expiries are tracked by the application's executor when it drives the SDK, the
+            // cleaner thread is only started when there is none
             void Trigger(const uint64_t &time, CLIENT *client)
             {
-                _watchDog.Trigger(time, client);
+                CallerExecutor* executor = CallerExecutor::Instance();
+                if (executor != nullptr)
+                {
+                    executor->Trigger(time, client, [client]() -> uint64_t { return (client->Timed()); });
+                }
+                else
+                {
+                    WatchDogTimer().Trigger(time, client);
+                }
             }
             void Revoke(CLIENT *client)
             {
-                _watchDog.Revoke(client);
+                CallerExecutor* executor = CallerExecutor::Instance();
+                if (executor != nullptr)
+                {
+                    executor->Revoke(client);
+                }
+                else
+                {
+                    WatchDogTimer().Revoke(client);
+                }
+            }
+
+        private:
+            WPEFramework::Core::TimerType<WatchDog> &WatchDogTimer()
+            {
+                std::call_once(_watchDogCreated, [this]() {
+                    _watchDog = std::make_unique<WPEFramework::Core::TimerType<WatchDog>>(WPEFramework::Core::Thread::DefaultStackSize(), _T("TransportCleaner"));
+                });
+                return (*_watchDog);
             }
 
         private:
-            WPEFramework::Core::ProxyPoolType<MESSAGETYPE> _messageFactory;
-            WPEFramework::Core::TimerType<WatchDog> _watchDog;
+            // JSON-RPC messages are received lazily, see InboundMessage
+            using ElementType = typename std::conditional<std::is_same<MESSAGETYPE, WPEFramework::Core::JSONRPC::Message>::value, InboundMessage, MESSAGETYPE>::type;
+            std::once_flag _watchDogCreated;
+            std::unique_ptr<WPEFramework::Core::TimerType<WatchDog>> _watchDog;
         };
 
         class ChannelImpl : public WPEFramework::Core::StreamJSONType<WPEFramework::Web::WebSocketClientType<SOCKETTYPE>, FactoryImpl &, INTERFACE>
@@ -24,6 +24,8 @@
 #include "json_engine.h"
 #endif
 #include "Transport/CommunicationChannel.h"
+#include "Transport/serialqueues.h"
+#include "Gateway/jsonreader.h"
 
 namespace FireboltSDK
 {
@@ -32,6 +34,8 @@ namespace FireboltSDK
     class ITransportReceiver {
     public:
         virtual void Receive(const WPEFramework::Core::JSONRPC::Message& message) = 0;
+        // Called from the transport timer, returns the next expiry time in ticks (0 if nothing is pending)
+        virtual uint64_t Timed(const uint64_t currentTime) = 0;
     };
 
     class IEventHandler
@@ -46,8 +50,8 @@ namespace FireboltSDK
     class Transport
     {
     private:
-        using Channel = CommunicationChannel<WPEFramework::Core::SocketStream, INTERFACE, Transport, WPEFramework::Core::JSONRPC::Message>;
-        using Entry = typename CommunicationChannel<WPEFramework::Core::SocketStream, INTERFACE, Transport, WPEFramework::Core::JSONRPC::Message>::Entry;
+        using Channel = CommunicationChannel<ChannelSocket, INTERFACE, Transport, WPEFramework::Core::JSONRPC::Message>;
+        using Entry = typename CommunicationChannel<ChannelSocket, INTERFACE, Transport, WPEFramework::Core::JSONRPC::Message>::Entry;
         using PendingMap = std::unordered_map<uint32_t, Entry>;
         using EventMap = std::map<string, uint32_t>;
         typedef std::function<uint32_t(const WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message> &jsonResponse, bool &enabled)> EventResponseValidatioionFunction;
@@ -130,7 +134,7 @@ namespace FireboltSDK
         Transport(const Transport &) = delete;
         Transport &operator=(Transport &) = delete;
         Transport(const WPEFramework::Core::URL &url, const uint32_t waitTime, const Listener listener)
-            : _adminLock(), _connectId(WPEFramework::Core::NodeId(url.Host().Value().c_str(), url.Port().Value())), _channel(Channel::Instance(_connectId, ((url.Path().Value().rfind(PathPrefix, 0) == 0) ? url.Path().Value() : string(PathPrefix + url.Path().Value())), url.Query().Value(), true)), _pendingQueue(), _scheduledTime(0), _waitTime(waitTime), _listener(listener), _connected(false), _status(Firebolt::Error::NotConnected)
+            : _adminLock(), _connectId(WPEFramework::Core::NodeId(url.Host().Value().c_str(), url.Port().Value())), _channel(Channel::Instance(_connectId, ((url.Path().Value().rfind(PathPrefix, 0) == 0) ? url.Path().Value() : string(PathPrefix + url.Path().Value())), url.Query().Value(), true)), _transportReceiver(nullptr), _pendingQueue(), _scheduledTime(0), _waitTime(waitTime), _listener(listener), _connected(false), _status(Firebolt::Error::NotConnected), _events([this](const WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message> &inbound) { Inbound(inbound); })
         {
             _channel->Register(*this);
             WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch> job = WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch>(WPEFramework::Core::ProxyType<Transport::ConnectionJob>::Create(this));
@@ -140,6 +144,8 @@ namespace FireboltSDK
         virtual ~Transport()
         {
             _channel->Unregister(*this);
+            // Nothing comes in anymore, the notifications still queued would run on a transport going away
+            _events.Revoke();
 
             for (auto &element : _pendingQueue)
             {
@@ -185,9 +191,8 @@ namespace FireboltSDK
 // Invoke method is overriden for unit testing to call MockResponse method from JSON engine
 #ifdef UNIT_TEST
         template <typename PARAMETERS, typename RESPONSE>
-        Firebolt::Error Invoke(const string &method, const PARAMETERS &parameters, RESPONSE &response)
+        Firebolt::Error Invoke(const string &method, const PARAMETERS &parameters, RESPONSE &response, const uint32_t waitTime)
         {
-            Entry slot;
             uint32_t id = _channel->Sequence();
             Firebolt::Error result = Send(method, parameters, id);
 
@@ -195,18 +200,24 @@ namespace FireboltSDK
             message.Designator = method;
             std::unique_ptr<JsonEngine> jsonEngine = std::make_unique<JsonEngine>();
             result = jsonEngine->MockResponse(message, response);
-            FromMessage((INTERFACE *)&response, message);
+            FromMessage(&response, message);
             return (result);
         }
 #else
         template <typename PARAMETERS, typename RESPONSE>
-        Firebolt::Error Invoke(const string& method, const PARAMETERS& parameters, RESPONSE& response)
+        Firebolt::Error Invoke(const string& method, const PARAMETERS& parameters, RESPONSE& response, const uint32_t waitTime)
         {
-            Entry slot;
             uint32_t id = _channel->Sequence();
-            Firebolt::Error result = Send(method, parameters, id);
+            Firebolt::Error result = Park(id);
+            if (result == Firebolt::Error::None) {
+                result = Send(method, parameters, id);
+            }
             if (result == Firebolt::Error::None) {
-                result = WaitForResponse<RESPONSE>(id, response, _waitTime);
+                result = WaitForResponse<RESPONSE>(id, response, waitTime);
+            } else {
+                _adminLock.Lock();
+                _pendingQueue.erase(id);
+                _adminLock.Unlock();
             }
 
             return (result);
@@ -216,9 +227,12 @@ namespace FireboltSDK
         template <typename PARAMETERS>
         Firebolt::Error InvokeAsync(const string &method, const PARAMETERS &parameters, uint32_t &id)
         {
-            Entry slot;
             id = _channel->Sequence();
-            return Send(method, parameters, id);
+            Firebolt::Error result = Park(id);
+            if (result == Firebolt::Error::None) {
+                result = Send(method, parameters, id);
+            }
+            return result;
         }
 
         template <typename RESPONSE>
@@ -242,8 +256,8 @@ namespace FireboltSDK
                     else {
                         result = WPEFramework::Core::ERROR_NONE;
                         if ((jsonResponse->Result.IsSet() == true)
-                            && (jsonResponse->Result.Value().empty() == false)) {
-                            FromMessage((INTERFACE*)&response, *jsonResponse);
+                            && (jsonResponse->Result.IsNull() == false)) {
+                            FromMessage(&response, *jsonResponse);
                         }
                     }
                 }
@@ -270,6 +284,24 @@ namespace FireboltSDK
             return _channel->Sequence();
         }
 
+        // Makes sure the transport timer fires no later than at the given time (in ticks)
+        void ScheduleTimeout(const uint64_t time)
+        {
+            bool trigger = false;
+            _adminLock.Lock();
+            // One that passed already is the one Timed() may be handling right now, which only merges in
+            // what is still ahead once it is done: not to be relied on
+            if ((_scheduledTime == 0) || (_scheduledTime > time) || (_scheduledTime <= WPEFramework::Core::Time::Now().Ticks())) {
+                _scheduledTime = time;
+                trigger = true;
+            }
+            _adminLock.Unlock();
+
+            if (trigger == true) {
+                Channel::Trigger(time, this);
+            }
+        }
+
         void NotifyStatus(Firebolt::Error status)
         {
             _listener(false, status);
@@ -314,22 +346,6 @@ namespace FireboltSDK
                 message->Error = msg.Error;
             }
 
-            _adminLock.Lock();
-
-            typename std::pair<typename PendingMap::iterator, bool> newElement =
-                _pendingQueue.emplace(std::piecewise_construct,
-                                      std::forward_as_tuple(id),
-                                      std::forward_as_tuple());
-
-            _adminLock.Unlock();
-
-            ASSERT(newElement.second == true);
-
-            if (!newElement.second) {
-                message.Release();
-                return FireboltErrorValue(WPEFramework::Core::ERROR_ASYNC_FAILED);
-            }
-
             _channel->Submit(WPEFramework::Core::ProxyType<INTERFACE>(message));
 
             message.Release();
@@ -355,29 +371,29 @@ namespace FireboltSDK
                 message->Designator = method;
                 ToMessage(parameters, message);
 
-                _adminLock.Lock();
-
-                typename std::pair<typename PendingMap::iterator, bool> newElement =
-                    _pendingQueue.emplace(std::piecewise_construct,
-                                          std::forward_as_tuple(id),
-                                          std::forward_as_tuple());
-                ASSERT(newElement.second == true);
-
-                if (newElement.second == true)
-                {
+                _channel->Submit(WPEFramework::Core::ProxyType<INTERFACE>(message));
 
-                    _adminLock.Unlock();
-
-                    _channel->Submit(WPEFramework::Core::ProxyType<INTERFACE>(message));
-
-                    message.Release();
-                    result = WPEFramework::Core::ERROR_NONE;
-                }
+                message.Release();
+                result = WPEFramework::Core::ERROR_NONE;
             }
             return FireboltErrorValue(result);
         }
 
     private:
+        // Responses of the gateway requests are routed to the ITransportReceiver, only Invoke() waits on a slot
+        Firebolt::Error Park(const uint32_t id)
+        {
+            _adminLock.Lock();
+            typename std::pair<typename PendingMap::iterator, bool> newElement =
+                _pendingQueue.emplace(std::piecewise_construct,
+                                      std::forward_as_tuple(id),
+                                      std::forward_as_tuple());
+            _adminLock.Unlock();
+            ASSERT(newElement.second == true);
+
+            return (newElement.second == true ? Firebolt::Error::None : FireboltErrorValue(WPEFramework::Core::ERROR_ASYNC_FAILED));
+        }
+
         friend Channel;
         inline bool IsEvent(const uint32_t id, string& eventName)
         {
@@ -410,6 +426,13 @@ namespace FireboltSDK
             uint64_t result = ~0;
             uint64_t currentTime = WPEFramework::Core::Time::Now().Ticks();
 
+            if (_transportReceiver != nullptr) {
+                uint64_t next = _transportReceiver->Timed(currentTime);
+                if (next != 0) {
+                    result = next;
+                }
+            }
+
             // Lets see if some callback are expire. If so trigger and remove...
             _adminLock.Lock();
 
@@ -427,11 +450,15 @@ namespace FireboltSDK
                     index++;
                 }
             }
+            // A timeout scheduled while this ran is still ahead
+            if ((_scheduledTime > currentTime) && (_scheduledTime < result)) {
+                result = _scheduledTime;
+            }
             _scheduledTime = (result != static_cast<uint64_t>(~0) ? result : 0);
-
+            result = _scheduledTime;
             _adminLock.Unlock();
 
-            return (_scheduledTime);
+            return (result);
         }
 
         virtual void Opened()
@@ -468,6 +495,20 @@ namespace FireboltSDK
         int32_t Submit(const WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message> &inbound)
         {
             int32_t result = WPEFramework::Core::ERROR_UNAVAILABLE;
+            if ((inbound->Designator.IsSet() == true) && (inbound->Id.IsSet() == false))
+            {
+                // Notifications of an event are delivered in order
+                _events.Submit(inbound->Designator.Value(), inbound);
+                return 0;
+            }
+            if ((inbound->Designator.IsSet() == false) && (CallerExecutor::Instance() != nullptr))
+            {
+                // Responses only wake up their waiters, which may be blocking the thread of the application that
+                // runs the executor. Requests of the platform go to the executor like anything else: the
+                // providers they run belong on the application's thread.
+                Inbound(inbound);
+                return 0;
+            }
             WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch> job = WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch>(WPEFramework::Core::ProxyType<Transport::CommunicationJob>::Create(inbound, this));
             WPEFramework::Core::IWorkerPool::Instance().Submit(job);
             return 0;
@@ -488,6 +529,25 @@ namespace FireboltSDK
 
         static constexpr uint32_t WAITSLOT_TIME = 100;
     public:
+        template <typename RESPONSE>
+        void FromMessage(RESPONSE *response, const WPEFramework::Core::JSONRPC::Message &message) const
+        {
+            FromMessage((INTERFACE *)response, message);
+        }
+
+        // Decoded straight into the public type, out of the frame the response came in: there is no container
+        // nor copy of the result in between
+        template <typename TYPE>
+        void FromMessage(Decoded<TYPE> *response, const WPEFramework::Core::JSONRPC::Message &message) const
+        {
+            const std::string_view result = InboundMessage::Result(message);
+            if (result.empty() == false) {
+                response->FromFrame(result);
+            } else {
+                response->FromString(message.Result.Value());
+            }
+        }
+
         void FromMessage(WPEFramework::Core::JSON::IElement *response, const WPEFramework::Core::JSONRPC::Message &message) const
         {
             response->FromString(message.Result.Value());
@@ -509,6 +569,14 @@ namespace FireboltSDK
             }
         }
 
+        void ToMessage(const std::string_view parameters, WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message> &message) const
+        {
+            if (parameters.empty() != true)
+            {
+                message->Parameters = string(parameters);
+            }
+        }
+
         template <typename PARAMETERS>
         void ToMessage(PARAMETERS &parameters, WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message> &message) const
         {
@@ -575,5 +643,6 @@ namespace FireboltSDK
         Listener _listener;
         bool _connected;
         Firebolt::Error _status;
+        SerialQueues<string, WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message>> _events;
     };
 }
@@ -0,0 +1,300 @@
+/*
+ * Copyright 2024 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "Module.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+namespace FireboltSDK
+{
+    // Runs the jobs and timers of the SDK on a thread of the application, instead of threads of its own.
+    // Descriptor() turns readable whenever something is due, the application then calls Process(), from its
+    // own event loop typically. Installed through Assign(), the SDK falls back to its worker pool without one.
+    class CallerExecutor
+    {
+    public:
+        using Job = WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch>;
+        // Returns the next time (Core::Time ticks) it wants to be called, 0 if none
+        using Timed = std::function<uint64_t()>;
+
+    private:
+        struct Work {
+            Job job;
+            std::function<void()> function;
+        };
+        struct Timer {
+            uint64_t time;
+            const void* owner;
+            Timed timed;
+        };
+
+    public:
+        CallerExecutor(const CallerExecutor&) = delete;
+        CallerExecutor& operator=(const CallerExecutor&) = delete;
+
+        CallerExecutor()
+            : _lock()
+            , _finished()
+            , _work()
+            , _timers()
+            , _running(nullptr)
+            , _runner()
+            , _descriptor(::epoll_create1(EPOLL_CLOEXEC))
+            , _wakeup(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+            , _timer(::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC))
+        {
+            ASSERT((_descriptor != -1) && (_wakeup != -1) && (_timer != -1));
+            Watch(_wakeup);
+            Watch(_timer);
+        }
+        ~CallerExecutor()
+        {
+            ::close(_timer);
+            ::close(_wakeup);
+            ::close(_descriptor);
+        }
+
+        // nullptr unless the application drives the SDK
+        static CallerExecutor* Instance()
+        {
+            return (Installed().load());
+        }
+        static void Assign(CallerExecutor* executor)
+        {
+            Installed().store(executor);
+        }
+
+        // Runs the function from Process() if the application drives the SDK, right away otherwise
+        static void Deliver(const std::function<void()>& function)
+        {
+            CallerExecutor* executor = Instance();
+            if (executor != nullptr) {
+                executor->Post(function);
+            } else {
+                function();
+            }
+        }
+
+    public:
+        int Descriptor() const
+        {
+            return (_descriptor);
+        }
+
+        // Waits up to waitTime ms for work, then runs the timers due and the jobs queued so far. Jobs
+        // submitted meanwhile are left for the next call, the descriptor stays readable for them.
+        // Returns the number of jobs and timers run.
+        uint32_t Process(const uint32_t waitTime)
+        {
+            if (waitTime != 0) {
+                struct epoll_event event;
+                ::epoll_wait(_descriptor, &event, 1, (waitTime == WPEFramework::Core::infinite ? -1 : static_cast<int>(std::min<uint32_t>(waitTime, INT32_MAX))));
+            }
+            Drain(_wakeup);
+            Drain(_timer);
+
+            uint32_t count = RunTimers();
+
+            std::unique_lock lck(_lock);
+            for (size_t queued = _work.size(); (queued > 0) && (_work.empty() == false); --queued) {
+                Work work = std::move(_work.front());
+                _work.pop_front();
+                _running = work.job.operator->();
+                _runner = std::this_thread::get_id();
+                lck.unlock();
+
+                if (work.job.IsValid() == true) {
+                    work.job->Dispatch();
+                } else {
+                    work.function();
+                }
+                work.job.Release();
+                ++count;
+
+                lck.lock();
+                _running = nullptr;
+                _finished.notify_all();
+            }
+            if (_work.empty() == false) {
+                Signal();
+            }
+            return (count);
+        }
+
+        void Submit(const Job& job)
+        {
+            {
+                std::lock_guard lck(_lock);
+                _work.push_back({ job, nullptr });
+            }
+            Signal();
+        }
+
+        void Post(const std::function<void()>& function)
+        {
+            {
+                std::lock_guard lck(_lock);
+                _work.push_back({ Job(), function });
+            }
+            Signal();
+        }
+
+        // A job still queued is dropped, one running is waited for unless it revokes itself
+        uint32_t Revoke(const Job& job, const uint32_t waitTime = WPEFramework::Core::infinite)
+        {
+            const WPEFramework::Core::IDispatch* key = job.operator->();
+            std::unique_lock lck(_lock);
+            bool found = false;
+            for (auto index = _work.begin(); index != _work.end();) {
+                if (index->job.operator->() == key) {
+                    index = _work.erase(index);
+                    found = true;
+                } else {
+                    ++index;
+                }
+            }
+            if ((_running != key) || (_runner == std::this_thread::get_id())) {
+                return ((found == true) || (_running == key) ? WPEFramework::Core::ERROR_NONE : WPEFramework::Core::ERROR_UNKNOWN_KEY);
+            }
+            auto done = [this, key]() { return (_running != key); };
+            if (waitTime == WPEFramework::Core::infinite) {
+                _finished.wait(lck, done);
+                return (WPEFramework::Core::ERROR_NONE);
+            }
+            return (_finished.wait_for(lck, std::chrono::milliseconds(waitTime), done) ? WPEFramework::Core::ERROR_NONE : WPEFramework::Core::ERROR_TIMEDOUT);
+        }
+
+        // One timer per owner, triggering it earlier than it is armed for moves it
+        void Trigger(const uint64_t time, const void* owner, const Timed& timed)
+        {
+            std::lock_guard lck(_lock);
+            auto index = std::find_if(_timers.begin(), _timers.end(), [owner](const Timer& timer) { return (timer.owner == owner); });
+            if (index == _timers.end()) {
+                _timers.push_back({ time, owner, timed });
+            } else if (time < index->time) {
+                index->time = time;
+                index->timed = timed;
+            }
+            Arm();
+        }
+
+        // Returns true if the owner had a timer
+        bool Revoke(const void* owner)
+        {
+            std::lock_guard lck(_lock);
+            auto index = std::remove_if(_timers.begin(), _timers.end(), [owner](const Timer& timer) { return (timer.owner == owner); });
+            const bool found = (index != _timers.end());
+            _timers.erase(index, _timers.end());
+            Arm();
+            return (found);
+        }
+
+    private:
+        static std::atomic<CallerExecutor*>& Installed()
+        {
+            static std::atomic<CallerExecutor*> executor(nullptr);
+            return (executor);
+        }
+
+        void Watch(const int descriptor)
+        {
+            struct epoll_event event = {};
+            event.events = EPOLLIN;
+            event.data.fd = descriptor;
+            ::epoll_ctl(_descriptor, EPOLL_CTL_ADD, descriptor, &event);
+        }
+        void Signal()
+        {
+            uint64_t one = 1;
+            if (::write(_wakeup, &one, sizeof(one)) != sizeof(one)) {
+                // Counter saturated, readable anyway
+            }
+        }
+        static void Drain(const int descriptor)
+        {
+            uint64_t value;
+            while (::read(descriptor, &value, sizeof(value)) > 0) {
+            }
+        }
+
+        uint32_t RunTimers()
+        {
+            std::vector<Timer> due;
+            const uint64_t now = WPEFramework::Core::Time::Now().Ticks();
+            {
+                std::lock_guard lck(_lock);
+                for (auto index = _timers.begin(); index != _timers.end();) {
+                    if (index->time <= now) {
+                        due.push_back(std::move(*index));
+                        index = _timers.erase(index);
+                    } else {
+                        ++index;
+                    }
+                }
+                Arm();
+            }
+            for (Timer& timer : due) {
+                uint64_t next = timer.timed();
+                if (next != 0) {
+                    Trigger(next, timer.owner, timer.timed);
+                }
+            }
+            return (static_cast<uint32_t>(due.size()));
+        }
+
+        // Under the lock, sets the timer descriptor to the earliest timer
+        void Arm()
+        {
+            struct itimerspec value = {};
+            if (_timers.empty() == false) {
+                uint64_t earliest = std::min_element(_timers.begin(), _timers.end(), [](const Timer& lhs, const Timer& rhs) { return (lhs.time < rhs.time); })->time;
+                uint64_t now = WPEFramework::Core::Time::Now().Ticks();
+                // Ticks are us, a zero it_value would disarm the timer
+                uint64_t delay = ((earliest > now) ? (earliest - now) : 1);
+                value.it_value.tv_sec = delay / 1000000;
+                value.it_value.tv_nsec = (delay % 1000000) * 1000;
+            }
+            ::timerfd_settime(_timer, 0, &value, nullptr);
+        }
+
+    private:
+        std::mutex _lock;
+        std::condition_variable _finished;
+        std::deque<Work> _work;
+        std::vector<Timer> _timers;
+        const WPEFramework::Core::IDispatch* _running;
+        std::thread::id _runner;
+        const int _descriptor;
+        const int _wakeup;
+        const int _timer;
+    };
+}
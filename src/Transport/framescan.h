@@ -0,0 +1,218 @@
+/*
+ * Copyright 2023 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace FireboltSDK
+{
+    // Finds where an inbound JSON-RPC frame ends, as its bytes come in, and what it is to be routed on: its id,
+    // its method and whether it is a response. Only the structural characters are looked at, 16 at a time where
+    // SSE2 is there; nothing is decoded, the body is left for the thread that consumes the frame.
+    class FrameScanner
+    {
+    public:
+        struct Route
+        {
+            bool hasId = false;
+            uint32_t id = 0;
+            std::string_view method;
+            bool response = false; // it has a result or an error
+            uint32_t result = 0; // where the value of the result starts in the frame, 0 without one
+        };
+
+        FrameScanner(const FrameScanner&) = delete;
+        FrameScanner& operator=(const FrameScanner&) = delete;
+
+        FrameScanner()
+        {
+            _strings.reserve(8);
+            Reset();
+        }
+
+    public:
+        void Reset()
+        {
+            _offset = 0;
+            _escaped = 0;
+            _depth = 0;
+            _inString = false;
+            _complete = false;
+            _failed = false;
+            _strings.clear();
+        }
+        bool Complete() const
+        {
+            return _complete;
+        }
+        bool Failed() const
+        {
+            return _failed;
+        }
+
+        // Returns how much of data belongs to the frame: all of it, unless the frame ended within
+        uint32_t Feed(const char data[], const uint32_t length)
+        {
+            uint32_t index = 0;
+            while ((index < length) && (_complete == false)) {
+                uint32_t next = Structural(data, index, length);
+                if (_depth == 0) {
+                    // Only whitespace may come before the frame
+                    for (; index < next; ++index) {
+                        if ((data[index] != ' ') && (data[index] != '\t') && (data[index] != '\n') && (data[index] != '\r')) {
+                            _failed = true;
+                            _complete = true;
+                            return length;
+                        }
+                    }
+                    if ((next < length) && (data[next] != '{')) {
+                        _failed = true;
+                        _complete = true;
+                        return length;
+                    }
+                }
+                if (next == length) {
+                    index = length;
+                    break;
+                }
+
+                const uint32_t position = _offset + next;
+                const char c = data[next];
+                index = next + 1;
+                if (_inString == true) {
+                    if (position == _escaped) {
+                    } else if (c == '\\') {
+                        _escaped = position + 1;
+                    } else if (c == '"') {
+                        _inString = false;
+                        if (_depth == 1) {
+                            _strings.back().second = position;
+                        }
+                    }
+                } else if (c == '"') {
+                    _inString = true;
+                    if (_depth == 1) {
+                        _strings.emplace_back(position, position);
+                    }
+                } else if ((c == '{') || (c == '[')) {
+                    ++_depth;
+                } else if ((c == '}') || (c == ']')) {
+                    if (--_depth == 0) {
+                        _complete = true;
+                    }
+                }
+            }
+            _offset += index;
+            return index;
+        }
+
+        // To be called on the complete frame, as it was fed
+        bool Routing(const std::string_view frame, Route& route) const
+        {
+            if ((_complete == false) || (_failed == true)) {
+                return false;
+            }
+            for (size_t index = 0; index < _strings.size(); ++index) {
+                const uint32_t begin = _strings[index].first + 1;
+                const uint32_t end = _strings[index].second;
+                uint32_t value = Skip(frame, end + 1);
+                if ((value >= frame.size()) || (frame[value] != ':')) {
+                    continue;
+                }
+                value = Skip(frame, value + 1);
+
+                const std::string_view key(frame.data() + begin, end - begin);
+                if (key == "id") {
+                    std::from_chars_result result = std::from_chars(frame.data() + value, frame.data() + frame.size(), route.id);
+                    route.hasId = (result.ec == std::errc());
+                } else if (key == "method") {
+                    if ((index + 1 < _strings.size()) && (_strings[index + 1].first == value)) {
+                        route.method = std::string_view(frame.data() + value + 1, _strings[index + 1].second - value - 1);
+                    }
+                } else if (key == "result") {
+                    route.response = true;
+                    route.result = value;
+                } else if (key == "error") {
+                    route.response = true;
+                }
+            }
+            return true;
+        }
+
+    private:
+        static uint32_t Skip(const std::string_view frame, uint32_t index)
+        {
+            while ((index < frame.size()) && ((frame[index] == ' ') || (frame[index] == '\t') || (frame[index] == '\n') || (frame[index] == '\r'))) {
+                ++index;
+            }
+            return index;
+        }
+
+        // Index of the next character that may change the state: a quote or a backslash, or a bracket outside
+        // of strings, length when there is none
+        uint32_t Structural(const char data[], uint32_t index, const uint32_t length) const
+        {
+#if defined(__SSE2__)
+            const __m128i quote = _mm_set1_epi8('"');
+            const __m128i backslash = _mm_set1_epi8('\\');
+            // '[' and ']' fold onto '{' and '}' with bit 5 set, nothing else does
+            const __m128i fold = _mm_set1_epi8(0x20);
+            const __m128i open = _mm_set1_epi8('{');
+            const __m128i close = _mm_set1_epi8('}');
+            for (; index + 16 <= length; index += 16) {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+                __m128i matches = _mm_or_si128(_mm_cmpeq_epi8(block, quote), _mm_cmpeq_epi8(block, backslash));
+                if (_inString == false) {
+                    const __m128i folded = _mm_or_si128(block, fold);
+                    matches = _mm_or_si128(matches, _mm_or_si128(_mm_cmpeq_epi8(folded, open), _mm_cmpeq_epi8(folded, close)));
+                }
+                const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(matches));
+                if (mask != 0) {
+                    return index + __builtin_ctz(mask);
+                }
+            }
+#endif
+            for (; index < length; ++index) {
+                const char c = data[index];
+                if ((c == '"') || (c == '\\') || ((_inString == false) && ((c == '{') || (c == '}') || (c == '[') || (c == ']')))) {
+                    break;
+                }
+            }
+            return index;
+        }
+
+    private:
+        uint32_t _offset;
+        uint32_t _escaped;
+        uint32_t _depth;
+        bool _inString;
+        bool _complete;
+        bool _failed;
+        // Strings at the top level of the frame, keys and values, by the positions of their quotes
+        std::vector<std::pair<uint32_t, uint32_t>> _strings;
+    };
+}
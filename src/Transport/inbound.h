@@ -0,0 +1,162 @@
+/*
+ * Copyright 2023 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "Module.h"
+#include "framescan.h"
+
+#include <algorithm>
+#include <string_view>
+
+namespace FireboltSDK
+{
+    // The JSON-RPC message the channel receives into. On the channel thread only the frame is kept and what
+    // it is routed on is taken out: Id and Designator. Everything else, Result, Parameters and Error, is parsed
+    // by Parse(), once the consumer of the message is known, on its thread. Frames nobody takes are dropped
+    // unparsed. Outbound messages are not affected, they come from the same pool.
+    class InboundMessage : public WPEFramework::Core::JSONRPC::Message
+    {
+    public:
+        InboundMessage(const InboundMessage&) = delete;
+        InboundMessage& operator=(const InboundMessage&) = delete;
+
+        InboundMessage()
+            : WPEFramework::Core::JSONRPC::Message()
+            , _frame()
+            , _scanner()
+            , _response(false)
+            , _parsed(true)
+            , _result(0)
+        {
+        }
+        ~InboundMessage() override = default;
+
+    public:
+        // No-ops for messages that were not received as an InboundMessage, those are parsed already
+        static void Parse(const WPEFramework::Core::JSONRPC::Message& message)
+        {
+            const InboundMessage* inbound = dynamic_cast<const InboundMessage*>(&message);
+            if (inbound != nullptr) {
+                const_cast<InboundMessage*>(inbound)->Parse();
+            }
+        }
+        static bool IsResponse(const WPEFramework::Core::JSONRPC::Message& message)
+        {
+            const InboundMessage* inbound = dynamic_cast<const InboundMessage*>(&message);
+            if ((inbound != nullptr) && (inbound->_parsed == false)) {
+                return (inbound->_response);
+            }
+            return ((message.Result.IsSet() == true) || (message.Error.IsSet() == true));
+        }
+        // The text of the result, straight out of the frame the message was received in, for it to be decoded
+        // without the copy Result holds. It runs on with the rest of the frame: what follows the value is not
+        // cut off. Empty for messages that were not received as an InboundMessage, or carry no result; it
+        // stays valid as long as the message is held.
+        static std::string_view Result(const WPEFramework::Core::JSONRPC::Message& message)
+        {
+            const InboundMessage* inbound = dynamic_cast<const InboundMessage*>(&message);
+            if ((inbound != nullptr) && (inbound->_result != 0)) {
+                return std::string_view(inbound->_frame).substr(inbound->_result);
+            }
+            return std::string_view();
+        }
+
+        // Back to a message just constructed for the pool to hand out again, the frame keeps its capacity
+        void Recycle()
+        {
+            Clear();
+            _frame.clear();
+            _scanner.Reset();
+            _response = false;
+            _parsed = true;
+            _result = 0;
+        }
+
+        using WPEFramework::Core::JSONRPC::Message::Deserialize;
+        uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint32_t& offset, WPEFramework::Core::OptionalType<WPEFramework::Core::JSON::Error>& error) override
+        {
+            if (offset == 0) {
+                Clear();
+                _frame.clear();
+                _scanner.Reset();
+                _response = false;
+                _parsed = false;
+                _result = 0;
+            }
+
+            uint32_t loaded = _scanner.Feed(stream, maxLength);
+            _frame.append(stream, loaded);
+
+            if (_scanner.Complete() == false) {
+                offset += loaded;
+            } else {
+                offset = 0;
+                FrameScanner::Route route;
+                if (_scanner.Routing(_frame, route) == true) {
+                    if (route.hasId == true) {
+                        Id = route.id;
+                    }
+                    if (route.method.empty() == false) {
+                        Designator = string(route.method);
+                    }
+                    _response = route.response;
+                    _result = route.result;
+                } else {
+                    // Not a JSON-RPC object, give it to the parser to report
+                    _parsed = true;
+                    Parse(_frame, error);
+                }
+            }
+            return (static_cast<uint16_t>(loaded));
+        }
+
+    private:
+        void Parse()
+        {
+            if (_parsed == false) {
+                _parsed = true;
+                WPEFramework::Core::OptionalType<WPEFramework::Core::JSON::Error> error;
+                Parse(_frame, error);
+                if (error.IsSet() == true) {
+                    TRACE_L1("Inbound frame failed to parse, id: %u", Id.Value());
+                }
+            }
+        }
+        void Parse(const string& frame, WPEFramework::Core::OptionalType<WPEFramework::Core::JSON::Error>& error)
+        {
+            uint32_t offset = 0;
+            size_t loaded = 0;
+            while ((loaded < frame.size()) && (error.IsSet() == false)) {
+                const uint16_t size = static_cast<uint16_t>(std::min<size_t>(frame.size() - loaded, 0xFFFF));
+                const uint16_t handled = WPEFramework::Core::JSONRPC::Message::Deserialize(frame.data() + loaded, size, offset, error);
+                if (handled == 0) {
+                    break;
+                }
+                loaded += handled;
+            }
+        }
+
+    private:
+        string _frame;
+        FrameScanner _scanner;
+        bool _response;
+        bool _parsed;
+        uint32_t _result;
+    };
+}
@@ -0,0 +1,278 @@
+/*
+ * Copyright 2023 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "Module.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace FireboltSDK
+{
+    // What is shared by the pools of all message types: their limits and statistics
+    class MessagePool
+    {
+    public:
+        struct Limits
+        {
+            uint32_t threadHighWater; // kept by a thread before it hands some over to the shared list
+            uint32_t threadLowWater;  // what it keeps of them, and takes from the shared list when it ran out
+            uint32_t sharedHighWater; // kept in the shared list, anything beyond that is freed
+        };
+
+        struct Statistics
+        {
+            uint32_t created;
+            uint32_t threadHits; // served from the cache of the calling thread
+            uint32_t sharedHits; // served from the shared list
+            uint32_t spilled;    // handed over to the shared list by a thread that had too many
+            uint32_t freed;      // the shared list was full
+            uint32_t shared;     // in the shared list now
+        };
+
+        static constexpr Limits DefaultLimits = { 16, 8, 64 };
+
+        // Takes effect on the next message returned, low water marks above the high ones are capped
+        static void Configure(const Limits& limits)
+        {
+            _threadHighWater.store(limits.threadHighWater, std::memory_order_relaxed);
+            _threadLowWater.store(std::min(limits.threadLowWater, limits.threadHighWater), std::memory_order_relaxed);
+            _sharedHighWater.store(limits.sharedHighWater, std::memory_order_relaxed);
+        }
+        static Limits Configuration()
+        {
+            return { _threadHighWater.load(std::memory_order_relaxed), _threadLowWater.load(std::memory_order_relaxed), _sharedHighWater.load(std::memory_order_relaxed) };
+        }
+
+    protected:
+        static inline std::atomic<uint32_t> _threadHighWater { DefaultLimits.threadHighWater };
+        static inline std::atomic<uint32_t> _threadLowWater { DefaultLimits.threadLowWater };
+        static inline std::atomic<uint32_t> _sharedHighWater { DefaultLimits.sharedHighWater };
+    };
+
+    // Recycled messages of one type. A message is handed out as a ProxyType like the ones of a ProxyPoolType, but
+    // once its last reference is gone it is cleared, keeping the capacity of its strings, and put in a cache of
+    // the thread that released it: no lock is taken as long as a thread gets back what it released. Only threads
+    // with more than the high water mark spill them to a shared list, which threads that ran out take batches from.
+    // The channel thread receiving every message and the worker threads releasing them are balanced through that.
+    template <typename ELEMENT>
+    class MessagePoolType : public MessagePool
+    {
+    private:
+        class Pooled : public ELEMENT, public WPEFramework::Core::IReferenceCounted
+        {
+        public:
+            Pooled(const Pooled&) = delete;
+            Pooled& operator=(const Pooled&) = delete;
+
+            Pooled()
+                : ELEMENT()
+                , _refCount(0)
+            {
+            }
+            ~Pooled() override = default;
+
+        public:
+            uint32_t AddRef() const override
+            {
+                _refCount.fetch_add(1, std::memory_order_relaxed);
+                return (WPEFramework::Core::ERROR_NONE);
+            }
+            uint32_t Release() const override
+            {
+                if (_refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    MessagePoolType::Instance().Return(const_cast<Pooled*>(this));
+                    return (WPEFramework::Core::ERROR_DESTRUCTION_SUCCEEDED);
+                }
+                return (WPEFramework::Core::ERROR_NONE);
+            }
+
+        private:
+            mutable std::atomic<uint32_t> _refCount;
+        };
+
+        // Messages with more to reset than their JSON members, like InboundMessage, provide a Recycle()
+        template <typename TYPE, typename = void>
+        struct HasRecycle : std::false_type {};
+        template <typename TYPE>
+        struct HasRecycle<TYPE, std::void_t<decltype(std::declval<TYPE&>().Recycle())>> : std::true_type {};
+
+        class Cache
+        {
+        public:
+            Cache(const Cache&) = delete;
+            Cache& operator=(const Cache&) = delete;
+
+            Cache()
+                : elements()
+            {
+                elements.reserve(_threadHighWater.load(std::memory_order_relaxed) + 1);
+            }
+            ~Cache()
+            {
+                _exited = true;
+                for (Pooled* element : elements) {
+                    delete element;
+                }
+            }
+
+        public:
+            std::vector<Pooled*> elements;
+        };
+
+    public:
+        MessagePoolType(const MessagePoolType&) = delete;
+        MessagePoolType& operator=(const MessagePoolType&) = delete;
+
+        // Never destructed, messages may be released after exit() ran
+        static MessagePoolType& Instance()
+        {
+            static MessagePoolType* instance = new MessagePoolType();
+            return (*instance);
+        }
+
+    private:
+        MessagePoolType()
+            : _lock()
+            , _shared()
+            , _created(0)
+            , _threadHits(0)
+            , _sharedHits(0)
+            , _spilled(0)
+            , _freed(0)
+        {
+        }
+
+    public:
+        WPEFramework::Core::ProxyType<ELEMENT> Element()
+        {
+            Pooled* element = nullptr;
+            Cache* cache = Local();
+
+            if ((cache != nullptr) && (cache->elements.empty() == false)) {
+                element = cache->elements.back();
+                cache->elements.pop_back();
+                _threadHits.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                element = Take(cache);
+            }
+            if (element == nullptr) {
+                element = new Pooled();
+                _created.fetch_add(1, std::memory_order_relaxed);
+            }
+            return (WPEFramework::Core::ProxyType<ELEMENT>(static_cast<WPEFramework::Core::IReferenceCounted&>(*element), static_cast<ELEMENT&>(*element)));
+        }
+
+        Statistics Stats() const
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            return { _created.load(), _threadHits.load(), _sharedHits.load(), _spilled.load(), _freed.load(), static_cast<uint32_t>(_shared.size()) };
+        }
+
+    private:
+        // Messages may still be released on an exiting thread once its cache is gone, those go to the shared list
+        static Cache* Local()
+        {
+            if (_exited == true) {
+                return (nullptr);
+            }
+            static thread_local Cache cache;
+            return (&cache);
+        }
+
+        // One from the shared list, and the thread cache refilled up to the low water mark along with it
+        Pooled* Take(Cache* cache)
+        {
+            Pooled* element = nullptr;
+            std::lock_guard<std::mutex> lock(_lock);
+
+            if (_shared.empty() == false) {
+                element = _shared.back();
+                _shared.pop_back();
+                _sharedHits.fetch_add(1, std::memory_order_relaxed);
+
+                if (cache != nullptr) {
+                    const size_t batch = std::min<size_t>(_shared.size(), _threadLowWater.load(std::memory_order_relaxed));
+                    cache->elements.insert(cache->elements.end(), _shared.end() - batch, _shared.end());
+                    _shared.resize(_shared.size() - batch);
+                }
+            }
+            return (element);
+        }
+
+        void Return(Pooled* element)
+        {
+            if constexpr (HasRecycle<ELEMENT>::value) {
+                element->Recycle();
+            } else {
+                element->Clear();
+            }
+
+            Cache* cache = Local();
+            if (cache != nullptr) {
+                cache->elements.push_back(element);
+                if (cache->elements.size() > _threadHighWater.load(std::memory_order_relaxed)) {
+                    Spill(cache->elements, _threadLowWater.load(std::memory_order_relaxed));
+                }
+            } else {
+                std::vector<Pooled*> single = { element };
+                Spill(single, 0);
+            }
+        }
+
+        // Everything beyond keep goes to the shared list, or is freed once that one is full
+        void Spill(std::vector<Pooled*>& elements, const size_t keep)
+        {
+            std::vector<Pooled*> freed;
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+                const size_t room = _sharedHighWater.load(std::memory_order_relaxed);
+
+                while (elements.size() > keep) {
+                    if (_shared.size() < room) {
+                        _shared.push_back(elements.back());
+                        _spilled.fetch_add(1, std::memory_order_relaxed);
+                    } else {
+                        freed.push_back(elements.back());
+                        _freed.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    elements.pop_back();
+                }
+            }
+            for (Pooled* element : freed) {
+                delete element;
+            }
+        }
+
+    private:
+        static inline thread_local bool _exited = false;
+
+        mutable std::mutex _lock;
+        std::vector<Pooled*> _shared;
+        std::atomic<uint32_t> _created;
+        std::atomic<uint32_t> _threadHits;
+        std::atomic<uint32_t> _sharedHits;
+        std::atomic<uint32_t> _spilled;
+        std::atomic<uint32_t> _freed;
+    };
+}
@@ -0,0 +1,175 @@
+/*
+ * Copyright 2024 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "Module.h"
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+
+namespace FireboltSDK
+{
+    // Serial queues multiplexed over the worker pool: the items of a given key are handled one after the
+    // other in the order they were submitted, different keys still run in parallel. A key with pending items
+    // has a single job in the pool, which handles up to BatchSize of them and then submits itself again if
+    // there are more, so a busy key cannot starve the others. Revoke() takes the jobs back out of the pool,
+    // their owner calls it before whatever the handler uses goes away.
+    template <typename KEY, typename ITEM>
+    class SerialQueues
+    {
+    public:
+        using Handler = std::function<void(const ITEM& item)>;
+
+        // Items handled by a job in a row while more are pending
+        static constexpr uint32_t BatchSize = 8;
+
+    private:
+        using Queues = std::map<KEY, std::deque<ITEM>>;
+        using Jobs = std::map<KEY, WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch>>;
+
+        class Job : public WPEFramework::Core::IDispatch
+        {
+        protected:
+            Job(SerialQueues& parent, const KEY& key)
+                : _parent(parent)
+                , _key(key)
+            {
+            }
+
+        public:
+            Job() = delete;
+            Job(const Job&) = delete;
+            Job& operator=(const Job&) = delete;
+
+            ~Job() = default;
+
+        public:
+            void Dispatch() override
+            {
+                _parent.Drain(_key);
+            }
+
+        private:
+            SerialQueues& _parent;
+            const KEY _key;
+        };
+
+    public:
+        SerialQueues(const SerialQueues&) = delete;
+        SerialQueues& operator=(const SerialQueues&) = delete;
+
+        SerialQueues(const Handler& handler)
+            : _handler(handler)
+            , _queues()
+            , _jobs()
+            , _mtx()
+            , _revoked(false)
+        {
+        }
+        ~SerialQueues()
+        {
+            Revoke();
+        }
+
+        // Ignored once revoked
+        void Submit(const KEY& key, const ITEM& item)
+        {
+            std::lock_guard lck(_mtx);
+            if (_revoked == false) {
+                std::deque<ITEM>& queue = _queues[key];
+                queue.push_back(item);
+                if (queue.size() == 1) {
+                    Schedule(key);
+                }
+            }
+        }
+
+        // Drops the pending items and waits for the ones being handled, no handler runs once it returns.
+        // Must not be called from a handler.
+        void Revoke()
+        {
+            Jobs jobs;
+            {
+                std::lock_guard lck(_mtx);
+                _revoked = true;
+                jobs.swap(_jobs);
+            }
+            for (auto& job : jobs) {
+                WPEFramework::Core::IWorkerPool::Instance().Revoke(job.second);
+            }
+
+            std::lock_guard lck(_mtx);
+            _queues.clear();
+        }
+
+    private:
+        // With the lock held, so that Revoke() finds every job that is in the pool
+        void Schedule(const KEY& key)
+        {
+            WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch> job(WPEFramework::Core::ProxyType<Job>::Create(*this, key));
+            _jobs[key] = job;
+            WPEFramework::Core::IWorkerPool::Instance().Submit(job);
+        }
+
+        // The item stays queued while handled, the key is only idle again once its queue is empty
+        void Drain(const KEY& key)
+        {
+            ITEM item;
+            {
+                std::lock_guard lck(_mtx);
+                if (_revoked == true) {
+                    return;
+                }
+                typename Queues::iterator index = _queues.find(key);
+                ASSERT(index != _queues.end());
+                item = index->second.front();
+            }
+
+            for (uint32_t handled = 1; ; ++handled) {
+                _handler(item);
+
+                std::lock_guard lck(_mtx);
+                if (_revoked == true) {
+                    break;
+                }
+                typename Queues::iterator index = _queues.find(key);
+                index->second.pop_front();
+                if (index->second.empty() == true) {
+                    _queues.erase(index);
+                    _jobs.erase(key);
+                    break;
+                }
+                if (handled == BatchSize) {
+                    // Back to the end of the pool queue, to give way to the other keys
+                    Schedule(key);
+                    break;
+                }
+                item = index->second.front();
+            }
+        }
+
+    private:
+        const Handler _handler;
+        Queues _queues;
+        Jobs _jobs; // the job in the pool for each key with pending items
+        std::mutex _mtx;
+        bool _revoked;
+    };
+}
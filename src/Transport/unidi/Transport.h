@@ -22,6 +22,10 @@
 #include "error.h"
 #include "json_engine.h"
 #include "Transport/CommunicationChannel.h"
+#include "Transport/serialqueues.h"
+#include "Gateway/cancellation.h"
+#include "Gateway/common.h"
+#include "Gateway/jsonreader.h"
 
 namespace FireboltSDK
 {
@@ -32,6 +36,8 @@ namespace FireboltSDK
     public:
         virtual Firebolt::Error ValidateResponse(const WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message> &jsonResponse, bool &enabled) = 0;
         virtual Firebolt::Error Dispatch(const string &eventName, const WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message> &jsonResponse) = 0;
+        // Driven by the transport timer, returns the next time (Core::Time ticks) it wants to be called, 0 if none
+        virtual uint64_t Timed(const uint64_t currentTime) = 0;
         virtual ~IEventHandler() = default;
     };
 
@@ -39,9 +45,22 @@ namespace FireboltSDK
     class Transport
     {
     private:
-        using Channel = CommunicationChannel<WPEFramework::Core::SocketStream, INTERFACE, Transport, WPEFramework::Core::JSONRPC::Message>;
-        using Entry = typename CommunicationChannel<WPEFramework::Core::SocketStream, INTERFACE, Transport, WPEFramework::Core::JSONRPC::Message>::Entry;
+        using Channel = CommunicationChannel<ChannelSocket, INTERFACE, Transport, WPEFramework::Core::JSONRPC::Message>;
+        using Entry = typename CommunicationChannel<ChannelSocket, INTERFACE, Transport, WPEFramework::Core::JSONRPC::Message>::Entry;
         using PendingMap = std::unordered_map<uint32_t, Entry>;
+
+    public:
+        // Completion of an InvokeAsync(): its status, and the raw result when it succeeded
+        using Completed = std::function<void(const Firebolt::Error status, const string& result)>;
+
+    private:
+        struct AsyncCall {
+            uint64_t expiry; // Core::Time ticks, 0 if the call has no deadline
+            Completed completed;
+            CancellationToken token;
+        };
+        using AsyncMap = std::unordered_map<uint32_t, AsyncCall>;
+        // Event name, as sent on the wire, to the id of its listen request; notifications carry that id
         using EventMap = std::map<string, uint32_t>;
         typedef std::function<uint32_t(const WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message> &jsonResponse, bool &enabled)> EventResponseValidatioionFunction;
 
@@ -123,7 +142,7 @@ namespace FireboltSDK
         Transport(const Transport &) = delete;
         Transport &operator=(Transport &) = delete;
         Transport(const WPEFramework::Core::URL &url, const uint32_t waitTime, const Listener listener)
-            : _adminLock(), _connectId(WPEFramework::Core::NodeId(url.Host().Value().c_str(), url.Port().Value())), _channel(Channel::Instance(_connectId, ((url.Path().Value().rfind(PathPrefix, 0) == 0) ? url.Path().Value() : string(PathPrefix + url.Path().Value())), url.Query().Value(), true)), _eventHandler(nullptr), _pendingQueue(), _scheduledTime(0), _waitTime(waitTime), _listener(listener), _connected(false), _status(Firebolt::Error::NotConnected)
+            : _adminLock(), _connectId(WPEFramework::Core::NodeId(url.Host().Value().c_str(), url.Port().Value())), _channel(Channel::Instance(_connectId, ((url.Path().Value().rfind(PathPrefix, 0) == 0) ? url.Path().Value() : string(PathPrefix + url.Path().Value())), url.Query().Value(), true)), _eventHandler(nullptr), _pendingQueue(), _asyncQueue(), _scheduledTime(0), _waitTime(waitTime), _listener(listener), _connected(false), _status(Firebolt::Error::NotConnected), _events([this](const WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message> &inbound) { Inbound(inbound); })
         {
             _channel->Register(*this);
             WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch> job = WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch>(WPEFramework::Core::ProxyType<Transport::ConnectionJob>::Create(this));
@@ -133,11 +152,14 @@ namespace FireboltSDK
         virtual ~Transport()
         {
             _channel->Unregister(*this);
+            // Nothing comes in anymore, the notifications still queued would run on a transport going away
+            _events.Revoke();
 
             for (auto &element : _pendingQueue)
             {
                 element.second.Abort(element.first);
             }
+            AbortAsync();
         }
 
     public:
@@ -174,9 +196,11 @@ namespace FireboltSDK
 // Invoke method is overriden for unit testing to call MockResponse method from JSON engine
 #ifdef UNIT_TEST
         template <typename PARAMETERS, typename RESPONSE>
-        Firebolt::Error Invoke(const string &method, const PARAMETERS &parameters, RESPONSE &response)
+        Firebolt::Error Invoke(const string &method, const PARAMETERS &parameters, RESPONSE &response, const uint32_t waitTime, const CancellationToken& token = CancellationToken())
         {
-            Entry slot;
+            if (token.IsCancelled() == true) {
+                return Firebolt::Error::Cancelled;
+            }
             uint32_t id = _channel->Sequence();
             Firebolt::Error result = Send(method, parameters, id);
 
@@ -184,30 +208,81 @@ namespace FireboltSDK
             message.Designator = method;
             std::unique_ptr<JsonEngine> jsonEngine = std::make_unique<JsonEngine>();
             result = jsonEngine->MockResponse(message, response);
-            FromMessage((INTERFACE *)&response, message);
+            FromMessage(&response, message);
             return (result);
         }
+
+        template <typename PARAMETERS>
+        Firebolt::Error InvokeAsync(const string& method, const PARAMETERS& parameters, const uint32_t waitTime, const Completed& completed, const CancellationToken& token = CancellationToken())
+        {
+            if (token.IsCancelled() == true) {
+                return Firebolt::Error::Cancelled;
+            }
+            WPEFramework::Core::JSONRPC::Message message;
+            message.Designator = method;
+            string unused;
+            std::unique_ptr<JsonEngine> jsonEngine = std::make_unique<JsonEngine>();
+            Firebolt::Error result = jsonEngine->MockResponse(message, unused);
+            completed(result, message.Result.Value());
+            return (Firebolt::Error::None);
+        }
 #else
         template <typename PARAMETERS, typename RESPONSE>
-        Firebolt::Error Invoke(const string& method, const PARAMETERS& parameters, RESPONSE& response)
+        Firebolt::Error Invoke(const string& method, const PARAMETERS& parameters, RESPONSE& response, const uint32_t waitTime, const CancellationToken& token = CancellationToken())
         {
-            Entry slot;
+            if (token.IsCancelled() == true) {
+                return Firebolt::Error::Cancelled;
+            }
             uint32_t id = _channel->Sequence();
             Firebolt::Error result = Send(method, parameters, id);
             if (result == Firebolt::Error::None) {
-                result = WaitForResponse<RESPONSE>(id, response, _waitTime);
+                if (token.Bind([this, id]() { Abort(id); }) == true) {
+                    result = WaitForResponse<RESPONSE>(id, response, waitTime);
+                    token.Unbind();
+                } else {
+                    _adminLock.Lock();
+                    _pendingQueue.erase(id);
+                    _adminLock.Unlock();
+                    result = Firebolt::Error::Cancelled;
+                }
             }
 
             return (result);
         }
 #endif
 
+        // Does not wait for the response: completed runs once, from the worker dispatching the response, the
+        // timer noticing the deadline passed or the thread cancelling the token. It is not run when the request
+        // could not be sent, the error is returned instead.
         template <typename PARAMETERS>
-        Firebolt::Error InvokeAsync(const string &method, const PARAMETERS &parameters, uint32_t &id)
+        Firebolt::Error InvokeAsync(const string& method, const PARAMETERS& parameters, const uint32_t waitTime, const Completed& completed, const CancellationToken& token = CancellationToken())
         {
-            Entry slot;
-            id = _channel->Sequence();
-            return Send(method, parameters, id);
+            if (token.IsCancelled() == true) {
+                return Firebolt::Error::Cancelled;
+            }
+            uint32_t id = _channel->Sequence();
+            uint64_t expiry = (waitTime != WPEFramework::Core::infinite) ? WPEFramework::Core::Time::Now().Add(waitTime).Ticks() : 0;
+
+            // Registered before sending, the response may come back before Send() returns
+            _adminLock.Lock();
+            _asyncQueue.emplace(std::piecewise_construct, std::forward_as_tuple(id), std::forward_as_tuple(AsyncCall { expiry, completed, token }));
+            _adminLock.Unlock();
+
+            Firebolt::Error result = Firebolt::Error::Cancelled;
+            if (token.Bind([this, id]() { Complete(id, Firebolt::Error::Cancelled); }) == true) {
+                result = Send(method, parameters, id, false);
+                if (result != Firebolt::Error::None) {
+                    token.Unbind();
+                } else if (expiry != 0) {
+                    ScheduleTimeout(expiry);
+                }
+            }
+            if (result != Firebolt::Error::None) {
+                _adminLock.Lock();
+                _asyncQueue.erase(id);
+                _adminLock.Unlock();
+            }
+            return (result);
         }
 
         template <typename RESPONSE>
@@ -220,19 +295,26 @@ namespace FireboltSDK
             _adminLock.Unlock();
 
             if (slot.WaitForResponse(waitTime) == true) {
-                WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message> jsonResponse = slot.Response();
+                if (slot.HasResponse() == false) {
+                    // Signalled without a response, the request got aborted
+                    result = WPEFramework::Core::ERROR_ASYNC_ABORTED;
+                }
+                else {
+                    WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message> jsonResponse = slot.Response();
 
-                // See if we have a jsonResponse, maybe it was just the connection
-                // that closed?
-                if (jsonResponse.IsValid() == true) {
-                    if (jsonResponse->Error.IsSet() == true) {
-                        result = jsonResponse->Error.Code.Value();
-                    }
-                    else {
-                        result = WPEFramework::Core::ERROR_NONE;
-                        if ((jsonResponse->Result.IsSet() == true)
-                            && (jsonResponse->Result.Value().empty() == false)) {
-                            FromMessage((INTERFACE*)&response, *jsonResponse);
+                    // See if we have a jsonResponse, maybe it was just the connection
+                    // that closed?
+                    if (jsonResponse.IsValid() == true) {
+                        InboundMessage::Parse(*jsonResponse);
+                        if (jsonResponse->Error.IsSet() == true) {
+                            result = jsonResponse->Error.Code.Value();
+                        }
+                        else {
+                            result = WPEFramework::Core::ERROR_NONE;
+                            if ((jsonResponse->Result.IsSet() == true)
+                                && (jsonResponse->Result.IsNull() == false)) {
+                                FromMessage(&response, *jsonResponse);
+                            }
                         }
                     }
                 }
@@ -249,9 +331,44 @@ namespace FireboltSDK
         {
             _adminLock.Lock();
             typename PendingMap::iterator index = _pendingQueue.find(id);
-            Entry &slot(index->second);
+            // The response might have been handled already
+            if (index != _pendingQueue.end()) {
+                index->second.Abort(id);
+            }
             _adminLock.Unlock();
-            slot.Abort(id);
+        }
+
+        // Takes the call out of the queue, whoever gets it runs its completion outside of the lock
+        void Complete(const uint32_t id, const Firebolt::Error status, const string& result = string())
+        {
+            Completed completed;
+            CancellationToken token;
+            _adminLock.Lock();
+            typename AsyncMap::iterator index = _asyncQueue.find(id);
+            if (index != _asyncQueue.end()) {
+                completed = std::move(index->second.completed);
+                token = index->second.token;
+                _asyncQueue.erase(index);
+            }
+            _adminLock.Unlock();
+
+            if (completed) {
+                token.Unbind();
+                CallerExecutor::Deliver([completed, status, result]() { completed(status, result); });
+            }
+        }
+
+        void AbortAsync()
+        {
+            std::vector<uint32_t> ids;
+            _adminLock.Lock();
+            for (const auto& element : _asyncQueue) {
+                ids.push_back(element.first);
+            }
+            _adminLock.Unlock();
+            for (const uint32_t id : ids) {
+                Complete(id, Firebolt::Error::Cancelled);
+            }
         }
 
         template <typename RESPONSE>
@@ -274,13 +391,45 @@ namespace FireboltSDK
 
                 _adminLock.Unlock();
 
-                result = WaitForEventResponse(id, eventName, response, _waitTime, eventMap);
+                result = WaitForEventResponse(id, eventName, response, Config::WaitTime(eventName), eventMap);
               
             }
 
             return result;
         }
 
+        // Sends every listen request before waiting for the first response
+        template <typename RESPONSE>
+        Firebolt::Error SubscribeMany(const std::vector<std::pair<string, string>>& requests, std::vector<Firebolt::Error>& statuses)
+        {
+            std::vector<uint32_t> ids(requests.size());
+            statuses.assign(requests.size(), Firebolt::Error::None);
+
+            for (size_t i = 0; i < requests.size(); ++i) {
+                ids[i] = _channel->Sequence();
+                statuses[i] = Send(requests[i].first, requests[i].second, ids[i]);
+                if (statuses[i] == Firebolt::Error::None) {
+                    _adminLock.Lock();
+                    _externalEventMap.emplace(std::piecewise_construct,
+                                    std::forward_as_tuple(requests[i].first),
+                                    std::forward_as_tuple(ids[i]));
+                    _adminLock.Unlock();
+                }
+            }
+
+            Firebolt::Error result = Firebolt::Error::None;
+            for (size_t i = 0; i < requests.size(); ++i) {
+                if (statuses[i] == Firebolt::Error::None) {
+                    RESPONSE response;
+                    statuses[i] = WaitForEventResponse(ids[i], requests[i].first, response, Config::WaitTime(requests[i].first), _externalEventMap);
+                }
+                if (result == Firebolt::Error::None) {
+                    result = statuses[i];
+                }
+            }
+            return result;
+        }
+
         Firebolt::Error Unsubscribe(const string &eventName, const string &parameters)
         {
             Revoke(eventName);
@@ -290,6 +439,23 @@ namespace FireboltSDK
             return Send(eventName, parameters, id);
         }
 
+        void ScheduleTimeout(const uint64_t time)
+        {
+            bool trigger = false;
+            _adminLock.Lock();
+            // One that passed already is the one Timed() may be handling right now, which only merges in
+            // what is still ahead once it is done: not to be relied on
+            if ((_scheduledTime == 0) || (_scheduledTime > time) || (_scheduledTime <= WPEFramework::Core::Time::Now().Ticks())) {
+                _scheduledTime = time;
+                trigger = true;
+            }
+            _adminLock.Unlock();
+
+            if (trigger == true) {
+                Channel::Trigger(time, this);
+            }
+        }
+
         void NotifyStatus(Firebolt::Error status)
         {
             _listener(false, status);
@@ -347,6 +513,13 @@ namespace FireboltSDK
             uint64_t result = ~0;
             uint64_t currentTime = WPEFramework::Core::Time::Now().Ticks();
 
+            if (_eventHandler != nullptr) {
+                uint64_t next = _eventHandler->Timed(currentTime);
+                if (next != 0) {
+                    result = next;
+                }
+            }
+
             // Lets see if some callback are expire. If so trigger and remove...
             _adminLock.Lock();
 
@@ -364,11 +537,29 @@ namespace FireboltSDK
                     index++;
                 }
             }
+            std::vector<uint32_t> outdated;
+            for (const auto& element : _asyncQueue) {
+                if (element.second.expiry != 0) {
+                    if (element.second.expiry <= currentTime) {
+                        outdated.push_back(element.first);
+                    } else if (element.second.expiry < result) {
+                        result = element.second.expiry;
+                    }
+                }
+            }
+            // A timeout scheduled while this ran is still ahead
+            if ((_scheduledTime > currentTime) && (_scheduledTime < result)) {
+                result = _scheduledTime;
+            }
             _scheduledTime = (result != static_cast<uint64_t>(~0) ? result : 0);
-
+            result = _scheduledTime;
             _adminLock.Unlock();
 
-            return (_scheduledTime);
+            for (const uint32_t id : outdated) {
+                Complete(id, Firebolt::Error::Timedout);
+            }
+
+            return (result);
         }
 
         virtual void Opened()
@@ -395,6 +586,7 @@ namespace FireboltSDK
             }
 
             _adminLock.Unlock();
+            AbortAsync();
             if (_connected != false)
             {
                 _connected = false;
@@ -405,6 +597,24 @@ namespace FireboltSDK
         int32_t Submit(const WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message> &inbound)
         {
             int32_t result = WPEFramework::Core::ERROR_UNAVAILABLE;
+            if ((inbound->Id.IsSet() == true) && (InboundMessage::IsResponse(*inbound) == true))
+            {
+                _adminLock.Lock();
+                bool pending = (_pendingQueue.find(inbound->Id.Value()) != _pendingQueue.end()) || (_asyncQueue.find(inbound->Id.Value()) != _asyncQueue.end());
+                _adminLock.Unlock();
+                if (pending == false)
+                {
+                    // Events are answers to their subscription request, delivered in order
+                    _events.Submit(inbound->Id.Value(), inbound);
+                    return 0;
+                }
+                if (CallerExecutor::Instance() != nullptr)
+                {
+                    // Waiters may be blocking the thread of the application, which runs the executor
+                    Inbound(inbound);
+                    return 0;
+                }
+            }
             WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch> job = WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch>(WPEFramework::Core::ProxyType<Transport::CommunicationJob>::Create(inbound, this));
             WPEFramework::Core::IWorkerPool::Instance().Submit(job);
             return 0;
@@ -416,10 +626,9 @@ namespace FireboltSDK
 
             ASSERT(inbound.IsValid() == true);
 
-            if ((inbound->Id.IsSet() == true) && (inbound->Result.IsSet() || inbound->Error.IsSet()))
+            if ((inbound->Id.IsSet() == true) && (InboundMessage::IsResponse(*inbound) == true))
             {
                 // Looks like this is a response..
-                ASSERT(inbound->Parameters.IsSet() == false);
                 ASSERT(inbound->Designator.IsSet() == false);
 
                 _adminLock.Lock();
@@ -429,7 +638,7 @@ namespace FireboltSDK
 
                 if (index != _pendingQueue.end())
                 {
-
+                    // Only the frame is handed over, the waiter parses it once out of the lock
                     if (index->second.Signal(inbound) == true)
                     {
                         _pendingQueue.erase(index);
@@ -438,12 +647,24 @@ namespace FireboltSDK
                     result = WPEFramework::Core::ERROR_NONE;
                     _adminLock.Unlock();
                 }
+                else if (_asyncQueue.find(inbound->Id.Value()) != _asyncQueue.end())
+                {
+                    _adminLock.Unlock();
+                    InboundMessage::Parse(*inbound);
+                    if (inbound->Error.IsSet() == true) {
+                        Complete(inbound->Id.Value(), FireboltErrorValue(inbound->Error.Code.Value()));
+                    } else {
+                        Complete(inbound->Id.Value(), Firebolt::Error::None, inbound->Result.Value());
+                    }
+                    result = WPEFramework::Core::ERROR_NONE;
+                }
                 else
                 {
                     _adminLock.Unlock();
                     string eventName;
                     if (IsEvent(inbound->Id.Value(), eventName))
                     {
+                        InboundMessage::Parse(*inbound);
                         _eventHandler->Dispatch(eventName, inbound);
                     }
                 }
@@ -452,8 +673,9 @@ namespace FireboltSDK
             return (result);
         }
 
+        // An asynchronous call has its slot in the async queue already
         template <typename PARAMETERS>
-        Firebolt::Error Send(const string &method, const PARAMETERS &parameters, const uint32_t &id)
+        Firebolt::Error Send(const string &method, const PARAMETERS &parameters, const uint32_t &id, const bool synchronous = true)
         {
             int32_t result = WPEFramework::Core::ERROR_UNAVAILABLE;
 
@@ -473,13 +695,18 @@ namespace FireboltSDK
 
                 _adminLock.Lock();
 
-                typename std::pair<typename PendingMap::iterator, bool> newElement =
-                    _pendingQueue.emplace(std::piecewise_construct,
-                                          std::forward_as_tuple(id),
-                                          std::forward_as_tuple());
-                ASSERT(newElement.second == true);
+                bool registered = true;
+                if (synchronous == true)
+                {
+                    typename std::pair<typename PendingMap::iterator, bool> newElement =
+                        _pendingQueue.emplace(std::piecewise_construct,
+                                              std::forward_as_tuple(id),
+                                              std::forward_as_tuple());
+                    ASSERT(newElement.second == true);
+                    registered = newElement.second;
+                }
 
-                if (newElement.second == true)
+                if (registered == true)
                 {
 
                     _adminLock.Unlock();
@@ -517,7 +744,7 @@ template <typename RESPONSE>
             Entry &slot(index->second);
             _adminLock.Unlock();
 
-            uint8_t waiting = waitTime;
+            uint32_t waiting = waitTime;
             do
             {
                 uint32_t waitSlot = (waiting > WAITSLOT_TIME ? WAITSLOT_TIME : waiting);
@@ -529,19 +756,20 @@ template <typename RESPONSE>
                     // that closed?
                     if (jsonResponse.IsValid() == true)
                     {
+                        InboundMessage::Parse(*jsonResponse);
                         if (jsonResponse->Error.IsSet() == true)
                         {
                             result = FireboltErrorValue(jsonResponse->Error.Code.Value());
                         }
                         else
                         {
-                            if ((jsonResponse->Result.IsSet() == true) && (jsonResponse->Result.Value().empty() == false))
+                            if ((jsonResponse->Result.IsSet() == true) && (jsonResponse->Result.IsNull() == false))
                             {
                                 bool enabled;
                                 result = _eventHandler->ValidateResponse(jsonResponse, enabled);
                                 if (result == Firebolt::Error::None)
                                 {
-                                    FromMessage((INTERFACE *)&response, *jsonResponse);
+                                    FromMessage(&response, *jsonResponse);
                                     if (enabled)
                                     {
                                         _adminLock.Lock();
@@ -571,6 +799,25 @@ template <typename RESPONSE>
         }
 #endif
     public:
+        template <typename RESPONSE>
+        void FromMessage(RESPONSE *response, const WPEFramework::Core::JSONRPC::Message &message) const
+        {
+            FromMessage((INTERFACE *)response, message);
+        }
+
+        // Decoded straight into the public type, out of the frame the response came in: there is no container
+        // nor copy of the result in between
+        template <typename TYPE>
+        void FromMessage(Decoded<TYPE> *response, const WPEFramework::Core::JSONRPC::Message &message) const
+        {
+            const std::string_view result = InboundMessage::Result(message);
+            if (result.empty() == false) {
+                response->FromFrame(result);
+            } else {
+                response->FromString(message.Result.Value());
+            }
+        }
+
         void FromMessage(WPEFramework::Core::JSON::IElement *response, const WPEFramework::Core::JSONRPC::Message &message) const
         {
             response->FromString(message.Result.Value());
@@ -592,6 +839,14 @@ template <typename RESPONSE>
             }
         }
 
+        void ToMessage(const std::string_view parameters, WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message> &message) const
+        {
+            if (parameters.empty() != true)
+            {
+                message->Parameters = string(parameters);
+            }
+        }
+
         template <typename PARAMETERS>
         void ToMessage(PARAMETERS &parameters, WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message> &message) const
         {
@@ -637,6 +892,9 @@ template <typename RESPONSE>
             case WPEFramework::Core::ERROR_TIMEDOUT:
                 fireboltError = Firebolt::Error::Timedout;
                 break;
+            case WPEFramework::Core::ERROR_ASYNC_ABORTED:
+                fireboltError = Firebolt::Error::Cancelled;
+                break;
             default:
                 break;
             }
@@ -650,6 +908,7 @@ template <typename RESPONSE>
         WPEFramework::Core::ProxyType<Channel> _channel;
         IEventHandler *_eventHandler;
         PendingMap _pendingQueue;
+        AsyncMap _asyncQueue;
         EventMap _internalEventMap;
         EventMap _externalEventMap;
         EventMap _eventMap;
@@ -658,5 +917,6 @@ template <typename RESPONSE>
         Listener _listener;
         bool _connected;
         Firebolt::Error _status;
+        SerialQueues<uint32_t, WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message>> _events;
     };
 }
\ No newline at end of file
@@ -0,0 +1,551 @@
+/*
+ * Copyright 2023 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace FireboltSDK
+{
+    // Drives the I/O of a connected stream socket from a thread of its own, on io_uring when the kernel
+    // allows: a multishot receive fills buffers out of a registered buffer ring, outbound data is gathered
+    // into a registered buffer and written with one submission, which shares its io_uring_enter() with
+    // waiting for the next completions. Kernels without io_uring (or with it disabled) get the readiness
+    // based loop a SocketStream runs, poll() then recv()/send(), behind the same interface.
+    class UringEngine
+    {
+    public:
+        // Fills buffer with outbound data, returns 0 once there is nothing left to send
+        using Pull = std::function<uint16_t(uint8_t* buffer, const uint16_t maxSize)>;
+        // Hands inbound data over, returns how much of it got consumed
+        using Push = std::function<uint16_t(uint8_t* buffer, const uint16_t size)>;
+        // The connection got closed by the peer or failed, called once from the engine thread
+        using Closed = std::function<void()>;
+
+        struct Statistics {
+            uint64_t syscalls;
+            uint64_t received; // bytes
+            uint64_t sent;
+        };
+
+        static constexpr uint16_t ReceiveBuffers = 16; // power of 2, the size of the buffer ring
+        static constexpr uint32_t RingEntries = 16;
+
+    private:
+        enum Tag : uint64_t { Receive = 1, Wakeup = 2, Send = 3 };
+
+        // Just enough of liburing: the submission and completion queues, mapped
+        class Ring
+        {
+        public:
+            Ring(const Ring&) = delete;
+            Ring& operator=(const Ring&) = delete;
+
+            Ring() = default;
+            ~Ring()
+            {
+                if (_sqes != nullptr) {
+                    ::munmap(_sqes, _sqesSize);
+                }
+                if (_cqMap != nullptr && _cqMap != _sqMap) {
+                    ::munmap(_cqMap, _cqMapSize);
+                }
+                if (_sqMap != nullptr) {
+                    ::munmap(_sqMap, _sqMapSize);
+                }
+                if (_fd != -1) {
+                    ::close(_fd);
+                }
+            }
+
+            bool Setup(const uint32_t entries)
+            {
+                struct io_uring_params params;
+                ::memset(&params, 0, sizeof(params));
+                _fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+                if (_fd < 0) {
+                    _fd = -1;
+                    return false;
+                }
+                _sqMapSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+                _cqMapSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+                if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0) {
+                    _sqMapSize = _cqMapSize = std::max(_sqMapSize, _cqMapSize);
+                }
+                _sqMap = Map(_sqMapSize, IORING_OFF_SQ_RING);
+                if (_sqMap == nullptr) {
+                    return false;
+                }
+                _cqMap = ((params.features & IORING_FEAT_SINGLE_MMAP) != 0) ? _sqMap : Map(_cqMapSize, IORING_OFF_CQ_RING);
+                _sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+                _sqes = static_cast<struct io_uring_sqe*>(Map(_sqesSize, IORING_OFF_SQES));
+                if (_cqMap == nullptr || _sqes == nullptr) {
+                    return false;
+                }
+
+                uint8_t* sq = static_cast<uint8_t*>(_sqMap);
+                _sqTail = reinterpret_cast<uint32_t*>(sq + params.sq_off.tail);
+                _sqHead = reinterpret_cast<uint32_t*>(sq + params.sq_off.head);
+                _sqMask = *reinterpret_cast<uint32_t*>(sq + params.sq_off.ring_mask);
+                _sqArray = reinterpret_cast<uint32_t*>(sq + params.sq_off.array);
+                _sqEntries = params.sq_entries;
+
+                uint8_t* cq = static_cast<uint8_t*>(_cqMap);
+                _cqHead = reinterpret_cast<uint32_t*>(cq + params.cq_off.head);
+                _cqTail = reinterpret_cast<uint32_t*>(cq + params.cq_off.tail);
+                _cqMask = *reinterpret_cast<uint32_t*>(cq + params.cq_off.ring_mask);
+                _cqes = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+                return true;
+            }
+
+            int Descriptor() const
+            {
+                return _fd;
+            }
+
+            // Cleared, nullptr if the submission queue is full
+            struct io_uring_sqe* Get()
+            {
+                uint32_t tail = *_sqTail + _queued;
+                if (tail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE) >= _sqEntries) {
+                    return nullptr;
+                }
+                uint32_t index = tail & _sqMask;
+                struct io_uring_sqe* sqe = &_sqes[index];
+                ::memset(sqe, 0, sizeof(*sqe));
+                _sqArray[index] = index;
+                ++_queued;
+                return sqe;
+            }
+
+            // Submits what got queued and waits for wait completions, a single system call
+            int Enter(const uint32_t wait)
+            {
+                __atomic_store_n(_sqTail, *_sqTail + _queued, __ATOMIC_RELEASE);
+                uint32_t submit = _queued;
+                _queued = 0;
+                int result = static_cast<int>(::syscall(__NR_io_uring_enter, _fd, submit, wait, (wait > 0 ? IORING_ENTER_GETEVENTS : 0), nullptr, 0));
+                return (result < 0 ? -errno : result);
+            }
+
+            template <typename HANDLER>
+            void Reap(HANDLER&& handler)
+            {
+                uint32_t head = *_cqHead;
+                while (head != __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE)) {
+                    const struct io_uring_cqe& cqe = _cqes[head & _cqMask];
+                    handler(cqe.user_data, cqe.res, cqe.flags);
+                    ++head;
+                    __atomic_store_n(_cqHead, head, __ATOMIC_RELEASE);
+                }
+            }
+
+        private:
+            void* Map(const size_t size, const off_t offset)
+            {
+                void* memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, offset);
+                return (memory == MAP_FAILED ? nullptr : memory);
+            }
+
+        private:
+            int _fd = -1;
+            void* _sqMap = nullptr;
+            void* _cqMap = nullptr;
+            size_t _sqMapSize = 0;
+            size_t _cqMapSize = 0;
+            size_t _sqesSize = 0;
+            struct io_uring_sqe* _sqes = nullptr;
+            uint32_t* _sqHead = nullptr;
+            uint32_t* _sqTail = nullptr;
+            uint32_t* _sqArray = nullptr;
+            uint32_t _sqMask = 0;
+            uint32_t _sqEntries = 0;
+            uint32_t _queued = 0;
+            uint32_t* _cqHead = nullptr;
+            uint32_t* _cqTail = nullptr;
+            uint32_t _cqMask = 0;
+            struct io_uring_cqe* _cqes = nullptr;
+        };
+
+    public:
+        UringEngine(const UringEngine&) = delete;
+        UringEngine& operator=(const UringEngine&) = delete;
+
+        UringEngine(const int descriptor, const uint16_t sendBufferSize, const uint16_t receiveBufferSize, const Pull& pull, const Push& push, const Closed& closed)
+            : _descriptor(descriptor)
+            , _wakeup(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+            , _pull(pull)
+            , _push(push)
+            , _closed(closed)
+            , _sendBuffer(sendBufferSize)
+            , _receiveSize(receiveBufferSize)
+            , _receiveBuffers(nullptr)
+            , _bufferRing(nullptr)
+            , _bufferRingSize(0)
+            , _ring()
+            , _uring(false)
+            , _multishot(true)
+            , _running(false)
+            , _triggered(true)
+            , _sending(false)
+            , _sendLength(0)
+            , _sendOffset(0)
+            , _wakeupValue(0)
+            , _inbound()
+            , _syscalls(0)
+            , _received(0)
+            , _sent(0)
+            , _thread()
+        {
+        }
+        ~UringEngine()
+        {
+            Stop();
+            if (_bufferRing != nullptr) {
+                ::munmap(_bufferRing, _bufferRingSize);
+            }
+            delete[] _receiveBuffers;
+            ::close(_wakeup);
+        }
+
+        // Falls back on the readiness loop if io_uring, a buffer ring or registered buffers are not available
+        void Start(const bool preferUring = true)
+        {
+            _uring = (preferUring == true) && (SetupUring() == true);
+            _running = true;
+            _thread = std::thread([this]() {
+                if (_uring == true) {
+                    UringLoop();
+                } else {
+                    ReadinessLoop();
+                }
+                if (_running.exchange(false) == true) {
+                    _closed();
+                }
+            });
+        }
+
+        void Stop()
+        {
+            _running = false;
+            Wake();
+            if (_thread.joinable() == true) {
+                _thread.join();
+            }
+        }
+
+        // There is something to send, the engine pulls it from its own thread
+        void Trigger()
+        {
+            _triggered = true;
+            Wake();
+        }
+
+        bool IsUring() const
+        {
+            return _uring;
+        }
+
+        bool IsEngineThread() const
+        {
+            return (_thread.get_id() == std::this_thread::get_id());
+        }
+
+        Statistics Stats() const
+        {
+            return Statistics{ _syscalls.load(), _received.load(), _sent.load() };
+        }
+
+    private:
+        void Wake()
+        {
+            uint64_t one = 1;
+            if (::write(_wakeup, &one, sizeof(one)) != sizeof(one)) {
+                // Counter saturated, readable anyway
+            }
+        }
+
+        bool SetupUring()
+        {
+            if (_ring.Setup(RingEntries) == false) {
+                return false;
+            }
+
+            // Receive side: a ring of provided buffers the kernel picks from, kernel 5.19 and up
+            _receiveBuffers = new uint8_t[static_cast<size_t>(ReceiveBuffers) * _receiveSize];
+            _bufferRingSize = ReceiveBuffers * sizeof(struct io_uring_buf);
+            void* memory = ::mmap(nullptr, _bufferRingSize, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+            if (memory == MAP_FAILED) {
+                return false;
+            }
+            _bufferRing = static_cast<struct io_uring_buf_ring*>(memory);
+            struct io_uring_buf_reg registration;
+            ::memset(&registration, 0, sizeof(registration));
+            registration.ring_addr = reinterpret_cast<uint64_t>(_bufferRing);
+            registration.ring_entries = ReceiveBuffers;
+            registration.bgid = 0;
+            if (::syscall(__NR_io_uring_register, _ring.Descriptor(), IORING_REGISTER_PBUF_RING, &registration, 1) != 0) {
+                return false;
+            }
+            for (uint16_t index = 0; index < ReceiveBuffers; ++index) {
+                Provide(index, index);
+            }
+            __atomic_store_n(&_bufferRing->tail, ReceiveBuffers, __ATOMIC_RELEASE);
+
+            // Send side: one registered buffer, the kernel does not map it on every write
+            struct iovec vector = { _sendBuffer.data(), _sendBuffer.size() };
+            return (::syscall(__NR_io_uring_register, _ring.Descriptor(), IORING_REGISTER_BUFFERS, &vector, 1) == 0);
+        }
+
+        // Buffer id goes in slot offset after the current tail, published with the tail
+        void Provide(const uint16_t id, const uint16_t offset)
+        {
+            // Not through bufs[]: the empty struct __DECLARE_FLEX_ARRAY puts in front of it takes a byte in C++,
+            // which moves it 8 bytes off the ring the kernel sees
+            struct io_uring_buf& buffer = reinterpret_cast<struct io_uring_buf*>(_bufferRing)[(_bufferRing->tail + offset) & (ReceiveBuffers - 1)];
+            buffer.addr = reinterpret_cast<uint64_t>(_receiveBuffers + static_cast<size_t>(id) * _receiveSize);
+            buffer.len = _receiveSize;
+            buffer.bid = id;
+        }
+
+        void ArmReceive()
+        {
+            struct io_uring_sqe* sqe = _ring.Get();
+            sqe->opcode = IORING_OP_RECV;
+            sqe->fd = _descriptor;
+            sqe->flags = IOSQE_BUFFER_SELECT;
+            sqe->buf_group = 0;
+            sqe->ioprio = (_multishot == true ? IORING_RECV_MULTISHOT : 0);
+            sqe->user_data = Receive;
+        }
+
+        void ArmWakeup()
+        {
+            struct io_uring_sqe* sqe = _ring.Get();
+            sqe->opcode = IORING_OP_READ;
+            sqe->fd = _wakeup;
+            sqe->addr = reinterpret_cast<uint64_t>(&_wakeupValue);
+            sqe->len = sizeof(_wakeupValue);
+            sqe->user_data = Wakeup;
+        }
+
+        void QueueSend()
+        {
+            struct io_uring_sqe* sqe = _ring.Get();
+            sqe->opcode = IORING_OP_WRITE_FIXED;
+            sqe->fd = _descriptor;
+            sqe->addr = reinterpret_cast<uint64_t>(_sendBuffer.data() + _sendOffset);
+            sqe->len = static_cast<uint32_t>(_sendLength - _sendOffset);
+            sqe->buf_index = 0;
+            sqe->user_data = Send;
+            _sending = true;
+        }
+
+        // Gathers as many pending frames as fit in the send buffer
+        bool Fill()
+        {
+            _triggered = false;
+            _sendLength = 0;
+            _sendOffset = 0;
+            while (_sendLength < _sendBuffer.size()) {
+                uint16_t size = _pull(_sendBuffer.data() + _sendLength, static_cast<uint16_t>(std::min<size_t>(_sendBuffer.size() - _sendLength, 0xFFFF)));
+                if (size == 0) {
+                    break;
+                }
+                _sendLength += size;
+            }
+            return (_sendLength > 0);
+        }
+
+        void Deliver(uint8_t* data, size_t size)
+        {
+            _received += size;
+            if (_inbound.empty() == false) {
+                _inbound.insert(_inbound.end(), data, data + size);
+                data = _inbound.data();
+                size = _inbound.size();
+            }
+            size_t offset = 0;
+            while (offset < size) {
+                uint16_t used = _push(data + offset, static_cast<uint16_t>(std::min<size_t>(size - offset, 0xFFFF)));
+                if (used == 0) {
+                    break;
+                }
+                offset += used;
+            }
+            // Only what is left over gets copied, for the next time
+            if (_inbound.empty() == true) {
+                _inbound.assign(data + offset, data + size);
+            } else {
+                _inbound.erase(_inbound.begin(), _inbound.begin() + offset);
+            }
+        }
+
+        void UringLoop()
+        {
+            ArmReceive();
+            ArmWakeup();
+            bool open = true;
+            while ((open == true) && (_running == true)) {
+                if ((_sending == false) && (_triggered == true) && (Fill() == true)) {
+                    QueueSend();
+                }
+                ++_syscalls;
+                int result = _ring.Enter(1);
+                if (result < 0 && result != -EINTR && result != -EAGAIN && result != -EBUSY) {
+                    break;
+                }
+                _ring.Reap([&](const uint64_t tag, const int32_t res, const uint32_t flags) {
+                    switch (tag) {
+                    case Receive:
+                        if (res > 0 && (flags & IORING_CQE_F_BUFFER) != 0) {
+                            uint16_t id = static_cast<uint16_t>(flags >> IORING_CQE_BUFFER_SHIFT);
+                            Deliver(_receiveBuffers + static_cast<size_t>(id) * _receiveSize, static_cast<size_t>(res));
+                            Provide(id, 0);
+                            __atomic_store_n(&_bufferRing->tail, static_cast<uint16_t>(_bufferRing->tail + 1), __ATOMIC_RELEASE);
+                        } else if (res == -EINVAL && _multishot == true) {
+                            // Multishot receive came with kernel 6.0, a buffer selecting one shot does as well
+                            _multishot = false;
+                        } else if (res == 0 || (res < 0 && res != -ENOBUFS && res != -EINTR && res != -EAGAIN)) {
+                            open = false;
+                            break;
+                        }
+                        if ((flags & IORING_CQE_F_MORE) == 0) {
+                            ArmReceive();
+                        }
+                        break;
+                    case Wakeup:
+                        _triggered = true;
+                        ArmWakeup();
+                        break;
+                    case Send:
+                        if (res > 0) {
+                            _sent += res;
+                            _sendOffset += res;
+                        } else if (res != -EINTR && res != -EAGAIN) {
+                            open = false;
+                            break;
+                        }
+                        _sending = false;
+                        if (_sendOffset < _sendLength) {
+                            QueueSend();
+                        } else {
+                            // Whatever got queued meanwhile goes out now
+                            _triggered = true;
+                        }
+                        break;
+                    }
+                });
+            }
+        }
+
+        void ReadinessLoop()
+        {
+            std::vector<uint8_t> receiveBuffer(_receiveSize);
+            bool open = true;
+            while ((open == true) && (_running == true)) {
+                if ((_sendOffset == _sendLength) && (_triggered == true)) {
+                    Fill();
+                }
+                if (_sendOffset < _sendLength) {
+                    // Optimistic, the socket is writable most of the time
+                    ++_syscalls;
+                    ssize_t sent = ::send(_descriptor, _sendBuffer.data() + _sendOffset, _sendLength - _sendOffset, MSG_NOSIGNAL | MSG_DONTWAIT);
+                    if (sent > 0) {
+                        _sent += sent;
+                        _sendOffset += sent;
+                        if (_sendOffset == _sendLength) {
+                            _triggered = true;
+                            continue;
+                        }
+                    } else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                        break;
+                    }
+                }
+
+                struct pollfd descriptors[2] = {
+                    { _descriptor, static_cast<short>(POLLIN | (_sendOffset < _sendLength ? POLLOUT : 0)), 0 },
+                    { _wakeup, POLLIN, 0 }
+                };
+                ++_syscalls;
+                if (::poll(descriptors, 2, -1) < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    break;
+                }
+                if ((descriptors[1].revents & POLLIN) != 0) {
+                    ++_syscalls;
+                    uint64_t value;
+                    if (::read(_wakeup, &value, sizeof(value)) == sizeof(value)) {
+                        _triggered = true;
+                    }
+                }
+                if ((descriptors[0].revents & (POLLIN | POLLHUP | POLLERR)) != 0) {
+                    ++_syscalls;
+                    ssize_t received = ::recv(_descriptor, receiveBuffer.data(), receiveBuffer.size(), MSG_DONTWAIT);
+                    if (received > 0) {
+                        Deliver(receiveBuffer.data(), static_cast<size_t>(received));
+                    } else if (received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+                        open = false;
+                    }
+                }
+            }
+        }
+
+    private:
+        const int _descriptor;
+        const int _wakeup;
+        Pull _pull;
+        Push _push;
+        Closed _closed;
+        std::vector<uint8_t> _sendBuffer;
+        const uint16_t _receiveSize;
+        uint8_t* _receiveBuffers;
+        struct io_uring_buf_ring* _bufferRing;
+        size_t _bufferRingSize;
+        Ring _ring;
+        bool _uring;
+        bool _multishot;
+        std::atomic<bool> _running;
+        std::atomic<bool> _triggered;
+        bool _sending;
+        size_t _sendLength;
+        size_t _sendOffset;
+        uint64_t _wakeupValue;
+        std::vector<uint8_t> _inbound;
+        std::atomic<uint64_t> _syscalls;
+        std::atomic<uint64_t> _received;
+        std::atomic<uint64_t> _sent;
+        std::thread _thread;
+    };
+}
@@ -0,0 +1,269 @@
+/*
+ * Copyright 2023 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "Module.h"
+#include "uring.h"
+
+#include <memory>
+#include <mutex>
+
+#include <fcntl.h>
+
+namespace FireboltSDK
+{
+    // Stands in for WPEFramework::Core::SocketStream as the link of the websocket channel, with the I/O on
+    // an UringEngine rather than on the resource monitor thread. Only the part of the SocketStream interface
+    // the websocket client relies on is there.
+    class UringSocketStream
+    {
+    private:
+        enum class State : uint8_t { Closed, Opening, Open, Error };
+
+    public:
+        UringSocketStream() = delete;
+        UringSocketStream(const UringSocketStream&) = delete;
+        UringSocketStream& operator=(const UringSocketStream&) = delete;
+
+        UringSocketStream(const bool /* rawSocket */, const WPEFramework::Core::NodeId& localNode, const WPEFramework::Core::NodeId& remoteNode, const uint16_t sendBufferSize, const uint16_t receiveBufferSize)
+            : _lock()
+            , _localNode(localNode)
+            , _remoteNode(remoteNode)
+            , _sendBufferSize(sendBufferSize)
+            , _receiveBufferSize(receiveBufferSize)
+            , _descriptor(-1)
+            , _state(State::Closed)
+            , _engine()
+        {
+        }
+        // Like for a SocketStream, the derived class closes the link, no StateChange() is reported from here
+        virtual ~UringSocketStream()
+        {
+            Shutdown();
+        }
+
+    public:
+        virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) = 0;
+        virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) = 0;
+        virtual void StateChange() = 0;
+        virtual bool Initialize()
+        {
+            return true;
+        }
+
+    public:
+        const WPEFramework::Core::NodeId& LocalNode() const
+        {
+            return _localNode;
+        }
+        const WPEFramework::Core::NodeId& RemoteNode() const
+        {
+            return _remoteNode;
+        }
+        string LocalId() const
+        {
+            return _localNode.HostAddress();
+        }
+        string RemoteId() const
+        {
+            return _remoteNode.HostAddress();
+        }
+        uint16_t SendBufferSize() const
+        {
+            return _sendBufferSize;
+        }
+        uint16_t ReceiveBufferSize() const
+        {
+            return _receiveBufferSize;
+        }
+        bool IsOpen() const
+        {
+            return (_state == State::Open);
+        }
+        bool IsOpening() const
+        {
+            return (_state == State::Opening);
+        }
+        bool IsClosed() const
+        {
+            return (_state == State::Closed) || (_state == State::Error);
+        }
+        bool HasError() const
+        {
+            return (_state == State::Error);
+        }
+        bool IsSuspended() const
+        {
+            return false;
+        }
+        bool IsListening() const
+        {
+            return false;
+        }
+        bool IsConnected() const
+        {
+            return IsOpen();
+        }
+
+        // The connect itself is blocking, bounded by waitTime
+        uint32_t Open(const uint32_t waitTime, const string& /* specificInterface */ = string())
+        {
+            std::unique_ptr<UringEngine> stale;
+            {
+                std::lock_guard<std::mutex> lck(_lock);
+                if (_state != State::Closed && _state != State::Error) {
+                    return WPEFramework::Core::ERROR_ILLEGAL_STATE;
+                }
+                // Left by a close from its own thread or by the peer closing, done by now or about to be
+                stale = std::move(_engine);
+            }
+            if (stale != nullptr) {
+                stale->Stop();
+            }
+
+            std::unique_lock<std::mutex> lck(_lock);
+            if (_descriptor != -1) {
+                ::close(_descriptor);
+                _descriptor = -1;
+            }
+            _state = State::Opening;
+            _descriptor = ::socket(_remoteNode.Type(), SOCK_STREAM | SOCK_CLOEXEC, 0);
+            uint32_t result = Connect(waitTime);
+            if (result != WPEFramework::Core::ERROR_NONE || Initialize() == false) {
+                ::close(_descriptor);
+                _descriptor = -1;
+                _state = State::Error;
+                return (result != WPEFramework::Core::ERROR_NONE ? result : WPEFramework::Core::ERROR_GENERAL);
+            }
+
+            _engine.reset(new UringEngine(_descriptor, _sendBufferSize, _receiveBufferSize,
+                [this](uint8_t* buffer, const uint16_t maxSize) { return SendData(buffer, maxSize); },
+                [this](uint8_t* buffer, const uint16_t size) { return ReceiveData(buffer, size); },
+                [this]() { Closing(); }));
+            _engine->Start();
+            _state = State::Open;
+            lck.unlock();
+
+            StateChange();
+            _engine->Trigger();
+            return WPEFramework::Core::ERROR_NONE;
+        }
+
+        uint32_t Close(const uint32_t /* waitTime */)
+        {
+            if (Shutdown() == true) {
+                StateChange();
+            }
+            return WPEFramework::Core::ERROR_NONE;
+        }
+
+        void Trigger()
+        {
+            std::lock_guard<std::mutex> lck(_lock);
+            if (_engine != nullptr) {
+                _engine->Trigger();
+            }
+        }
+
+        void Flush()
+        {
+        }
+
+        UringEngine::Statistics Stats() const
+        {
+            std::lock_guard<std::mutex> lck(_lock);
+            return (_engine != nullptr ? _engine->Stats() : UringEngine::Statistics{ 0, 0, 0 });
+        }
+
+    private:
+        uint32_t Connect(const uint32_t waitTime)
+        {
+            int flags = ::fcntl(_descriptor, F_GETFL, 0);
+            ::fcntl(_descriptor, F_SETFL, flags | O_NONBLOCK);
+            if (::connect(_descriptor, static_cast<const struct sockaddr*>(_remoteNode), _remoteNode.Size()) != 0) {
+                if (errno != EINPROGRESS) {
+                    return WPEFramework::Core::ERROR_COULD_NOT_SET_ADDRESS;
+                }
+                struct pollfd descriptor = { _descriptor, POLLOUT, 0 };
+                int timeout = (waitTime == WPEFramework::Core::infinite ? -1 : static_cast<int>(waitTime));
+                if (::poll(&descriptor, 1, timeout) != 1) {
+                    return WPEFramework::Core::ERROR_TIMEDOUT;
+                }
+                int error = 0;
+                socklen_t length = sizeof(error);
+                if (::getsockopt(_descriptor, SOL_SOCKET, SO_ERROR, &error, &length) != 0 || error != 0) {
+                    return WPEFramework::Core::ERROR_CONNECTION_CLOSED;
+                }
+            }
+            return WPEFramework::Core::ERROR_NONE;
+        }
+
+        // Returns true if the link was open
+        bool Shutdown()
+        {
+            std::unique_ptr<UringEngine> engine;
+            bool open = false;
+            {
+                std::lock_guard<std::mutex> lck(_lock);
+                open = (_state == State::Open);
+                _state = State::Closed;
+                if (_engine != nullptr && _engine->IsEngineThread() == true) {
+                    // Closed from a callback of the engine, which ends once the socket is shut down. Stopped by
+                    // the next Open() or the destructor.
+                    ::shutdown(_descriptor, SHUT_RDWR);
+                } else {
+                    engine = std::move(_engine);
+                }
+            }
+            // Out of the lock, the engine thread may be reporting the peer closing
+            if (engine != nullptr) {
+                engine->Stop();
+            }
+            std::lock_guard<std::mutex> lck(_lock);
+            if (_engine == nullptr && _descriptor != -1) {
+                ::close(_descriptor);
+                _descriptor = -1;
+            }
+            return open;
+        }
+
+        // From the engine thread, the peer went away
+        void Closing()
+        {
+            {
+                std::lock_guard<std::mutex> lck(_lock);
+                if (_state != State::Open) {
+                    return;
+                }
+                _state = State::Error;
+            }
+            StateChange();
+        }
+
+    private:
+        mutable std::mutex _lock;
+        const WPEFramework::Core::NodeId _localNode;
+        const WPEFramework::Core::NodeId _remoteNode;
+        const uint16_t _sendBufferSize;
+        const uint16_t _receiveBufferSize;
+        int _descriptor;
+        std::atomic<State> _state;
+        std::unique_ptr<UringEngine> _engine;
+    };
+}
@@ -22,41 +22,35 @@
 
 namespace FireboltSDK {
 namespace JSON {
+// Holds the one copy of the text the base class parsed into, there is no second std::string caching it.
+// Value() hands that out by value: assigning it to a std::string moves it in place.
 class String : public WPEFramework::Core::JSON::String {
     using Base = WPEFramework::Core::JSON::String;
     public:
         String()
             : Base()
-            , _value()
         {
         }
         String(const char value[])
             : Base(value)
-            , _value(value)
         {
         }
         String& operator=(const char RHS[])
         {
             Base::operator = (RHS);
-            _value = RHS;
             return (*this);
         }
-        String& operator=(const string RHS)
+        String& operator=(const string& RHS)
         {
             Base::operator = (RHS);
-            _value = RHS;
             return (*this);
         }
 
     public:
-        const string& Value() const
+        string Value() const
         {
-            _value = Base::Value();
-            return _value;
+            return Base::Value();
         }
-
-    private:
-        mutable std::string _value;
     };
 }
 }
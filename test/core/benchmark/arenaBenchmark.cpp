@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include "Gateway/arena.h"
+#include "Gateway/jsonreader.h"
+#include "Gateway/jsonwriter.h"
+
+#include <iostream>
+#include <string>
+#include <unordered_map>
+
+namespace {
+    struct Entry {
+        std::string identifier;
+        std::string title;
+        int32_t rating;
+    };
+
+    bool Decode(FireboltSDK::JsonReader& reader, Entry& value)
+    {
+        std::string_view key;
+        bool decoded = reader.BeginObject();
+        while ((decoded == true) && (reader.Next(key) == true)) {
+            if (key == "identifierOfTheEntry") {
+                decoded = reader.Read(value.identifier);
+            } else if (key == "titleOfTheEntry") {
+                decoded = reader.Read(value.title);
+            } else if (key == "ratingOfTheEntry") {
+                decoded = reader.Read(value.rating);
+            } else {
+                decoded = reader.Skip();
+            }
+        }
+        return (reader.Failed() == false);
+    }
+}
+
+class ArenaBenchmark : public ::testing::Test {
+protected:
+    static constexpr uint32_t Iterations = 1000;
+
+    // Marshals the parameters of a call and decodes its result, as a generated method does
+    static void Call(const std::string& result)
+    {
+        std::unordered_map<std::string, std::string> parameters = { { "someRatherLongParameterName", "and a value that does not fit small strings" } };
+        FireboltSDK::JsonWriter writer;
+        writer.Add("category", "app").Add("type", std::string("a type long enough to leave the small string buffer")).Add("parameters", parameters);
+        ASSERT_FALSE(writer.Finish().empty());
+
+        Entry entry;
+        FireboltSDK::Decoded<Entry> response(entry);
+        ASSERT_TRUE(response.FromString(result));
+        ASSERT_EQ(entry.rating, 4);
+    }
+
+    static const std::string Result;
+};
+
+const std::string ArenaBenchmark::Result = R"({"identifierOfTheEntry":"id","titleOfTheEntry":"title","ratingOfTheEntry":4,)"
+                                           R"("anUnknownMemberWithALongName":{"anotherUnknownMember":"with a value too long for small strings"}})";
+
+// Allocations of a call served by the arena instead of the heap
+TEST_F(ArenaBenchmark, AllocationsPerCall)
+{
+    uint32_t allocations = 0;
+    uint32_t blocks = 0;
+    for (uint32_t i = 0; i < Iterations; ++i) {
+        FireboltSDK::Arena arena;
+        Call(Result);
+        allocations += arena.Stats().allocations;
+        blocks += arena.Stats().blocks;
+    }
+    EXPECT_GT(allocations, 0u);
+    EXPECT_EQ(blocks, 0u);
+
+    std::cout << "Per call: " << (allocations / Iterations) << " allocations served by the arena instead of the heap, "
+              << (blocks / Iterations) << " heap blocks" << std::endl;
+}
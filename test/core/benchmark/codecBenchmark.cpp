@@ -0,0 +1,223 @@
+#include <gtest/gtest.h>
+#include "Gateway/jsonreader.h"
+#include "Gateway/jsonwriter.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace {
+    enum class Quality {
+        SD,
+        HD,
+        UHD
+    };
+
+    struct Identifiers {
+        std::optional<std::string> assetId;
+        std::optional<std::string> entityId;
+    };
+
+    struct Offer {
+        Identifiers identifiers;
+        std::string title;
+        std::optional<bool> entitled;
+        std::optional<float> price;
+        int32_t episodes;
+        std::optional<std::vector<Quality>> quality;
+        std::vector<std::string> languages;
+    };
+
+    class JsonData_Identifiers : public WPEFramework::Core::JSON::Container {
+    public:
+        JsonData_Identifiers()
+            : WPEFramework::Core::JSON::Container()
+        {
+            Add(_T("assetId"), &AssetId);
+            Add(_T("entityId"), &EntityId);
+        }
+
+    public:
+        WPEFramework::Core::JSON::String AssetId;
+        WPEFramework::Core::JSON::String EntityId;
+    };
+
+    class JsonData_Offer : public WPEFramework::Core::JSON::Container {
+    public:
+        JsonData_Offer()
+            : WPEFramework::Core::JSON::Container()
+        {
+            Add(_T("identifiers"), &Identifiers);
+            Add(_T("title"), &Title);
+            Add(_T("entitled"), &Entitled);
+            Add(_T("price"), &Price);
+            Add(_T("episodes"), &Episodes);
+            Add(_T("quality"), &Qualities);
+            Add(_T("languages"), &Languages);
+        }
+        JsonData_Offer(const JsonData_Offer& other)
+            : JsonData_Offer()
+        {
+            *this = other;
+        }
+        JsonData_Offer& operator=(const JsonData_Offer& other)
+        {
+            Identifiers = other.Identifiers;
+            Title = other.Title;
+            Entitled = other.Entitled;
+            Price = other.Price;
+            Episodes = other.Episodes;
+            Qualities = other.Qualities;
+            Languages = other.Languages;
+            return (*this);
+        }
+
+    public:
+        JsonData_Identifiers Identifiers;
+        WPEFramework::Core::JSON::String Title;
+        WPEFramework::Core::JSON::Boolean Entitled;
+        WPEFramework::Core::JSON::Float Price;
+        WPEFramework::Core::JSON::DecSInt32 Episodes;
+        WPEFramework::Core::JSON::ArrayType<WPEFramework::Core::JSON::EnumType<Quality>> Qualities;
+        WPEFramework::Core::JSON::ArrayType<WPEFramework::Core::JSON::String> Languages;
+    };
+}
+
+namespace WPEFramework {
+    ENUM_CONVERSION_BEGIN(Quality)
+        { Quality::SD, _T("SD") },
+        { Quality::HD, _T("HD") },
+        { Quality::UHD, _T("UHD") },
+    ENUM_CONVERSION_END(Quality)
+}
+
+namespace FireboltSDK {
+    template <>
+    struct Reflect<Identifiers> {
+        using Type = Identifiers;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("assetId", &Type::assetId),
+            MakeField("entityId", &Type::entityId)
+        );
+    };
+
+    template <>
+    struct Reflect<Offer> {
+        using Type = Offer;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("identifiers", &Type::identifiers),
+            MakeField("title", &Type::title),
+            MakeField("entitled", &Type::entitled),
+            MakeField("price", &Type::price),
+            MakeField("episodes", &Type::episodes),
+            MakeField("quality", &Type::quality),
+            MakeField("languages", &Type::languages)
+        );
+    };
+}
+
+class CodecBenchmark : public ::testing::Test {
+protected:
+    static constexpr uint32_t Iterations = 100000;
+
+    static Offer Sample()
+    {
+        Offer offer;
+        offer.identifiers.entityId = "345";
+        offer.title = "The \"Pilot\"";
+        offer.entitled = true;
+        offer.price = 4.99f;
+        offer.episodes = 12;
+        offer.quality = std::vector<Quality>{ Quality::HD, Quality::UHD };
+        offer.languages = { "en", "de" };
+        return offer;
+    }
+};
+
+// Field tables against Thunder containers, encoding an offer then decoding one
+TEST_F(CodecBenchmark, EncodeAgainstContainer)
+{
+    const Offer offer = Sample();
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < Iterations; ++i) {
+        FireboltSDK::JsonWriter writer;
+        JsonData_Offer container;
+        if (offer.identifiers.assetId.has_value()) {
+            container.Identifiers.AssetId = offer.identifiers.assetId.value();
+        }
+        if (offer.identifiers.entityId.has_value()) {
+            container.Identifiers.EntityId = offer.identifiers.entityId.value();
+        }
+        container.Title = offer.title;
+        if (offer.entitled.has_value()) {
+            container.Entitled = offer.entitled.value();
+        }
+        if (offer.price.has_value()) {
+            container.Price = offer.price.value();
+        }
+        container.Episodes = offer.episodes;
+        if (offer.quality.has_value()) {
+            for (auto& element : offer.quality.value()) {
+                container.Qualities.Add() = element;
+            }
+        }
+        for (auto& element : offer.languages) {
+            container.Languages.Add() = element;
+        }
+        writer.AddContainer(_T("result"), container);
+        ASSERT_FALSE(writer.Finish().empty());
+    }
+    auto containerTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < Iterations; ++i) {
+        FireboltSDK::JsonWriter writer;
+        writer.Add(_T("result"), offer);
+        ASSERT_FALSE(writer.Finish().empty());
+    }
+    auto reflectedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Encoded through a container: " << (containerTime / Iterations) << " ns, field table: " << (reflectedTime / Iterations) << " ns" << std::endl;
+}
+
+TEST_F(CodecBenchmark, DecodeAgainstContainer)
+{
+    const std::string json(R"({"identifiers":{"entityId":"345"},"title":"The \"Pilot\"","entitled":true,"price":4.99,)"
+                           R"("episodes":12,"quality":["HD","UHD"],"languages":["en","de"]})");
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < Iterations; ++i) {
+        JsonData_Offer container;
+        container.FromString(json);
+        Offer offer;
+        if (container.Identifiers.EntityId.IsSet()) {
+            offer.identifiers.entityId = container.Identifiers.EntityId.Value();
+        }
+        offer.title = container.Title.Value();
+        if (container.Price.IsSet()) {
+            offer.price = container.Price.Value();
+        }
+        offer.episodes = container.Episodes.Value();
+        auto index(container.Languages.Elements());
+        while (index.Next() == true) {
+            offer.languages.push_back(index.Current().Value());
+        }
+        ASSERT_EQ(offer.languages.size(), 2u);
+    }
+    auto containerTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < Iterations; ++i) {
+        Offer offer;
+        FireboltSDK::Decoded<Offer> response(offer);
+        response.FromString(json);
+        ASSERT_EQ(offer.languages.size(), 2u);
+    }
+    auto reflectedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Decoded through a container: " << (containerTime / Iterations) << " ns, field table: " << (reflectedTime / Iterations) << " ns" << std::endl;
+}
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include "Transport/inbound.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+class FrameScanBenchmark : public ::testing::Test {
+protected:
+    static constexpr uint32_t Iterations = 20000;
+
+    // Feeds the frame in pieces of the given size, as the channel hands them out
+    static bool Scan(FireboltSDK::FrameScanner& scanner, const std::string& frame, const uint32_t piece, uint32_t& consumed)
+    {
+        scanner.Reset();
+        consumed = 0;
+        while ((consumed < frame.size()) && (scanner.Complete() == false)) {
+            uint32_t length = std::min<uint32_t>(piece, frame.size() - consumed);
+            consumed += scanner.Feed(frame.data() + consumed, length);
+        }
+        return scanner.Complete();
+    }
+
+    static std::string Response(const uint32_t id, const size_t payload)
+    {
+        std::string result = R"({"jsonrpc":"2.0","id":)" + std::to_string(id) + R"(,"result":{"items":[)";
+        while (result.size() < payload) {
+            result += R"({"title":"Some \"quoted\" title with {braces} and [brackets]","value":12.5,"flag":true},)";
+        }
+        result += R"(null]}})";
+        return result;
+    }
+};
+
+// Routing a large response by scanning it, against parsing it into a JSONRPC::Message
+TEST_F(FrameScanBenchmark, ScanAgainstParse)
+{
+    const std::string frame = Response(1, 4096);
+    FireboltSDK::FrameScanner scanner;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < Iterations; ++i) {
+        uint32_t consumed;
+        ASSERT_TRUE(Scan(scanner, frame, 0xFFFF, consumed));
+        FireboltSDK::FrameScanner::Route route;
+        ASSERT_TRUE(scanner.Routing(frame, route));
+    }
+    auto scanTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < Iterations; ++i) {
+        WPEFramework::Core::JSONRPC::Message message;
+        message.FromString(frame);
+        ASSERT_EQ(message.Id.Value(), 1u);
+    }
+    auto parseTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Routing a " << frame.size() << " byte frame, scanned: " << (scanTime / Iterations) << " ns, parsed: " << (parseTime / Iterations) << " ns" << std::endl;
+}
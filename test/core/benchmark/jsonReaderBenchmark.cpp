@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include "Gateway/jsonreader.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Profiles {
+        bool stereo;
+        bool atmos;
+        int32_t channels;
+        std::string name;
+        std::optional<std::string> label;
+        std::vector<std::string> codecs;
+    };
+
+    bool Decode(FireboltSDK::JsonReader& reader, Profiles& value)
+    {
+        std::string_view key;
+        bool decoded = reader.BeginObject();
+        while ((decoded == true) && (reader.Next(key) == true)) {
+            if (key == "stereo") {
+                decoded = reader.Read(value.stereo);
+            } else if (key == "dolbyAtmos") {
+                decoded = reader.Read(value.atmos);
+            } else if (key == "channels") {
+                decoded = reader.Read(value.channels);
+            } else if (key == "name") {
+                decoded = reader.Read(value.name);
+            } else if (key == "label") {
+                decoded = reader.Read(value.label);
+            } else if (key == "codecs") {
+                decoded = reader.BeginArray();
+                while ((decoded == true) && (reader.NextElement() == true)) {
+                    decoded = reader.Read(value.codecs.emplace_back());
+                }
+            } else {
+                decoded = reader.Skip();
+            }
+        }
+        return (reader.Failed() == false);
+    }
+
+    class JsonData_Profiles : public WPEFramework::Core::JSON::Container {
+    public:
+        JsonData_Profiles()
+            : WPEFramework::Core::JSON::Container()
+        {
+            Add(_T("stereo"), &Stereo);
+            Add(_T("dolbyAtmos"), &DolbyAtmos);
+            Add(_T("channels"), &Channels);
+            Add(_T("name"), &Name);
+            Add(_T("label"), &Label);
+            Add(_T("codecs"), &Codecs);
+        }
+
+    public:
+        WPEFramework::Core::JSON::Boolean Stereo;
+        WPEFramework::Core::JSON::Boolean DolbyAtmos;
+        WPEFramework::Core::JSON::DecSInt32 Channels;
+        WPEFramework::Core::JSON::String Name;
+        WPEFramework::Core::JSON::String Label;
+        WPEFramework::Core::JSON::ArrayType<WPEFramework::Core::JSON::String> Codecs;
+    };
+}
+
+class JsonReaderBenchmark : public ::testing::Test {
+protected:
+    static constexpr uint32_t Iterations = 100000;
+    static constexpr const char* Result = R"({ "stereo": true, "dolbyAtmos": false, "channels": 6, "name": "Living \"room\"",)"
+                                          R"( "extra": { "nested": [1, 2.5e3, null, "x"] }, "codecs": ["ac3", "eac3"] })";
+};
+
+// A result read into a Thunder container then copied out, against decoded straight into the struct
+TEST_F(JsonReaderBenchmark, DecodeAgainstContainer)
+{
+    const std::string result(Result);
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < Iterations; ++i) {
+        JsonData_Profiles container;
+        container.FromString(result);
+        Profiles profiles;
+        profiles.stereo = container.Stereo.Value();
+        profiles.atmos = container.DolbyAtmos.Value();
+        profiles.channels = container.Channels.Value();
+        profiles.name = container.Name.Value();
+        if (container.Label.IsSet()) {
+            profiles.label = container.Label.Value();
+        }
+        auto index(container.Codecs.Elements());
+        while (index.Next() == true) {
+            profiles.codecs.push_back(index.Current().Value());
+        }
+        ASSERT_EQ(profiles.codecs.size(), 2u);
+    }
+    auto containerTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < Iterations; ++i) {
+        Profiles profiles;
+        FireboltSDK::Decoded<Profiles> response(profiles);
+        response.FromString(result);
+        ASSERT_EQ(profiles.codecs.size(), 2u);
+    }
+    auto decodedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Result through a container: " << (containerTime / Iterations) << " ns, decoded: " << (decodedTime / Iterations) << " ns" << std::endl;
+}
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include "Gateway/Gateway.h"
+
+#include <chrono>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+class MethodIdBenchmark : public ::testing::Test {
+protected:
+    static constexpr size_t MethodCount = sizeof(FireboltSDK::MethodTable) / sizeof(FireboltSDK::MethodTable[0]);
+    static constexpr uint32_t Iterations = 200000;
+
+    // Notification name of an event, as the bidirectional server derived it before method ids
+    static std::string keyFromEvent(const std::string &event)
+    {
+        std::string key = event;
+        size_t dotPos = key.find('.');
+        if (dotPos != std::string::npos && dotPos + 3 < key.size() && key.substr(dotPos + 1, 2) == "on") {
+            key[dotPos + 3] = std::tolower(key[dotPos + 3]);
+            key.erase(dotPos + 1, 2);
+        }
+        return key;
+    }
+};
+
+// Cost of routing a notification by name and by id
+TEST_F(MethodIdBenchmark, Dispatch) {
+    std::map<std::string, size_t> byName;
+    std::unordered_map<FireboltSDK::MethodId, size_t> byId;
+    std::vector<std::string> notifications;
+    for (size_t id = 0; id < MethodCount; ++id) {
+        std::string name = FireboltSDK::MethodTable[id].name;
+        byName.emplace(keyFromEvent(name), id);
+        byId.emplace(static_cast<FireboltSDK::MethodId>(id), id);
+        notifications.push_back(keyFromEvent(name));
+    }
+
+    size_t hits = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t index = 0; index < Iterations; ++index) {
+        const std::string& notification = notifications[index % notifications.size()];
+        hits += byName.count(notification);
+    }
+    auto byNameTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t index = 0; index < Iterations; ++index) {
+        const std::string& notification = notifications[index % notifications.size()];
+        hits += byId.count(FireboltSDK::FindMethod(notification));
+    }
+    auto byIdTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    ASSERT_EQ(hits, 2 * Iterations);
+    std::cout << "Dispatch by name: " << (byNameTime / Iterations) << " ns, by id: " << (byIdTime / Iterations) << " ns" << std::endl;
+}
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include "Transport/serialqueues.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+class SerialQueuesBenchmark : public ::testing::Test {
+protected:
+    static constexpr uint32_t Keys = 256;
+    static constexpr uint32_t EventsPerKey = 2000;
+
+    struct Event {
+        uint32_t key;
+        uint32_t sequence;
+    };
+
+    static void WaitFor(const std::atomic<uint32_t>& handled, const uint32_t count)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+        while ((handled.load() < count) && (std::chrono::steady_clock::now() < deadline)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+};
+
+// Throughput over many keys, the work pool being shared by all of them
+TEST_F(SerialQueuesBenchmark, ThroughputOverManyKeys) {
+    std::atomic<uint32_t> handled(0);
+
+    FireboltSDK::SerialQueues<uint32_t, Event> queues([&](const Event&) {
+        ++handled;
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t sequence = 0; sequence < EventsPerKey; ++sequence) {
+        for (uint32_t key = 0; key < Keys; ++key) {
+            queues.Submit(key, Event{key, sequence});
+        }
+    }
+    WaitFor(handled, Keys * EventsPerKey);
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    ASSERT_EQ(handled.load(), Keys * EventsPerKey);
+    std::cout << (Keys * EventsPerKey) << " events over " << Keys << " keys in " << elapsed << " us, "
+              << ((static_cast<double>(Keys) * EventsPerKey) / elapsed) << " M events/s" << std::endl;
+}
@@ -0,0 +1,59 @@
+#ifdef ENABLE_IO_URING
+
+#include <gtest/gtest.h>
+#include "../unit/uringEcho.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+class UringEngineBenchmark : public ::testing::Test {
+protected:
+    static constexpr uint32_t Messages = 2000;
+    static constexpr uint16_t MessageSize = 64;
+
+    struct Measurement {
+        bool uring;
+        double syscallsPerMessage;
+        double p50; // us
+        double p99;
+    };
+
+    static Measurement PingPong(const bool preferUring)
+    {
+        UringEcho::Client client(preferUring);
+        std::vector<double> latencies;
+        latencies.reserve(Messages);
+        std::string message(MessageSize, 'x');
+        for (uint32_t index = 0; index < Messages; ++index) {
+            std::snprintf(&message[0], MessageSize, "%08u", index);
+            auto start = std::chrono::steady_clock::now();
+            client.Send(message);
+            EXPECT_TRUE(client.WaitFor(static_cast<size_t>(index + 1) * MessageSize));
+            latencies.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+        }
+        std::sort(latencies.begin(), latencies.end());
+        FireboltSDK::UringEngine::Statistics stats = client.Engine().Stats();
+        return Measurement{ client.Engine().IsUring(), static_cast<double>(stats.syscalls) / Messages,
+            latencies[latencies.size() / 2], latencies[(latencies.size() * 99) / 100] };
+    }
+};
+
+TEST_F(UringEngineBenchmark, PingPong)
+{
+    Measurement readiness = PingPong(false);
+    Measurement uring = PingPong(true);
+
+    std::cout << "Ping-pong of " << Messages << " x " << MessageSize << " bytes against a loopback echo server:" << std::endl;
+    std::cout << "  readiness: " << readiness.syscallsPerMessage << " syscalls/message, p50 " << readiness.p50 << " us, p99 " << readiness.p99 << " us" << std::endl;
+    if (uring.uring == true) {
+        std::cout << "  io_uring:  " << uring.syscallsPerMessage << " syscalls/message, p50 " << uring.p50 << " us, p99 " << uring.p99 << " us" << std::endl;
+    } else {
+        std::cout << "  io_uring:  not available on this kernel, fell back on readiness" << std::endl;
+    }
+}
+
+#endif
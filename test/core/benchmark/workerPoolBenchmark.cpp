@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include "Accessor/WorkerPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkerPoolBenchmark : public ::testing::Test {
+protected:
+    static constexpr uint8_t Threads = 4;
+    static constexpr uint32_t Jobs = 20000;
+
+    class Job : public WPEFramework::Core::IDispatch {
+    protected:
+        Job(const std::function<void()>& work)
+            : _work(work)
+        {
+        }
+
+    public:
+        Job() = delete;
+        Job(const Job&) = delete;
+        Job& operator=(const Job&) = delete;
+        ~Job() = default;
+
+        void Dispatch() override
+        {
+            _work();
+        }
+
+    private:
+        std::function<void()> _work;
+    };
+
+    // The pool the SDK used before, a Thunder worker pool with its single bounded queue
+    class ThunderPool : public WPEFramework::Core::WorkerPool {
+    public:
+        ThunderPool(const uint8_t threads, const uint32_t queueSize)
+            : WorkerPool(threads, WPEFramework::Core::Thread::DefaultStackSize(), queueSize, &_dispatcher)
+        {
+            Run();
+        }
+        ~ThunderPool()
+        {
+            Stop();
+        }
+
+    private:
+        class Dispatcher : public WPEFramework::Core::ThreadPool::IDispatcher {
+            void Initialize() override { }
+            void Deinitialize() override { }
+            void Dispatch(WPEFramework::Core::IDispatch* job) override { job->Dispatch(); }
+        };
+
+        Dispatcher _dispatcher;
+    };
+
+    static WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch> Make(const std::function<void()>& work)
+    {
+        return WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch>(WPEFramework::Core::ProxyType<Job>::Create(work));
+    }
+
+    static bool WaitFor(const std::atomic<uint32_t>& count, const uint32_t expected)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(20);
+        while ((count.load() < expected) && (std::chrono::steady_clock::now() < deadline)) {
+            std::this_thread::yield();
+        }
+        return (count.load() == expected);
+    }
+
+    // Throughput of small jobs, then submit to start latency under a moderate load
+    template <typename SUBMIT>
+    static void Measure(const char* name, const SUBMIT& submit)
+    {
+        std::atomic<uint32_t> done(0);
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t index = 0; index < Jobs; ++index) {
+            submit(Make([&done]() { ++done; }));
+        }
+        ASSERT_TRUE(WaitFor(done, Jobs));
+        auto throughput = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+        std::vector<int64_t> latencies;
+        std::mutex latencyLock;
+        done = 0;
+        for (uint32_t index = 0; index < Jobs / 10; ++index) {
+            auto submitted = std::chrono::steady_clock::now();
+            submit(Make([&, submitted]() {
+                int64_t latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - submitted).count();
+                std::lock_guard lck(latencyLock);
+                latencies.push_back(latency);
+                ++done;
+            }));
+            if ((index % 4) == 0) {
+                std::this_thread::sleep_for(std::chrono::microseconds(20));
+            }
+        }
+        ASSERT_TRUE(WaitFor(done, Jobs / 10));
+        std::sort(latencies.begin(), latencies.end());
+        std::cout << name << ": " << Jobs << " jobs in " << throughput << " us, latency p50 " << (latencies[latencies.size() / 2] / 1000)
+                  << " us, p99 " << (latencies[(latencies.size() * 99) / 100] / 1000) << " us" << std::endl;
+    }
+};
+
+// Compares the work-stealing pool to the Thunder one
+TEST_F(WorkerPoolBenchmark, ThroughputAndLatency) {
+    {
+        ThunderPool pool(Threads, 8);
+        Measure("Thunder pool", [&pool](const WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch>& job) { pool.Submit(job); });
+    }
+    {
+        FireboltSDK::WorkStealingPool pool(Threads, WPEFramework::Core::Thread::DefaultStackSize());
+        pool.Run();
+        Measure("Work-stealing pool", [&pool](const WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch>& job) { pool.Submit(job); });
+        pool.Stop();
+    }
+}
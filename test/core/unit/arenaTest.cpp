@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include "Gateway/arena.h"
+#include "Gateway/jsonreader.h"
+#include "Gateway/jsonwriter.h"
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    struct Entry {
+        std::string identifier;
+        std::string title;
+        int32_t rating;
+    };
+
+    bool Decode(FireboltSDK::JsonReader& reader, Entry& value)
+    {
+        std::string_view key;
+        bool decoded = reader.BeginObject();
+        while ((decoded == true) && (reader.Next(key) == true)) {
+            if (key == "identifierOfTheEntry") {
+                decoded = reader.Read(value.identifier);
+            } else if (key == "titleOfTheEntry") {
+                decoded = reader.Read(value.title);
+            } else if (key == "ratingOfTheEntry") {
+                decoded = reader.Read(value.rating);
+            } else {
+                decoded = reader.Skip();
+            }
+        }
+        return (reader.Failed() == false);
+    }
+}
+
+class ArenaTest : public ::testing::Test {
+protected:
+    // Marshals the parameters of a call and decodes its result, as a generated method does
+    static void Call(const std::string& result)
+    {
+        std::unordered_map<std::string, std::string> parameters = { { "someRatherLongParameterName", "and a value that does not fit small strings" } };
+        FireboltSDK::JsonWriter writer;
+        writer.Add("category", "app").Add("type", std::string("a type long enough to leave the small string buffer")).Add("parameters", parameters);
+        ASSERT_FALSE(writer.Finish().empty());
+
+        Entry entry;
+        FireboltSDK::Decoded<Entry> response(entry);
+        ASSERT_TRUE(response.FromString(result));
+        ASSERT_EQ(entry.rating, 4);
+    }
+
+    static const std::string Result;
+};
+
+const std::string ArenaTest::Result = R"({"identifierOfTheEntry":"id","titleOfTheEntry":"title","ratingOfTheEntry":4,)"
+                                      R"("anUnknownMemberWithALongName":{"anotherUnknownMember":"with a value too long for small strings"}})";
+
+TEST_F(ArenaTest, ScopesNest)
+{
+    EXPECT_EQ(FireboltSDK::Arena::Current(), nullptr);
+    EXPECT_EQ(FireboltSDK::Arena::Resource(), std::pmr::new_delete_resource());
+    {
+        FireboltSDK::Arena outer;
+        EXPECT_EQ(FireboltSDK::Arena::Current(), &outer);
+        {
+            FireboltSDK::Arena inner;
+            EXPECT_EQ(FireboltSDK::Arena::Current(), &inner);
+        }
+        EXPECT_EQ(FireboltSDK::Arena::Current(), &outer);
+    }
+    EXPECT_EQ(FireboltSDK::Arena::Current(), nullptr);
+}
+
+TEST_F(ArenaTest, SpillsToTheHeapInBlocks)
+{
+    FireboltSDK::Arena arena;
+    std::pmr::vector<char> small(FireboltSDK::Arena::Resource());
+    small.resize(64);
+    EXPECT_EQ(arena.Stats().allocations, 1u);
+    EXPECT_EQ(arena.Stats().blocks, 0u);
+
+    std::pmr::vector<char> large(FireboltSDK::Arena::Resource());
+    large.resize(FireboltSDK::Arena::InlineSize * 4);
+    EXPECT_EQ(arena.Stats().allocations, 2u);
+    EXPECT_EQ(arena.Stats().blocks, 1u);
+}
+
+// A small call is served from the inline block, without taking a block from the heap
+TEST_F(ArenaTest, ServesACall)
+{
+    FireboltSDK::Arena arena;
+    Call(Result);
+    EXPECT_GT(arena.Stats().allocations, 0u);
+    EXPECT_EQ(arena.Stats().blocks, 0u);
+}
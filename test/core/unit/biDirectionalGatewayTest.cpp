@@ -60,4 +60,47 @@ TEST_F(BiDirectionalGatewayTest, UnSubscribe)
     EXPECT_EQ(status, Firebolt::Error::None) << "Error! status: " << static_cast<int32_t>(status);
 }
 
+TEST_F(BiDirectionalGatewayTest, EventNotifiedUnderTheNameOfAMethod)
+{
+    // capabilities.available is a method too, the notification resolves to its id rather than to the event's
+    const std::string eventName = _T("capabilities.onAvailable");
+    ASSERT_NE(FireboltSDK::FindMethod(_T("capabilities.available")), FireboltSDK::FindMethod(eventName));
+
+    FireboltSDK::Server server(FireboltSDK::Config{});
+    uint32_t notified = 0;
+    status = server.Subscribe(eventName, [&notified](void*, const void*, const string&) { ++notified; }, &notified, nullptr);
+    EXPECT_EQ(status, Firebolt::Error::None) << "Error! status: " << static_cast<int32_t>(status);
+
+    server.Notify(_T("capabilities.available"), _T("{}"));
+    EXPECT_EQ(notified, 1u);
+
+    bool idle = false;
+    status = server.Unsubscribe(eventName, &notified, idle);
+    EXPECT_EQ(status, Firebolt::Error::None) << "Error! status: " << static_cast<int32_t>(status);
+    EXPECT_TRUE(idle);
+}
+
+TEST_F(BiDirectionalGatewayTest, EventMissingFromTheMethodTable)
+{
+    // Not in the specification, so it has no method id and is routed by its notification name
+    const std::string eventName = _T("thirdparty.onSomethingHappened");
+    ASSERT_EQ(FireboltSDK::FindMethod(eventName), FireboltSDK::UnknownMethod);
+
+    FireboltSDK::Server server(FireboltSDK::Config{});
+    uint32_t notified = 0;
+    status = server.Subscribe(eventName, [&notified](void*, const void*, const string&) { ++notified; }, &notified, nullptr);
+    EXPECT_EQ(status, Firebolt::Error::None) << "Error! status: " << static_cast<int32_t>(status);
+
+    server.Notify(_T("thirdparty.somethingHappened"), _T("{}"));
+    EXPECT_EQ(notified, 1u);
+
+    bool idle = false;
+    status = server.Unsubscribe(eventName, &notified, idle);
+    EXPECT_EQ(status, Firebolt::Error::None) << "Error! status: " << static_cast<int32_t>(status);
+    EXPECT_TRUE(idle);
+
+    server.Notify(_T("thirdparty.somethingHappened"), _T("{}"));
+    EXPECT_EQ(notified, 1u);
+}
+
 #endif
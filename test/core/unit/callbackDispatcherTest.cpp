@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include "Event/callbacks.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+class CallbackDispatcherTest : public ::testing::Test {
+protected:
+    struct Result {
+        std::string value;
+    };
+    using Proxy = WPEFramework::Core::ProxyType<Result>;
+
+    // Keeps the batches for the test to run them, as a main loop would
+    class Loop : public Firebolt::IDispatcher {
+    public:
+        void Post(std::function<void()>&& batch) override
+        {
+            batches.push_back(std::move(batch));
+        }
+        void Run()
+        {
+            std::vector<std::function<void()>> pending;
+            pending.swap(batches);
+            for (auto& batch : pending) {
+                batch();
+            }
+        }
+
+        std::vector<std::function<void()>> batches;
+    };
+
+    void SetUp() override
+    {
+        dispatcher.Assign(&loop);
+    }
+    void TearDown() override
+    {
+        dispatcher.Assign(nullptr);
+    }
+
+    FireboltSDK::StickyEvents::Callback Listener()
+    {
+        return dispatcher.Wrap<Result>("module.onChanged", [this](void* usercb, const void* userdata, void* parameters) {
+            Proxy* result = static_cast<Proxy*>(parameters);
+            received.push_back((*result)->value);
+            delete result;
+        });
+    }
+
+    static void* Notify(const std::string& value)
+    {
+        Proxy* result = new Proxy(Proxy::Create());
+        (*result)->value = value;
+        return static_cast<void*>(result);
+    }
+
+    FireboltSDK::CallbackDispatcher& dispatcher = FireboltSDK::CallbackDispatcher::Instance();
+    Loop loop;
+    std::vector<std::string> received;
+};
+
+TEST_F(CallbackDispatcherTest, BatchesNotifications)
+{
+    auto listener = Listener();
+    int usercb;
+    listener(&usercb, nullptr, Notify("a"));
+    listener(&usercb, nullptr, Notify("b"));
+    listener(&usercb, nullptr, Notify("c"));
+
+    EXPECT_TRUE(received.empty());
+    ASSERT_EQ(loop.batches.size(), 1u);
+    loop.Run();
+    EXPECT_EQ(received, (std::vector<std::string>{ "a", "b", "c" }));
+
+    listener(&usercb, nullptr, Notify("d"));
+    ASSERT_EQ(loop.batches.size(), 1u);
+    loop.Run();
+    EXPECT_EQ(received.back(), "d");
+}
+
+TEST_F(CallbackDispatcherTest, RevokeDropsQueuedNotifications)
+{
+    auto listener = Listener();
+    int leaving, staying;
+    listener(&leaving, nullptr, Notify("leaving"));
+    listener(&staying, nullptr, Notify("staying"));
+    dispatcher.Revoke("module.onChanged", &leaving);
+    loop.Run();
+    EXPECT_EQ(received, (std::vector<std::string>{ "staying" }));
+}
+
+TEST_F(CallbackDispatcherTest, RunsRightAwayWithoutDispatcher)
+{
+    dispatcher.Assign(nullptr);
+    auto listener = Listener();
+    int usercb;
+    listener(&usercb, nullptr, Notify("now"));
+    EXPECT_TRUE(loop.batches.empty());
+    EXPECT_EQ(received, (std::vector<std::string>{ "now" }));
+}
+
+TEST_F(CallbackDispatcherTest, RevokeWaitsForTheRunningNotification)
+{
+    std::promise<void> entered;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    auto listener = dispatcher.Wrap<Result>("module.onChanged", [&entered, released](void* usercb, const void* userdata, void* parameters) {
+        delete static_cast<Proxy*>(parameters);
+        entered.set_value();
+        released.wait();
+    });
+    int usercb;
+    listener(&usercb, nullptr, Notify("running"));
+
+    std::thread flush([this]() { loop.Run(); });
+    entered.get_future().wait();
+
+    std::atomic<bool> revoked{false};
+    std::thread unsubscribe([this, &usercb, &revoked]() {
+        dispatcher.Revoke("module.onChanged", &usercb);
+        revoked = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(revoked);
+
+    release.set_value();
+    unsubscribe.join();
+    flush.join();
+    EXPECT_TRUE(revoked);
+}
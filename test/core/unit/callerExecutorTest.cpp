@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include "Transport/executor.h"
+#include "Accessor/WorkerPool.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+
+#include <poll.h>
+
+class CallerExecutorTest : public ::testing::Test {
+protected:
+    class Job : public WPEFramework::Core::IDispatch {
+    protected:
+        Job(const std::function<void()>& work)
+            : _work(work)
+        {
+        }
+
+    public:
+        Job() = delete;
+        Job(const Job&) = delete;
+        Job& operator=(const Job&) = delete;
+        ~Job() = default;
+
+        void Dispatch() override
+        {
+            _work();
+        }
+
+    private:
+        std::function<void()> _work;
+    };
+
+    static WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch> Make(const std::function<void()>& work)
+    {
+        return WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch>(WPEFramework::Core::ProxyType<Job>::Create(work));
+    }
+
+    static bool Readable(const FireboltSDK::CallerExecutor& executor, const int timeout = 0)
+    {
+        struct pollfd descriptor = { executor.Descriptor(), POLLIN, 0 };
+        return (::poll(&descriptor, 1, timeout) == 1);
+    }
+
+    FireboltSDK::CallerExecutor executor;
+};
+
+TEST_F(CallerExecutorTest, RunsJobsOnProcess)
+{
+    std::atomic<uint32_t> done { 0 };
+    EXPECT_FALSE(Readable(executor));
+
+    std::thread submitter([&]() {
+        executor.Submit(Make([&]() { ++done; }));
+        executor.Post([&]() { ++done; });
+    });
+    submitter.join();
+
+    EXPECT_TRUE(Readable(executor, 1000));
+    EXPECT_EQ(done, 0u);
+    EXPECT_EQ(executor.Process(0), 2u);
+    EXPECT_EQ(done, 2u);
+    EXPECT_FALSE(Readable(executor));
+}
+
+TEST_F(CallerExecutorTest, LeavesJobsSubmittedWhileProcessing)
+{
+    std::atomic<uint32_t> done { 0 };
+    executor.Post([&]() {
+        ++done;
+        executor.Post([&]() { ++done; });
+    });
+
+    EXPECT_EQ(executor.Process(0), 1u);
+    EXPECT_TRUE(Readable(executor));
+    EXPECT_EQ(executor.Process(0), 1u);
+    EXPECT_EQ(done, 2u);
+}
+
+TEST_F(CallerExecutorTest, RunsTimersUntilDone)
+{
+    uint32_t fired = 0;
+    int owner = 0;
+    executor.Trigger(WPEFramework::Core::Time::Now().Add(20).Ticks(), &owner, [&]() -> uint64_t {
+        return (++fired < 3) ? WPEFramework::Core::Time::Now().Add(10).Ticks() : 0;
+    });
+
+    EXPECT_FALSE(Readable(executor));
+    auto start = std::chrono::steady_clock::now();
+    while ((fired < 3) && (std::chrono::steady_clock::now() - start < std::chrono::seconds(5))) {
+        executor.Process(1000);
+    }
+    EXPECT_EQ(fired, 3u);
+    EXPECT_FALSE(Readable(executor, 50));
+
+    executor.Trigger(WPEFramework::Core::Time::Now().Add(10).Ticks(), &owner, [&]() -> uint64_t { return ++fired, 0; });
+    executor.Revoke(&owner);
+    EXPECT_FALSE(Readable(executor, 50));
+    EXPECT_EQ(fired, 3u);
+}
+
+TEST_F(CallerExecutorTest, Revoke)
+{
+    bool ran = false;
+    auto pending = Make([&ran]() { ran = true; });
+    executor.Submit(pending);
+    EXPECT_EQ(executor.Revoke(pending), WPEFramework::Core::ERROR_NONE);
+    EXPECT_EQ(executor.Revoke(pending), WPEFramework::Core::ERROR_UNKNOWN_KEY);
+    executor.Process(0);
+    EXPECT_FALSE(ran);
+
+    // A job running on the thread processing is waited for by the others
+    std::atomic<bool> started { false };
+    std::atomic<bool> finished { false };
+    auto running = Make([&]() {
+        started = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        finished = true;
+    });
+    executor.Submit(running);
+    std::thread processor([&]() { executor.Process(0); });
+    while (started == false) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(executor.Revoke(running, 1000), WPEFramework::Core::ERROR_NONE);
+    EXPECT_TRUE(finished);
+    processor.join();
+}
+
+TEST_F(CallerExecutorTest, WorkerPoolWithoutThreads)
+{
+    FireboltSDK::ExecutorWorkerPool pool(executor);
+    std::atomic<uint32_t> done { 0 };
+    pool.Submit(Make([&]() { ++done; }));
+    pool.Schedule(WPEFramework::Core::Time::Now().Add(20), Make([&]() { ++done; }));
+    auto revoked = Make([&]() { ++done; });
+    pool.Schedule(WPEFramework::Core::Time::Now().Add(20), revoked);
+    EXPECT_EQ(pool.Revoke(revoked), WPEFramework::Core::ERROR_NONE);
+
+    executor.Process(0);
+    EXPECT_EQ(done, 1u);
+
+    // The scheduled one is submitted once its time came, and run on the next call
+    auto start = std::chrono::steady_clock::now();
+    while ((done < 2) && (std::chrono::steady_clock::now() - start < std::chrono::seconds(5))) {
+        executor.Process(1000);
+    }
+    EXPECT_EQ(done, 2u);
+    EXPECT_FALSE(Readable(executor, 50));
+    EXPECT_EQ(done, 2u);
+}
@@ -0,0 +1,294 @@
+#include <gtest/gtest.h>
+#include "Gateway/jsonreader.h"
+#include "Gateway/jsonwriter.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace {
+    enum class Quality {
+        SD,
+        HD,
+        UHD
+    };
+
+    struct Identifiers {
+        std::optional<std::string> assetId;
+        std::optional<std::string> entityId;
+    };
+
+    struct Offer {
+        Identifiers identifiers;
+        std::string title;
+        std::optional<bool> entitled;
+        std::optional<float> price;
+        int32_t episodes;
+        std::optional<std::vector<Quality>> quality;
+        std::vector<std::string> languages;
+    };
+
+    struct Catalog {
+        std::string expires;
+        std::vector<Offer> offers;
+    };
+
+    class JsonData_Identifiers : public WPEFramework::Core::JSON::Container {
+    public:
+        JsonData_Identifiers()
+            : WPEFramework::Core::JSON::Container()
+        {
+            Add(_T("assetId"), &AssetId);
+            Add(_T("entityId"), &EntityId);
+        }
+
+    public:
+        WPEFramework::Core::JSON::String AssetId;
+        WPEFramework::Core::JSON::String EntityId;
+    };
+
+    class JsonData_Offer : public WPEFramework::Core::JSON::Container {
+    public:
+        JsonData_Offer()
+            : WPEFramework::Core::JSON::Container()
+        {
+            Add(_T("identifiers"), &Identifiers);
+            Add(_T("title"), &Title);
+            Add(_T("entitled"), &Entitled);
+            Add(_T("price"), &Price);
+            Add(_T("episodes"), &Episodes);
+            Add(_T("quality"), &Qualities);
+            Add(_T("languages"), &Languages);
+        }
+        JsonData_Offer(const JsonData_Offer& other)
+            : JsonData_Offer()
+        {
+            *this = other;
+        }
+        JsonData_Offer& operator=(const JsonData_Offer& other)
+        {
+            Identifiers = other.Identifiers;
+            Title = other.Title;
+            Entitled = other.Entitled;
+            Price = other.Price;
+            Episodes = other.Episodes;
+            Qualities = other.Qualities;
+            Languages = other.Languages;
+            return (*this);
+        }
+
+    public:
+        JsonData_Identifiers Identifiers;
+        WPEFramework::Core::JSON::String Title;
+        WPEFramework::Core::JSON::Boolean Entitled;
+        WPEFramework::Core::JSON::Float Price;
+        WPEFramework::Core::JSON::DecSInt32 Episodes;
+        WPEFramework::Core::JSON::ArrayType<WPEFramework::Core::JSON::EnumType<Quality>> Qualities;
+        WPEFramework::Core::JSON::ArrayType<WPEFramework::Core::JSON::String> Languages;
+    };
+}
+
+namespace WPEFramework {
+    ENUM_CONVERSION_BEGIN(Quality)
+        { Quality::SD, _T("SD") },
+        { Quality::HD, _T("HD") },
+        { Quality::UHD, _T("UHD") },
+    ENUM_CONVERSION_END(Quality)
+}
+
+namespace FireboltSDK {
+    template <>
+    struct Reflect<Identifiers> {
+        using Type = Identifiers;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("assetId", &Type::assetId),
+            MakeField("entityId", &Type::entityId)
+        );
+    };
+
+    template <>
+    struct Reflect<Offer> {
+        using Type = Offer;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("identifiers", &Type::identifiers),
+            MakeField("title", &Type::title),
+            MakeField("entitled", &Type::entitled),
+            MakeField("price", &Type::price),
+            MakeField("episodes", &Type::episodes),
+            MakeField("quality", &Type::quality),
+            MakeField("languages", &Type::languages)
+        );
+    };
+
+    template <>
+    struct Reflect<Catalog> {
+        using Type = Catalog;
+        static constexpr auto Fields = std::make_tuple(
+            MakeField("expires", &Type::expires),
+            MakeField("offers", &Type::offers)
+        );
+    };
+}
+
+class CodecTest : public ::testing::Test {
+protected:
+    static Offer Sample()
+    {
+        Offer offer;
+        offer.identifiers.entityId = "345";
+        offer.title = "The \"Pilot\"";
+        offer.entitled = true;
+        offer.price = 4.99f;
+        offer.episodes = 12;
+        offer.quality = std::vector<Quality>{ Quality::HD, Quality::UHD };
+        offer.languages = { "en", "de" };
+        return offer;
+    }
+};
+
+TEST_F(CodecTest, EncodesInTableOrder)
+{
+    FireboltSDK::JsonWriter writer;
+    writer.Add(_T("offer"), Sample());
+    EXPECT_EQ(std::string(writer.Finish()),
+        R"({"offer":{"identifiers":{"entityId":"345"},"title":"The \"Pilot\"","entitled":true,"price":4.99,)"
+        R"("episodes":12,"quality":["HD","UHD"],"languages":["en","de"]}})");
+}
+
+TEST_F(CodecTest, NestedVectorsOfStructs)
+{
+    Catalog catalog;
+    catalog.expires = "2025-01-01T00:00:00Z";
+    catalog.offers = { Sample(), Offer() };
+
+    FireboltSDK::JsonWriter writer;
+    writer.Add(_T("result"), catalog);
+    EXPECT_EQ(std::string(writer.Finish()),
+        R"({"result":{"expires":"2025-01-01T00:00:00Z","offers":[)"
+        R"({"identifiers":{"entityId":"345"},"title":"The \"Pilot\"","entitled":true,"price":4.99,)"
+        R"("episodes":12,"quality":["HD","UHD"],"languages":["en","de"]},)"
+        R"({"identifiers":{},"title":"","episodes":0,"languages":[]}]}})");
+}
+
+TEST_F(CodecTest, RoundTrip)
+{
+    Catalog catalog;
+    catalog.expires = "never";
+    catalog.offers = { Sample(), Sample() };
+    catalog.offers[1].identifiers.assetId = "a\nb";
+    catalog.offers[1].price.reset();
+
+    FireboltSDK::JsonWriter writer;
+    writer.Add(_T("result"), catalog);
+    std::string json(writer.Finish());
+
+    Catalog decoded;
+    FireboltSDK::JsonReader reader(json);
+    std::string_view key;
+    ASSERT_TRUE(reader.BeginObject());
+    ASSERT_TRUE(reader.Next(key));
+    EXPECT_EQ(key, "result");
+    ASSERT_TRUE(reader.Read(decoded));
+    EXPECT_FALSE(reader.Next(key));
+    EXPECT_TRUE(reader.Done());
+
+    EXPECT_EQ(decoded.expires, "never");
+    ASSERT_EQ(decoded.offers.size(), 2u);
+    for (size_t index = 0; index < decoded.offers.size(); ++index) {
+        const Offer& expected = catalog.offers[index];
+        const Offer& offer = decoded.offers[index];
+        EXPECT_EQ(offer.identifiers.assetId, expected.identifiers.assetId);
+        EXPECT_EQ(offer.identifiers.entityId, expected.identifiers.entityId);
+        EXPECT_EQ(offer.title, expected.title);
+        EXPECT_EQ(offer.entitled, expected.entitled);
+        EXPECT_EQ(offer.price, expected.price);
+        EXPECT_EQ(offer.episodes, expected.episodes);
+        EXPECT_EQ(offer.quality, expected.quality);
+        EXPECT_EQ(offer.languages, expected.languages);
+    }
+}
+
+TEST_F(CodecTest, DecodeSkipsUnknownMembers)
+{
+    Offer offer;
+    offer.languages = { "stale" };
+    FireboltSDK::Decoded<Offer> response(offer);
+    EXPECT_TRUE(response.FromString(R"({"title":"x","extra":{"a":[1,{"b":null}]},"price":null,"episodes":3,"titles":"y"})"));
+
+    EXPECT_EQ(offer.title, "x");
+    EXPECT_FALSE(offer.price.has_value());
+    EXPECT_EQ(offer.episodes, 3);
+    EXPECT_TRUE(offer.languages.empty());
+}
+
+TEST_F(CodecTest, DecodeFailsOnMistypedMembers)
+{
+    const std::vector<std::string> inputs = {
+        R"({"title":1})",
+        R"({"episodes":"3"})",
+        R"({"quality":["4K"]})",
+        R"({"languages":"en"})",
+        R"({"identifiers":[]})",
+        R"({"languages":["en",]})",
+    };
+    for (const auto& input : inputs) {
+        Offer offer;
+        FireboltSDK::Decoded<Offer> response(offer);
+        EXPECT_FALSE(response.FromString(input)) << input;
+    }
+}
+
+TEST_F(CodecTest, DecodeReusesTheElementsOfAList)
+{
+    std::vector<Offer> offers;
+    FireboltSDK::Decoded<std::vector<Offer>> response(offers);
+    ASSERT_TRUE(response.FromString(R"([{"title":"a long enough title not to fit in place","entitled":true,"languages":["en"]},{"title":"b"},{"title":"c"}])"));
+    ASSERT_EQ(offers.size(), 3u);
+    const Offer* elements = offers.data();
+    const char* title = offers[0].title.data();
+
+    // Members missing from the second text are reset, the storage of the first element is kept
+    ASSERT_TRUE(response.FromString(R"([{"title":"a shorter title, in the same storage","episodes":2},{"title":"d"}])"));
+    ASSERT_EQ(offers.size(), 2u);
+    EXPECT_EQ(offers.data(), elements);
+    EXPECT_EQ(offers[0].title.data(), title);
+    EXPECT_EQ(offers[0].title, "a shorter title, in the same storage");
+    EXPECT_FALSE(offers[0].entitled.has_value());
+    EXPECT_TRUE(offers[0].languages.empty());
+    EXPECT_EQ(offers[0].episodes, 2);
+    EXPECT_EQ(offers[1].title, "d");
+
+    ASSERT_TRUE(response.FromString("[]"));
+    EXPECT_TRUE(offers.empty());
+}
+
+TEST_F(CodecTest, DecodesLikeTheContainer)
+{
+    const std::string json(R"({"identifiers":{"entityId":"345"},"title":"The \"Pilot\"","entitled":true,"price":4.99,)"
+                           R"("episodes":12,"quality":["HD","UHD"],"languages":["en","de"]})");
+
+    JsonData_Offer container;
+    container.FromString(json);
+
+    Offer offer;
+    FireboltSDK::Decoded<Offer> response(offer);
+    ASSERT_TRUE(response.FromString(json));
+
+    EXPECT_FALSE(offer.identifiers.assetId.has_value());
+    EXPECT_FALSE(container.Identifiers.AssetId.IsSet());
+    ASSERT_TRUE(offer.identifiers.entityId.has_value());
+    EXPECT_EQ(offer.identifiers.entityId.value(), container.Identifiers.EntityId.Value());
+    EXPECT_EQ(offer.title, container.Title.Value());
+    ASSERT_TRUE(offer.entitled.has_value());
+    EXPECT_EQ(offer.entitled.value(), container.Entitled.Value());
+    ASSERT_TRUE(offer.price.has_value());
+    EXPECT_FLOAT_EQ(offer.price.value(), container.Price.Value());
+    EXPECT_EQ(offer.episodes, container.Episodes.Value());
+    std::vector<std::string> languages;
+    auto index(container.Languages.Elements());
+    while (index.Next() == true) {
+        languages.push_back(index.Current().Value());
+    }
+    EXPECT_EQ(offer.languages, languages);
+}
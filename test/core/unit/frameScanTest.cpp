@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include "Transport/inbound.h"
+
+#include <string>
+
+class FrameScanTest : public ::testing::Test {
+protected:
+    // Feeds the frame in pieces of the given size, as the channel hands them out
+    static bool Scan(FireboltSDK::FrameScanner& scanner, const std::string& frame, const uint32_t piece, uint32_t& consumed)
+    {
+        scanner.Reset();
+        consumed = 0;
+        while ((consumed < frame.size()) && (scanner.Complete() == false)) {
+            uint32_t length = std::min<uint32_t>(piece, frame.size() - consumed);
+            consumed += scanner.Feed(frame.data() + consumed, length);
+        }
+        return scanner.Complete();
+    }
+
+    static std::string Response(const uint32_t id, const size_t payload)
+    {
+        std::string result = R"({"jsonrpc":"2.0","id":)" + std::to_string(id) + R"(,"result":{"items":[)";
+        while (result.size() < payload) {
+            result += R"({"title":"Some \"quoted\" title with {braces} and [brackets]","value":12.5,"flag":true},)";
+        }
+        result += R"(null]}})";
+        return result;
+    }
+};
+
+TEST_F(FrameScanTest, RoutesResponse)
+{
+    const std::string frame = Response(42, 1024);
+    for (uint32_t piece : { 1u, 7u, 16u, 17u, 64u, 65535u }) {
+        FireboltSDK::FrameScanner scanner;
+        uint32_t consumed;
+        ASSERT_TRUE(Scan(scanner, frame, piece, consumed)) << piece;
+        EXPECT_EQ(consumed, frame.size()) << piece;
+
+        FireboltSDK::FrameScanner::Route route;
+        ASSERT_TRUE(scanner.Routing(frame, route));
+        EXPECT_TRUE(route.hasId);
+        EXPECT_EQ(route.id, 42u);
+        EXPECT_TRUE(route.method.empty());
+        EXPECT_TRUE(route.response);
+        EXPECT_EQ(frame.compare(route.result, 10, R"({"items":[)"), 0);
+    }
+}
+
+TEST_F(FrameScanTest, RoutesNotificationAndRequest)
+{
+    const std::string notification = R"(  {"jsonrpc":"2.0", "method" : "device.onNameChanged", "params":{"id":7,"method":"nested"}})";
+    FireboltSDK::FrameScanner scanner;
+    uint32_t consumed;
+    ASSERT_TRUE(Scan(scanner, notification, 5, consumed));
+    FireboltSDK::FrameScanner::Route route;
+    ASSERT_TRUE(scanner.Routing(notification, route));
+    EXPECT_FALSE(route.hasId);
+    EXPECT_EQ(route.method, "device.onNameChanged");
+    EXPECT_FALSE(route.response);
+
+    const std::string request = R"({"id":9,"method":"keyboard.standard","params":{"message":"\\\"}"}})";
+    ASSERT_TRUE(Scan(scanner, request, 3, consumed));
+    route = FireboltSDK::FrameScanner::Route();
+    ASSERT_TRUE(scanner.Routing(request, route));
+    EXPECT_TRUE(route.hasId);
+    EXPECT_EQ(route.id, 9u);
+    EXPECT_EQ(route.method, "keyboard.standard");
+    EXPECT_FALSE(route.response);
+}
+
+TEST_F(FrameScanTest, ErrorIsResponse)
+{
+    const std::string frame = R"({"jsonrpc":"2.0","id":3,"error":{"code":-32601,"message":"Method not found"}})";
+    FireboltSDK::FrameScanner scanner;
+    uint32_t consumed;
+    ASSERT_TRUE(Scan(scanner, frame, 16, consumed));
+    FireboltSDK::FrameScanner::Route route;
+    ASSERT_TRUE(scanner.Routing(frame, route));
+    EXPECT_EQ(route.id, 3u);
+    EXPECT_TRUE(route.response);
+    EXPECT_EQ(route.result, 0u);
+}
+
+TEST_F(FrameScanTest, StopsAtTheEndOfTheFrame)
+{
+    const std::string first = R"({"id":1,"result":"a}\"b"})";
+    const std::string frames = first + R"({"id":2,"result":true})";
+    FireboltSDK::FrameScanner scanner;
+    EXPECT_EQ(scanner.Feed(frames.data(), frames.size()), first.size());
+    EXPECT_TRUE(scanner.Complete());
+}
+
+TEST_F(FrameScanTest, RejectsNonObjects)
+{
+    for (const std::string frame : { std::string("[1,2]"), std::string("  x{}"), std::string("\"id\"") }) {
+        FireboltSDK::FrameScanner scanner;
+        EXPECT_EQ(scanner.Feed(frame.data(), frame.size()), frame.size());
+        EXPECT_TRUE(scanner.Complete());
+        EXPECT_TRUE(scanner.Failed());
+        FireboltSDK::FrameScanner::Route route;
+        EXPECT_FALSE(scanner.Routing(frame, route));
+    }
+}
+
+TEST_F(FrameScanTest, InboundMessageParsesOnDemand)
+{
+    FireboltSDK::InboundMessage message;
+    message.FromString(R"({"jsonrpc":"2.0","id":5,"result":{"name":"Living Room"}})");
+
+    EXPECT_EQ(message.Id.Value(), 5u);
+    EXPECT_TRUE(FireboltSDK::InboundMessage::IsResponse(message));
+    EXPECT_FALSE(message.Result.IsSet());
+
+    FireboltSDK::InboundMessage::Parse(message);
+    EXPECT_TRUE(message.Result.IsSet());
+    EXPECT_EQ(message.Result.Value(), R"({"name":"Living Room"})");
+    EXPECT_TRUE(FireboltSDK::InboundMessage::IsResponse(message));
+    EXPECT_EQ(FireboltSDK::InboundMessage::Result(message).substr(0, 22), R"({"name":"Living Room"})");
+}
+
+TEST_F(FrameScanTest, RoutesLikeTheParser)
+{
+    const std::string frame = Response(1, 4096);
+    FireboltSDK::FrameScanner scanner;
+    uint32_t consumed;
+    ASSERT_TRUE(Scan(scanner, frame, 0xFFFF, consumed));
+    FireboltSDK::FrameScanner::Route route;
+    ASSERT_TRUE(scanner.Routing(frame, route));
+
+    WPEFramework::Core::JSONRPC::Message message;
+    message.FromString(frame);
+    EXPECT_EQ(route.id, message.Id.Value());
+    EXPECT_EQ(route.response, message.Result.IsSet());
+    EXPECT_TRUE(route.method.empty());
+}
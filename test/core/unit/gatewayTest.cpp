@@ -1,5 +1,12 @@
 #include <gtest/gtest.h>
 #include "Gateway/Gateway.h"
+#include "Event/Event.h"
+#include "Async/Async.h"
+#include "TypesPriv.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 
 class GatewayTest : public ::testing::Test {
@@ -42,3 +49,266 @@ TEST_F(GatewayTest, UnSubscribe) {
 #endif
     EXPECT_EQ(status, Firebolt::Error::None) << "Error! status: " << static_cast<int32_t>(status) ;
 }
+
+TEST_F(GatewayTest, DefaultWaitTime) {
+    uint32_t getter = FireboltSDK::Config::WaitTime("device.name");
+    uint32_t interactive = FireboltSDK::Config::WaitTime("Keyboard.email");
+    EXPECT_LT(getter, interactive);
+    EXPECT_EQ(FireboltSDK::Config::WaitTime("DEVICE.NAME"), getter);
+    // Listening is answered right away, whatever provides the event
+    EXPECT_EQ(FireboltSDK::Config::WaitTime("device.onNameChanged"), getter);
+    EXPECT_EQ(FireboltSDK::Config::WaitTime("device.unknownMethod"), FireboltSDK::Config::FallbackWaitTime);
+    EXPECT_EQ(FireboltSDK::Config::WaitTime("device.name", 42), 42u);
+}
+
+TEST_F(GatewayTest, CancelledRequest) {
+    bool handled = false;
+    FireboltSDK::CancellationToken token = FireboltSDK::CancellationToken::Create();
+    EXPECT_TRUE(token.Bind([&handled]() { handled = true; }));
+    token.Cancel();
+    EXPECT_TRUE(handled);
+    EXPECT_TRUE(token.IsCancelled());
+    EXPECT_FALSE(token.Bind([]() {}));
+
+    JsonObject jsonParameters;
+    WPEFramework::Core::JSON::VariantContainer jsonResult;
+    status = FireboltSDK::Gateway::Instance().Request("authentication.device", jsonParameters, jsonResult, FireboltSDK::Config::DefaultWaitTime, token);
+    EXPECT_EQ(status, Firebolt::Error::Cancelled) << "Error! status: " << static_cast<int32_t>(status) ;
+}
+
+TEST_F(GatewayTest, SubscribeMany) {
+    std::vector<FireboltSDK::Event::Subscription> subscriptions;
+    subscriptions.push_back(FireboltSDK::Event::MakeSubscription<WPEFramework::Core::JSON::VariantContainer>(_T("device.onHdrChanged"), onPolicyChangedInnerCallback, nullptr, nullptr));
+    subscriptions.push_back(FireboltSDK::Event::MakeSubscription<WPEFramework::Core::JSON::VariantContainer>(_T("device.onNetworkChanged"), onPolicyChangedInnerCallback, nullptr, nullptr));
+
+    status = FireboltSDK::Event::Instance().SubscribeMany(subscriptions);
+    EXPECT_EQ(status, Firebolt::Error::None) << "Error! status: " << static_cast<int32_t>(status) ;
+    for (const auto& subscription : subscriptions) {
+        EXPECT_EQ(subscription.status, Firebolt::Error::None) << subscription.event;
+    }
+}
+
+TEST_F(GatewayTest, WireSubscriptionGracePeriod) {
+    const std::string event = _T("device.onNameChanged");
+    FireboltSDK::WireSubscriptions subscriptions(1000);
+    std::vector<std::string> dropped;
+    auto drop = [&dropped](const std::string& event) { dropped.push_back(event); };
+
+    EXPECT_TRUE(subscriptions.Acquire(event));
+    subscriptions.Confirm(event);
+    EXPECT_FALSE(subscriptions.Acquire(event));
+
+    uint64_t dropAt = 0;
+    EXPECT_TRUE(subscriptions.Release(event, dropAt));
+    EXPECT_NE(dropAt, 0u);
+
+    // Coming back within the grace period keeps the wire subscription
+    EXPECT_FALSE(subscriptions.Acquire(event));
+    EXPECT_EQ(subscriptions.Expire(dropAt, drop), 0u);
+    EXPECT_TRUE(dropped.empty());
+
+    EXPECT_TRUE(subscriptions.Release(event, dropAt));
+    EXPECT_EQ(subscriptions.Expire(dropAt, drop), 0u);
+    ASSERT_EQ(dropped.size(), 1u);
+    EXPECT_EQ(dropped[0], event);
+    EXPECT_TRUE(subscriptions.Acquire(event));
+}
+
+TEST_F(GatewayTest, WireSubscriptionAcquireWaitsForTheDrop) {
+    const std::string event = _T("device.onNameChanged");
+    FireboltSDK::WireSubscriptions subscriptions(1000);
+    std::atomic<bool> acquired(false);
+    bool listen = false;
+    std::thread listener;
+
+    EXPECT_TRUE(subscriptions.Acquire(event));
+    subscriptions.Confirm(event);
+    uint64_t dropAt = 0;
+    EXPECT_TRUE(subscriptions.Release(event, dropAt));
+
+    // The drop runs out of the lock, a listener coming back meanwhile has to wait for it
+    auto drop = [&](const std::string&) {
+        listener = std::thread([&]() {
+            listen = subscriptions.Acquire(event);
+            acquired = true;
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_FALSE(acquired.load());
+    };
+    EXPECT_EQ(subscriptions.Expire(dropAt, drop), 0u);
+    listener.join();
+    EXPECT_TRUE(listen);
+}
+
+TEST_F(GatewayTest, WireSubscriptionAcquireWaitsForTheListenRequest) {
+    const std::string event = _T("device.onNameChanged");
+    FireboltSDK::WireSubscriptions subscriptions(1000);
+
+    // The first listener's listen:true fails, the one waiting for it sends its own
+    EXPECT_TRUE(subscriptions.Acquire(event));
+    EXPECT_EQ(subscriptions.TryAcquire(event), FireboltSDK::WireSubscriptions::Claim::Busy);
+    uint64_t dropAt = 0;
+    EXPECT_FALSE(subscriptions.Release(event, dropAt));
+
+    std::atomic<bool> acquired(false);
+    bool listen = false;
+    std::thread listener([&]() {
+        listen = subscriptions.Acquire(event);
+        acquired = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(acquired.load());
+    subscriptions.Abandon(event);
+    listener.join();
+    EXPECT_TRUE(listen);
+
+    // That one makes it, the next listener is told only then
+    acquired = false;
+    listener = std::thread([&]() {
+        listen = subscriptions.Acquire(event);
+        acquired = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(acquired.load());
+    subscriptions.Confirm(event);
+    listener.join();
+    EXPECT_FALSE(listen);
+    EXPECT_EQ(subscriptions.TryAcquire(event), FireboltSDK::WireSubscriptions::Claim::Listening);
+}
+
+static void onLanguageChangedInnerCallback( void* notification, const void* userData, void* jsonResponse )
+{
+    WPEFramework::Core::ProxyType<FireboltSDK::JSON::String>& proxyResponse = *(reinterpret_cast<WPEFramework::Core::ProxyType<FireboltSDK::JSON::String>*>(jsonResponse));
+    EXPECT_TRUE(proxyResponse.IsValid());
+    proxyResponse.Release();
+    ++(*static_cast<uint32_t*>(notification));
+}
+
+TEST_F(GatewayTest, StickyEvent) {
+    const std::string eventName = _T("localization.onLanguageChanged");
+    EXPECT_EQ(FireboltSDK::StickyEvents::Getter(eventName), _T("localization.language"));
+
+    status = FireboltSDK::Event::Instance().SetSticky<FireboltSDK::JSON::String>(eventName);
+    EXPECT_EQ(status, Firebolt::Error::None) << "Error! status: " << static_cast<int32_t>(status) ;
+
+    // Seeded by the getter, then handed to the listener before Subscribe() returns
+    uint32_t delivered = 0;
+    JsonObject jsonParameters;
+    status = FireboltSDK::Event::Instance().Subscribe<FireboltSDK::JSON::String>(eventName, jsonParameters, onLanguageChangedInnerCallback, &delivered, nullptr);
+    EXPECT_EQ(status, Firebolt::Error::None) << "Error! status: " << static_cast<int32_t>(status) ;
+    EXPECT_EQ(delivered, 1u);
+
+    FireboltSDK::Event::Instance().Unsubscribe(eventName, &delivered);
+    status = FireboltSDK::Event::Instance().ClearSticky(eventName);
+    EXPECT_EQ(status, Firebolt::Error::None) << "Error! status: " << static_cast<int32_t>(status) ;
+}
+
+static void onEmailInnerCallback( void* usercb, void* jsonResponse, Firebolt::Error status )
+{
+    WPEFramework::Core::ProxyType<FireboltSDK::JSON::String>& proxyResponse = *(reinterpret_cast<WPEFramework::Core::ProxyType<FireboltSDK::JSON::String>*>(jsonResponse));
+    EXPECT_TRUE(proxyResponse.IsValid());
+    proxyResponse.Release();
+    ++(*static_cast<std::atomic<uint32_t>*>(usercb));
+}
+
+TEST_F(GatewayTest, AsyncRequest) {
+    // Failing to send, the completion is not run
+    bool completed = false;
+    FireboltSDK::CancellationToken token = FireboltSDK::CancellationToken::Create();
+    token.Cancel();
+    JsonObject jsonParameters;
+    status = FireboltSDK::Gateway::Instance().RequestAsync("authentication.device", jsonParameters, [&completed](const Firebolt::Error, const std::string&) { completed = true; }, FireboltSDK::Config::DefaultWaitTime, token);
+    EXPECT_EQ(status, Firebolt::Error::Cancelled) << "Error! status: " << static_cast<int32_t>(status) ;
+    EXPECT_FALSE(completed);
+
+    std::atomic<uint32_t> answered(0);
+    FireboltSDK::Async::Handle handle = FireboltSDK::Async::InvalidHandle;
+    jsonParameters.Set(_T("type"), WPEFramework::Core::JSON::Variant("signIn"));
+    status = FireboltSDK::Async::Instance().Invoke<FireboltSDK::JSON::String>(_T("Keyboard.email"), jsonParameters, onEmailInnerCallback, &answered, FireboltSDK::Config::DefaultWaitTime, &handle);
+    EXPECT_EQ(status, Firebolt::Error::None) << "Error! status: " << static_cast<int32_t>(status) ;
+    EXPECT_NE(handle, FireboltSDK::Async::InvalidHandle);
+
+    // Either answered already or never, once aborted
+    status = FireboltSDK::Async::Instance().Abort(handle);
+    EXPECT_EQ(status, Firebolt::Error::None);
+    uint32_t seen = answered.load();
+    EXPECT_LE(seen, 1u);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(answered.load(), seen);
+}
+
+#ifndef GATEWAY_BIDIRECTIONAL
+struct LeavingListener {
+    std::atomic<bool> gone{false};
+    std::atomic<uint32_t> late{0};
+};
+
+static void onLeavingInnerCallback( void* usercb, const void* userData, void* jsonResponse )
+{
+    delete static_cast<WPEFramework::Core::ProxyType<WPEFramework::Core::JSON::VariantContainer>*>(jsonResponse);
+    LeavingListener* listener = static_cast<LeavingListener*>(usercb);
+    if (listener->gone.load() == true) {
+        ++listener->late;
+    }
+}
+
+TEST_F(GatewayTest, UnsubscribeWhileDispatching) {
+    // Keeps the batches for the test to run them, as a main loop would
+    class Loop : public Firebolt::IDispatcher {
+    public:
+        void Post(std::function<void()>&& batch) override
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            batches.push_back(std::move(batch));
+        }
+        void Run()
+        {
+            std::vector<std::function<void()>> pending;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                pending.swap(batches);
+            }
+            for (auto& batch : pending) {
+                batch();
+            }
+        }
+
+    private:
+        std::mutex mutex;
+        std::vector<std::function<void()>> batches;
+    };
+
+    const std::string eventName = _T("device.onNameChanged");
+    Loop loop;
+    FireboltSDK::CallbackDispatcher::Instance().Assign(&loop);
+
+    // Notifications keep coming in on another thread, none may reach the listener once Unsubscribe() returned
+    std::atomic<bool> dispatching{true};
+    std::thread notifier([&dispatching, &eventName]() {
+        FireboltSDK::IEventHandler& handler = FireboltSDK::Event::Instance();
+        WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message> message = WPEFramework::Core::ProxyType<WPEFramework::Core::JSONRPC::Message>::Create();
+        message->Result = _T("{}");
+        while (dispatching.load() == true) {
+            handler.Dispatch(eventName, message);
+        }
+    });
+
+    for (uint32_t round = 0; round < 100; ++round) {
+        LeavingListener listener;
+        JsonObject jsonParameters;
+        status = FireboltSDK::Event::Instance().Subscribe<WPEFramework::Core::JSON::VariantContainer>(eventName, jsonParameters, onLeavingInnerCallback, &listener, nullptr);
+        ASSERT_EQ(status, Firebolt::Error::None) << "Error! status: " << static_cast<int32_t>(status) ;
+        loop.Run();
+
+        FireboltSDK::Event::Instance().Unsubscribe(eventName, &listener);
+        listener.gone = true;
+        loop.Run();
+        EXPECT_EQ(listener.late.load(), 0u);
+    }
+
+    dispatching = false;
+    notifier.join();
+    FireboltSDK::CallbackDispatcher::Instance().Assign(nullptr);
+    loop.Run();
+}
+#endif
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include "Gateway/function.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace {
+    // Captured by a callable, tells where the copy of it in use lives: within the function object that holds
+    // it when stored inline, elsewhere when it had to go to the heap
+    class Located {
+    public:
+        Located& operator=(const Located&) = delete;
+
+        Located(const void*& at)
+            : _at(at)
+        {
+            _at = this;
+        }
+        Located(const Located& other) noexcept
+            : _at(other._at)
+        {
+            _at = this;
+        }
+
+    private:
+        const void*& _at;
+    };
+
+    template <typename OBJECT>
+    bool Inside(const void* address, const OBJECT& object)
+    {
+        const uintptr_t begin = reinterpret_cast<uintptr_t>(&object);
+        const uintptr_t at = reinterpret_cast<uintptr_t>(address);
+        return ((at >= begin) && (at < begin + sizeof(OBJECT)));
+    }
+
+    using Listener = std::function<void(void* usercb, const void* userdata, void* parameters)>;
+    using Dispatch = FireboltSDK::InplaceFunction<void(void*, const void*, const std::string& parameters)>;
+}
+
+static_assert(std::is_copy_constructible<Dispatch>::value == false, "InplaceFunction is move-only");
+static_assert(std::is_nothrow_move_constructible<Dispatch>::value == true, "InplaceFunction moves without throwing");
+
+TEST(InplaceFunction, DispatchesWithoutAllocating)
+{
+    Listener listener = [](void*, const void*, void* parameters) { ++*static_cast<uint32_t*>(parameters); };
+    uint32_t calls = 0;
+    const void* at = nullptr;
+    Located located(at);
+    {
+        // What Server::Dispatcher() and Event::Dispatcher() capture: the listener of the sticky events
+        Dispatch dispatch = [listener, &calls, located](void* usercb, const void* userdata, const std::string&) {
+            listener(usercb, userdata, &calls);
+        };
+        EXPECT_TRUE(Inside(at, dispatch));
+        Dispatch moved(std::move(dispatch));
+        EXPECT_TRUE(Inside(at, moved));
+        Dispatch assigned;
+        assigned = std::move(moved);
+        EXPECT_TRUE(Inside(at, assigned));
+        assigned(nullptr, nullptr, "{}");
+        assigned(nullptr, nullptr, "{}");
+        EXPECT_FALSE(dispatch);
+        EXPECT_FALSE(moved);
+        EXPECT_TRUE(assigned);
+    }
+    EXPECT_EQ(calls, 2u);
+}
+
+TEST(InplaceFunction, StdFunctionAllocatesForTheSameCapture)
+{
+    Listener listener = [](void*, const void*, void*) {};
+    std::string method("keyboard.standard");
+    const void* at = nullptr;
+    Located located(at);
+    std::function<void(void*, const void*, const std::string&)> dispatch = [listener, method, located](void* usercb, const void* userdata, const std::string&) {
+        listener(usercb, userdata, nullptr);
+    };
+    EXPECT_FALSE(Inside(at, dispatch));
+}
+
+TEST(InplaceFunction, TakesFunctionPointersAndMoveOnlyCaptures)
+{
+    FireboltSDK::InplaceFunction<int(int)> increment = +[](int value) { return value + 1; };
+    EXPECT_EQ(increment(1), 2);
+
+    auto value = std::make_unique<int>(41);
+    FireboltSDK::InplaceFunction<int()> owning = [value = std::move(value)]() { return *value + 1; };
+    EXPECT_EQ(owning(), 42);
+}
+
+TEST(InplaceFunction, DestroysTheCallableOnce)
+{
+    auto shared = std::make_shared<int>(0);
+    {
+        FireboltSDK::InplaceFunction<long()> function = [shared]() { return shared.use_count(); };
+        EXPECT_EQ(shared.use_count(), 2);
+        FireboltSDK::InplaceFunction<long()> moved(std::move(function));
+        EXPECT_EQ(shared.use_count(), 2);
+        EXPECT_EQ(moved(), 2);
+        moved = nullptr;
+        EXPECT_EQ(shared.use_count(), 1);
+        moved = [shared]() { return shared.use_count(); };
+    }
+    EXPECT_EQ(shared.use_count(), 1);
+}
@@ -0,0 +1,262 @@
+#include <gtest/gtest.h>
+#include "Gateway/jsonreader.h"
+
+#include <clocale>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Profiles {
+        bool stereo;
+        bool atmos;
+        int32_t channels;
+        std::string name;
+        std::optional<std::string> label;
+        std::vector<std::string> codecs;
+    };
+
+    bool Decode(FireboltSDK::JsonReader& reader, Profiles& value)
+    {
+        std::string_view key;
+        bool decoded = reader.BeginObject();
+        while ((decoded == true) && (reader.Next(key) == true)) {
+            if (key == "stereo") {
+                decoded = reader.Read(value.stereo);
+            } else if (key == "dolbyAtmos") {
+                decoded = reader.Read(value.atmos);
+            } else if (key == "channels") {
+                decoded = reader.Read(value.channels);
+            } else if (key == "name") {
+                decoded = reader.Read(value.name);
+            } else if (key == "label") {
+                decoded = reader.Read(value.label);
+            } else if (key == "codecs") {
+                decoded = reader.BeginArray();
+                while ((decoded == true) && (reader.NextElement() == true)) {
+                    decoded = reader.Read(value.codecs.emplace_back());
+                }
+            } else {
+                decoded = reader.Skip();
+            }
+        }
+        return (reader.Failed() == false);
+    }
+
+    class JsonData_Profiles : public WPEFramework::Core::JSON::Container {
+    public:
+        JsonData_Profiles()
+            : WPEFramework::Core::JSON::Container()
+        {
+            Add(_T("stereo"), &Stereo);
+            Add(_T("dolbyAtmos"), &DolbyAtmos);
+            Add(_T("channels"), &Channels);
+            Add(_T("name"), &Name);
+            Add(_T("label"), &Label);
+            Add(_T("codecs"), &Codecs);
+        }
+
+    public:
+        WPEFramework::Core::JSON::Boolean Stereo;
+        WPEFramework::Core::JSON::Boolean DolbyAtmos;
+        WPEFramework::Core::JSON::DecSInt32 Channels;
+        WPEFramework::Core::JSON::String Name;
+        WPEFramework::Core::JSON::String Label;
+        WPEFramework::Core::JSON::ArrayType<WPEFramework::Core::JSON::String> Codecs;
+    };
+}
+
+class JsonReaderTest : public ::testing::Test {
+protected:
+    static constexpr const char* Result = R"({ "stereo": true, "dolbyAtmos": false, "channels": 6, "name": "Living \"room\"",)"
+                                          R"( "extra": { "nested": [1, 2.5e3, null, "x"] }, "codecs": ["ac3", "eac3"] })";
+};
+
+TEST_F(JsonReaderTest, DecodesStruct)
+{
+    Profiles profiles;
+    FireboltSDK::Decoded<Profiles> response(profiles);
+    EXPECT_TRUE(response.FromString(Result));
+
+    EXPECT_TRUE(profiles.stereo);
+    EXPECT_FALSE(profiles.atmos);
+    EXPECT_EQ(profiles.channels, 6);
+    EXPECT_EQ(profiles.name, "Living \"room\"");
+    EXPECT_FALSE(profiles.label.has_value());
+    EXPECT_EQ(profiles.codecs, (std::vector<std::string>{ "ac3", "eac3" }));
+}
+
+TEST_F(JsonReaderTest, MissingMembersAreReset)
+{
+    Profiles profiles;
+    profiles.stereo = true;
+    profiles.label = "stale";
+    profiles.codecs = { "stale" };
+    FireboltSDK::Decoded<Profiles> response(profiles);
+    EXPECT_TRUE(response.FromString(R"({"channels":2,"label":null})"));
+
+    EXPECT_FALSE(profiles.stereo);
+    EXPECT_EQ(profiles.channels, 2);
+    EXPECT_FALSE(profiles.label.has_value());
+    EXPECT_TRUE(profiles.codecs.empty());
+}
+
+TEST_F(JsonReaderTest, Escapes)
+{
+    FireboltSDK::JsonReader reader(R"("a\"b\\c\/\n\t\u0041\u00e9\ud83d\ude00")");
+    std::string value;
+    EXPECT_TRUE(reader.Read(value));
+    EXPECT_TRUE(reader.Done());
+    EXPECT_EQ(value, "a\"b\\c/\n\tA\xc3\xa9\xf0\x9f\x98\x80");
+}
+
+TEST_F(JsonReaderTest, StringViewsOverTheText)
+{
+    const std::string json(R"({"plain":"abc","escaped":"a\nb","k\u0065y":"","skipped":"x\"y"})");
+    FireboltSDK::JsonReader reader(json);
+    std::string_view key;
+    std::string_view plain;
+    std::string_view escaped;
+    std::string_view empty;
+
+    ASSERT_TRUE(reader.BeginObject());
+    ASSERT_TRUE(reader.Next(key));
+    EXPECT_EQ(key, "plain");
+    EXPECT_TRUE((key.data() > json.data()) && (key.data() < json.data() + json.size()));
+    ASSERT_TRUE(reader.Read(plain));
+    ASSERT_TRUE(reader.Next(key));
+    ASSERT_TRUE(reader.Read(escaped));
+    ASSERT_TRUE(reader.Next(key));
+    EXPECT_EQ(key, "key");
+    ASSERT_TRUE(reader.Read(empty));
+    ASSERT_TRUE(reader.Next(key));
+    ASSERT_TRUE(reader.Skip());
+    EXPECT_FALSE(reader.Next(key));
+    EXPECT_TRUE(reader.Done());
+
+    // No copy for the plain string, the escaped one had to be unescaped into storage of the reader
+    EXPECT_EQ(plain, "abc");
+    EXPECT_EQ(plain.data(), json.data() + json.find("abc"));
+    EXPECT_EQ(escaped, "a\nb");
+    EXPECT_TRUE((escaped.data() < json.data()) || (escaped.data() >= json.data() + json.size()));
+    EXPECT_TRUE(empty.empty());
+}
+
+TEST_F(JsonReaderTest, DecodedFromFrame)
+{
+    // The result runs on with the rest of the frame, as it is handed out of a received message
+    const std::string frame(R"({"jsonrpc":"2.0","id":4,"result":"Living room","extra":[1]})");
+    std::string name;
+    FireboltSDK::Decoded<std::string> response(name);
+    EXPECT_TRUE(response.FromFrame(std::string_view(frame).substr(frame.find("\"Living"))));
+    EXPECT_EQ(name, "Living room");
+
+    EXPECT_FALSE(response.FromString(R"("Living room" trailing)"));
+    EXPECT_TRUE(response.FromString(R"( "Kitchen" )"));
+    EXPECT_EQ(name, "Kitchen");
+}
+
+TEST_F(JsonReaderTest, Numbers)
+{
+    {
+        FireboltSDK::JsonReader reader("-42");
+        int32_t value = 0;
+        EXPECT_TRUE(reader.Read(value));
+        EXPECT_EQ(value, -42);
+    }
+    {
+        FireboltSDK::JsonReader reader("1.5");
+        int32_t value = 0;
+        EXPECT_FALSE(reader.Read(value));
+        EXPECT_TRUE(reader.Failed());
+    }
+    {
+        FireboltSDK::JsonReader reader("300");
+        uint8_t value = 0;
+        EXPECT_FALSE(reader.Read(value));
+    }
+    {
+        FireboltSDK::JsonReader reader("-2.5e-3");
+        double value = 0;
+        EXPECT_TRUE(reader.Read(value));
+        EXPECT_DOUBLE_EQ(value, -2.5e-3);
+    }
+    for (const char* text : { "+1.5", "inf", "-nan", ".5" }) {
+        FireboltSDK::JsonReader reader(text);
+        double value = 0;
+        EXPECT_FALSE(reader.Read(value)) << text;
+    }
+    {
+        // Out of the range of a float
+        FireboltSDK::JsonReader reader("1e39");
+        float value = 0;
+        EXPECT_FALSE(reader.Read(value));
+    }
+    {
+        FireboltSDK::JsonReader reader("0.25");
+        float value = 0;
+        EXPECT_TRUE(reader.Read(value));
+        EXPECT_FLOAT_EQ(value, 0.25f);
+    }
+}
+
+TEST_F(JsonReaderTest, NumbersWhateverTheLocale)
+{
+    // An application may use a decimal comma, when one is installed
+    const std::string former(std::setlocale(LC_NUMERIC, nullptr));
+    for (const char* name : { "de_DE.UTF-8", "fr_FR.UTF-8", "nl_NL.UTF-8" }) {
+        if (std::setlocale(LC_NUMERIC, name) != nullptr) {
+            break;
+        }
+    }
+    FireboltSDK::JsonReader reader("0.5");
+    double value = 0;
+    const bool decoded = reader.Read(value);
+    std::setlocale(LC_NUMERIC, former.c_str());
+    EXPECT_TRUE(decoded);
+    EXPECT_DOUBLE_EQ(value, 0.5);
+}
+
+TEST_F(JsonReaderTest, MalformedInputFails)
+{
+    const std::vector<std::string> inputs = {
+        R"({"stereo":true,})",
+        R"({"stereo" true})",
+        R"({"stereo":tru})",
+        R"({"name":"unterminated})",
+        R"({"codecs":["ac3" "eac3"]})",
+        R"({"name":"\x"})",
+        R"({"stereo":true} trailing)",
+        R"()",
+    };
+    for (const auto& input : inputs) {
+        Profiles profiles;
+        FireboltSDK::Decoded<Profiles> response(profiles);
+        EXPECT_FALSE(response.FromString(input)) << input;
+    }
+}
+
+TEST_F(JsonReaderTest, DecodesLikeTheContainer)
+{
+    const std::string result(Result);
+
+    JsonData_Profiles container;
+    container.FromString(result);
+
+    Profiles profiles;
+    FireboltSDK::Decoded<Profiles> response(profiles);
+    ASSERT_TRUE(response.FromString(result));
+
+    EXPECT_EQ(profiles.stereo, container.Stereo.Value());
+    EXPECT_EQ(profiles.atmos, container.DolbyAtmos.Value());
+    EXPECT_EQ(profiles.channels, container.Channels.Value());
+    EXPECT_EQ(profiles.name, container.Name.Value());
+    EXPECT_EQ(profiles.label.has_value(), container.Label.IsSet());
+    std::vector<std::string> codecs;
+    auto index(container.Codecs.Elements());
+    while (index.Next() == true) {
+        codecs.push_back(index.Current().Value());
+    }
+    EXPECT_EQ(profiles.codecs, codecs);
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include "Gateway/jsonwriter.h"
+
+#include <clocale>
+#include <cmath>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class JsonWriterTest : public ::testing::Test {
+};
+
+TEST_F(JsonWriterTest, Empty)
+{
+    FireboltSDK::JsonWriter writer;
+    EXPECT_EQ(writer.Finish(), "{}");
+}
+
+TEST_F(JsonWriterTest, Scalars)
+{
+    FireboltSDK::JsonWriter writer;
+    writer.Add("title", std::string("Movie"))
+          .Add("name", "text")
+          .Add("visible", true)
+          .Add("count", 42)
+          .Add("offset", static_cast<int64_t>(-7))
+          .Add("ratio", 0.5);
+    EXPECT_EQ(writer.Finish(), R"({"title":"Movie","name":"text","visible":true,"count":42,"offset":-7,"ratio":0.5})");
+}
+
+TEST_F(JsonWriterTest, NonFiniteIsNull)
+{
+    FireboltSDK::JsonWriter writer;
+    writer.Add("nan", std::nan("")).Add("inf", HUGE_VAL);
+    EXPECT_EQ(writer.Finish(), R"({"nan":null,"inf":null})");
+}
+
+TEST_F(JsonWriterTest, DoublesAreShortestWhateverTheLocale)
+{
+    // An application may use a decimal comma, when one is installed
+    const std::string former(std::setlocale(LC_NUMERIC, nullptr));
+    for (const char* name : { "de_DE.UTF-8", "fr_FR.UTF-8", "nl_NL.UTF-8" }) {
+        if (std::setlocale(LC_NUMERIC, name) != nullptr) {
+            break;
+        }
+    }
+    FireboltSDK::JsonWriter writer;
+    writer.Add("half", 0.5).Add("tenth", 0.1).Add("large", 1e300);
+    std::setlocale(LC_NUMERIC, former.c_str());
+    EXPECT_EQ(writer.Finish(), R"({"half":0.5,"tenth":0.1,"large":1e+300})");
+}
+
+TEST_F(JsonWriterTest, Escaping)
+{
+    FireboltSDK::JsonWriter writer;
+    writer.Add("value", std::string("a\"b\\c\n\t\x01/\xc3\xa9"));
+    EXPECT_EQ(writer.Finish(), "{\"value\":\"a\\\"b\\\\c\\n\\t\\u0001/\xc3\xa9\"}");
+}
+
+TEST_F(JsonWriterTest, OptionalsAreOmittedWhenAbsent)
+{
+    std::optional<std::string> expires;
+    std::optional<bool> force = false;
+    FireboltSDK::JsonWriter writer;
+    writer.Add("expires", expires).Add("force", force).Add("count", std::optional<uint32_t>());
+    EXPECT_EQ(writer.Finish(), R"({"force":false})");
+}
+
+TEST_F(JsonWriterTest, FlatMap)
+{
+    std::unordered_map<std::string, std::string> map = { { "key \"1\"", "value" } };
+    FireboltSDK::JsonWriter writer;
+    writer.Add("parameters", map).Add("empty", std::unordered_map<std::string, std::string>());
+    EXPECT_EQ(writer.Finish(), R"({"parameters":{"key \"1\"":"value"},"empty":{}})");
+}
+
+TEST_F(JsonWriterTest, NestedObjectsAndArrays)
+{
+    std::vector<std::string> capabilities = { "xrn:firebolt:capability:a", "xrn:firebolt:capability:b" };
+    FireboltSDK::JsonWriter writer;
+    writer.Add("appId", "app");
+    writer.BeginArray("permissions");
+    for (auto& capability : capabilities) {
+        writer.BeginObject().Add("capability", capability).EndObject();
+    }
+    writer.EndArray();
+    writer.BeginArray("empty").EndArray();
+    writer.BeginObject("options").Add("force", true).EndObject();
+    writer.AddJson("images", R"({"en":"a.png"})");
+    EXPECT_EQ(writer.Finish(),
+        R"({"appId":"app","permissions":[{"capability":"xrn:firebolt:capability:a"},{"capability":"xrn:firebolt:capability:b"}],)"
+        R"("empty":[],"options":{"force":true},"images":{"en":"a.png"}})");
+}
+
+TEST_F(JsonWriterTest, ParsesAsJsonObject)
+{
+    FireboltSDK::JsonWriter writer;
+    writer.Add("title", std::string("a \"quoted\"\ntitle")).Add("count", 3).BeginObject("identifiers").Add("assetId", "id").EndObject();
+
+    JsonObject parameters;
+    parameters.FromString(writer.Finish());
+    EXPECT_EQ(parameters.Get("title").String(), "a \"quoted\"\ntitle");
+    EXPECT_EQ(parameters.Get("count").Number(), 3);
+    EXPECT_EQ(parameters.Get("identifiers").Object().Get("assetId").String(), "id");
+}
+
+TEST_F(JsonWriterTest, Container)
+{
+    class JsonData_Result : public WPEFramework::Core::JSON::Container {
+    public:
+        JsonData_Result()
+            : WPEFramework::Core::JSON::Container()
+        {
+            Add(_T("expires"), &Expires);
+            Add(_T("totalCount"), &TotalCount);
+        }
+
+    public:
+        WPEFramework::Core::JSON::String Expires;
+        WPEFramework::Core::JSON::DecSInt32 TotalCount;
+    };
+
+    JsonData_Result result;
+    result.Expires = "2025-01-01T00:00:00Z";
+    result.TotalCount = 2;
+
+    FireboltSDK::JsonWriter writer;
+    writer.Add("correlationId", "abc").AddContainer("result", result);
+    EXPECT_EQ(writer.Finish(), R"({"correlationId":"abc","result":{"expires":"2025-01-01T00:00:00Z","totalCount":2}})");
+}
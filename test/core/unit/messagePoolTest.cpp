@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include "Transport/messagepool.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    template <uint8_t TAG>
+    class Message {
+    public:
+        Message()
+            : text()
+            , cleared(0)
+        {
+        }
+        virtual ~Message() = default;
+
+        void Clear()
+        {
+            text.clear();
+            ++cleared;
+        }
+
+    public:
+        std::string text;
+        uint32_t cleared;
+    };
+
+    class Recyclable : public Message<0> {
+    public:
+        void Recycle()
+        {
+            Clear();
+            ++recycled;
+        }
+
+    public:
+        uint32_t recycled = 0;
+    };
+
+    class MessagePoolTest : public ::testing::Test {
+    protected:
+        void TearDown() override
+        {
+            FireboltSDK::MessagePool::Configure(FireboltSDK::MessagePool::DefaultLimits);
+        }
+    };
+}
+
+TEST_F(MessagePoolTest, ReusesWhatTheThreadReleased)
+{
+    using Pool = FireboltSDK::MessagePoolType<Message<1>>;
+
+    WPEFramework::Core::ProxyType<Message<1>> message = Pool::Instance().Element();
+    const Message<1>* first = &(*message);
+    message->text.assign(200, 'x');
+    const size_t capacity = message->text.capacity();
+    message.Release();
+
+    message = Pool::Instance().Element();
+    EXPECT_EQ(&(*message), first);
+    EXPECT_TRUE(message->text.empty());
+    EXPECT_EQ(message->text.capacity(), capacity);
+    EXPECT_EQ(message->cleared, 1u);
+
+    FireboltSDK::MessagePool::Statistics stats = Pool::Instance().Stats();
+    EXPECT_EQ(stats.created, 1u);
+    EXPECT_EQ(stats.threadHits, 1u);
+    EXPECT_EQ(stats.sharedHits, 0u);
+}
+
+TEST_F(MessagePoolTest, KeepsTheMessageWhileReferenced)
+{
+    using Pool = FireboltSDK::MessagePoolType<Message<2>>;
+
+    WPEFramework::Core::ProxyType<Message<2>> message = Pool::Instance().Element();
+    WPEFramework::Core::ProxyType<Message<2>> copy = message;
+    message->text = "kept";
+    message.Release();
+
+    WPEFramework::Core::ProxyType<Message<2>> other = Pool::Instance().Element();
+    EXPECT_NE(&(*other), &(*copy));
+    EXPECT_EQ(copy->text, "kept");
+    EXPECT_EQ(copy->cleared, 0u);
+    EXPECT_EQ(Pool::Instance().Stats().created, 2u);
+}
+
+TEST_F(MessagePoolTest, RecyclesThroughRecycleWhenThereIsOne)
+{
+    using Pool = FireboltSDK::MessagePoolType<Recyclable>;
+
+    WPEFramework::Core::ProxyType<Recyclable> message = Pool::Instance().Element();
+    message.Release();
+
+    message = Pool::Instance().Element();
+    EXPECT_EQ(message->recycled, 1u);
+    EXPECT_EQ(message->cleared, 1u);
+}
+
+TEST_F(MessagePoolTest, SpillsAboveTheHighWaterMark)
+{
+    using Pool = FireboltSDK::MessagePoolType<Message<3>>;
+    FireboltSDK::MessagePool::Configure({ 4, 2, 3 });
+
+    std::vector<WPEFramework::Core::ProxyType<Message<3>>> messages;
+    for (uint8_t index = 0; index < 8; ++index) {
+        messages.push_back(Pool::Instance().Element());
+    }
+    // The fifth one released takes the cache above 4, all but 2 go to the shared list. The eighth does it
+    // again, with the shared list full already.
+    messages.clear();
+
+    FireboltSDK::MessagePool::Statistics stats = Pool::Instance().Stats();
+    EXPECT_EQ(stats.created, 8u);
+    EXPECT_EQ(stats.spilled, 3u);
+    EXPECT_EQ(stats.freed, 3u);
+    EXPECT_EQ(stats.shared, 3u);
+}
+
+TEST_F(MessagePoolTest, OtherThreadsTakeFromTheSharedList)
+{
+    using Pool = FireboltSDK::MessagePoolType<Message<4>>;
+    FireboltSDK::MessagePool::Configure({ 2, 0, 8 });
+
+    // Received on one thread, released on another: the receiver finds them in the shared list
+    std::vector<WPEFramework::Core::ProxyType<Message<4>>> messages;
+    for (uint8_t index = 0; index < 3; ++index) {
+        messages.push_back(Pool::Instance().Element());
+    }
+    std::thread releaser([&messages]() { messages.clear(); });
+    releaser.join();
+    EXPECT_EQ(Pool::Instance().Stats().shared, 3u);
+
+    FireboltSDK::MessagePool::Configure({ 2, 2, 8 });
+    WPEFramework::Core::ProxyType<Message<4>> first = Pool::Instance().Element();
+    WPEFramework::Core::ProxyType<Message<4>> second = Pool::Instance().Element();
+    WPEFramework::Core::ProxyType<Message<4>> third = Pool::Instance().Element();
+
+    FireboltSDK::MessagePool::Statistics stats = Pool::Instance().Stats();
+    EXPECT_EQ(stats.created, 3u);
+    EXPECT_EQ(stats.sharedHits, 1u); // and the other two came along with it
+    EXPECT_EQ(stats.threadHits, 2u);
+    EXPECT_EQ(stats.shared, 0u);
+}
+
+TEST_F(MessagePoolTest, LowWaterMarkIsCappedByTheHighOne)
+{
+    FireboltSDK::MessagePool::Configure({ 4, 10, 16 });
+    EXPECT_EQ(FireboltSDK::MessagePool::Configuration().threadLowWater, 4u);
+}
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include "Gateway/Gateway.h"
+
+#include <string>
+
+class MethodIdTest : public ::testing::Test {
+protected:
+    static constexpr size_t MethodCount = sizeof(FireboltSDK::MethodTable) / sizeof(FireboltSDK::MethodTable[0]);
+
+    // Notification name of an event, as the bidirectional server derived it before method ids
+    static std::string keyFromEvent(const std::string &event)
+    {
+        std::string key = event;
+        size_t dotPos = key.find('.');
+        if (dotPos != std::string::npos && dotPos + 3 < key.size() && key.substr(dotPos + 1, 2) == "on") {
+            key[dotPos + 3] = std::tolower(key[dotPos + 3]);
+            key.erase(dotPos + 1, 2);
+        }
+        return key;
+    }
+};
+
+static_assert(FireboltSDK::MethodIdOf("device.name") != FireboltSDK::UnknownMethod, "device.name is resolved at compile time");
+
+TEST_F(MethodIdTest, EveryMethodResolves) {
+    for (size_t id = 0; id < MethodCount; ++id) {
+        EXPECT_EQ(FireboltSDK::FindMethod(FireboltSDK::MethodTable[id].name), id) << FireboltSDK::MethodTable[id].name;
+    }
+}
+
+// Some notification names are methods as well, capabilities.available for one, so only resolving is checked
+TEST_F(MethodIdTest, EveryNotificationNameResolves) {
+    for (size_t id = 0; id < MethodCount; ++id) {
+        EXPECT_NE(FireboltSDK::FindMethod(keyFromEvent(FireboltSDK::MethodTable[id].name)), FireboltSDK::UnknownMethod) << FireboltSDK::MethodTable[id].name;
+    }
+}
+
+TEST_F(MethodIdTest, Lookup) {
+    FireboltSDK::MethodId id = FireboltSDK::FindMethod("advertising.onPolicyChanged");
+    EXPECT_NE(id, FireboltSDK::UnknownMethod);
+    EXPECT_EQ(FireboltSDK::FindMethod("ADVERTISING.ONPOLICYCHANGED"), id);
+    EXPECT_EQ(FireboltSDK::FindMethod("advertising.policyChanged"), id);
+    EXPECT_EQ(FireboltSDK::FindMethod("advertising.onPolicyChange"), FireboltSDK::UnknownMethod);
+    EXPECT_EQ(FireboltSDK::FindMethod("advertising.onPolicyChangedX"), FireboltSDK::UnknownMethod);
+    EXPECT_EQ(FireboltSDK::FindMethod(""), FireboltSDK::UnknownMethod);
+    EXPECT_EQ(FireboltSDK::MethodName(FireboltSDK::UnknownMethod), nullptr);
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include "Transport/serialqueues.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+class SerialQueuesTest : public ::testing::Test {
+protected:
+    static constexpr uint32_t Keys = 64;
+    static constexpr uint32_t EventsPerKey = 500;
+
+    struct Event {
+        uint32_t key;
+        uint32_t sequence;
+    };
+
+    static void WaitFor(const std::atomic<uint32_t>& handled, const uint32_t count)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while ((handled.load() < count) && (std::chrono::steady_clock::now() < deadline)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+};
+
+TEST_F(SerialQueuesTest, InOrderPerKey) {
+    std::vector<std::atomic<int64_t>> last(Keys);
+    for (auto& sequence : last) {
+        sequence = -1;
+    }
+    std::atomic<uint32_t> handled(0);
+    std::atomic<uint32_t> outOfOrder(0);
+
+    FireboltSDK::SerialQueues<uint32_t, Event> queues([&](const Event& event) {
+        int64_t previous = last[event.key].exchange(event.sequence);
+        if (previous + 1 != static_cast<int64_t>(event.sequence)) {
+            ++outOfOrder;
+        }
+        ++handled;
+    });
+
+    for (uint32_t sequence = 0; sequence < EventsPerKey; ++sequence) {
+        for (uint32_t key = 0; key < Keys; ++key) {
+            queues.Submit(key, Event{key, sequence});
+        }
+    }
+    WaitFor(handled, Keys * EventsPerKey);
+
+    EXPECT_EQ(handled.load(), Keys * EventsPerKey);
+    EXPECT_EQ(outOfOrder.load(), 0u);
+}
+
+TEST_F(SerialQueuesTest, RevokeDropsThePendingItems) {
+    std::atomic<uint32_t> handled(0);
+    std::atomic<bool> release(false);
+
+    FireboltSDK::SerialQueues<uint32_t, Event> queues([&](const Event&) {
+        while (release.load() == false) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        ++handled;
+    });
+
+    for (uint32_t sequence = 0; sequence < EventsPerKey; ++sequence) {
+        queues.Submit(0, Event{0, sequence});
+    }
+    std::thread releaser([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        release = true;
+    });
+
+    // Waits for the item being handled, if any, the others are gone
+    queues.Revoke();
+    EXPECT_LE(handled.load(), 1u);
+
+    queues.Submit(0, Event{0, EventsPerKey});
+    releaser.join();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_LE(handled.load(), 1u);
+}
@@ -20,6 +20,7 @@
 
 #include <gtest/gtest.h>
 #include "Gateway/Gateway.h"
+#include "Event/snapshot.h"
 
 class UniDirectionalGatewayTest : public ::testing::Test
 {
@@ -53,4 +54,27 @@ TEST_F(UniDirectionalGatewayTest, UnSubscribe)
     status = FireboltSDK::Gateway::Instance().Unsubscribe(eventName, parameters);
     EXPECT_EQ(status, Firebolt::Error::None) << "Error! status: " << static_cast<int32_t>(status);
 }
+
+TEST_F(UniDirectionalGatewayTest, EventSnapshot)
+{
+    using Snapshot = FireboltSDK::RcuSnapshot<std::vector<int>>;
+    Snapshot snapshot;
+    bool reclaimed = false;
+    {
+        Snapshot::Reader reader(snapshot);
+        std::unique_ptr<const std::vector<int>> former = snapshot.Exchange(std::unique_ptr<std::vector<int>>(new std::vector<int>{ 1 }));
+        const std::vector<int>* formerSnapshot = former.get();
+        EXPECT_EQ(&(*reader), formerSnapshot);
+
+        // Retired from within a read section, reclaimed once it is left
+        FireboltSDK::Epoch::Retire([&reclaimed, formerSnapshot]() { reclaimed = true; delete formerSnapshot; });
+        former.release();
+        EXPECT_FALSE(reclaimed);
+        EXPECT_TRUE(reader->empty());
+    }
+    EXPECT_TRUE(reclaimed);
+
+    Snapshot::Reader reader(snapshot);
+    EXPECT_EQ(reader->size(), 1u);
+}
 #endif
@@ -0,0 +1,160 @@
+#pragma once
+
+#ifdef ENABLE_IO_URING
+
+#include "Transport/uring.h"
+
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// Shared by uringTest and the uring benchmark
+namespace UringEcho {
+
+static constexpr uint16_t BufferSize = 4096;
+
+// Stand-in for the websocket server: echoes everything back, over loopback TCP
+class EchoServer {
+public:
+    EchoServer()
+        : _listener(::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0))
+        , _port(0)
+    {
+        struct sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t length = sizeof(address);
+        ::bind(_listener, reinterpret_cast<struct sockaddr*>(&address), length);
+        ::listen(_listener, 1);
+        ::getsockname(_listener, reinterpret_cast<struct sockaddr*>(&address), &length);
+        _port = ntohs(address.sin_port);
+        _thread = std::thread([this]() {
+            int connection = ::accept(_listener, nullptr, nullptr);
+            int one = 1;
+            ::setsockopt(connection, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+            char buffer[BufferSize];
+            ssize_t size;
+            while ((size = ::recv(connection, buffer, sizeof(buffer), 0)) > 0) {
+                ssize_t offset = 0;
+                while (offset < size) {
+                    ssize_t sent = ::send(connection, buffer + offset, size - offset, MSG_NOSIGNAL);
+                    if (sent <= 0) {
+                        break;
+                    }
+                    offset += sent;
+                }
+            }
+            ::close(connection);
+        });
+    }
+    ~EchoServer()
+    {
+        _thread.join();
+        ::close(_listener);
+    }
+
+    int Connect() const
+    {
+        int descriptor = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        struct sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = htons(_port);
+        ::connect(descriptor, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+        int one = 1;
+        ::setsockopt(descriptor, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        return descriptor;
+    }
+
+private:
+    int _listener;
+    uint16_t _port;
+    std::thread _thread;
+};
+
+// The websocket link's side of the engine: queued frames out, counted bytes in
+class Client {
+public:
+    Client(const bool preferUring)
+        : _descriptor(_server.Connect())
+        , _engine(_descriptor, BufferSize, BufferSize,
+              [this](uint8_t* buffer, const uint16_t maxSize) { return Pull(buffer, maxSize); },
+              [this](uint8_t* buffer, const uint16_t size) { return Push(buffer, size); },
+              [this]() { std::lock_guard<std::mutex> lck(_lock); _closed = true; _changed.notify_all(); })
+    {
+        _engine.Start(preferUring);
+    }
+    ~Client()
+    {
+        _engine.Stop();
+        ::close(_descriptor);
+    }
+
+    void Send(const std::string& message)
+    {
+        {
+            std::lock_guard<std::mutex> lck(_lock);
+            _outbound.push_back(message);
+        }
+        _engine.Trigger();
+    }
+
+    bool WaitFor(const size_t bytes)
+    {
+        std::unique_lock<std::mutex> lck(_lock);
+        return _changed.wait_for(lck, std::chrono::seconds(10), [&]() { return _echoed.size() >= bytes || _closed; }) && _echoed.size() >= bytes;
+    }
+
+    std::string Echoed()
+    {
+        std::lock_guard<std::mutex> lck(_lock);
+        return _echoed;
+    }
+
+    FireboltSDK::UringEngine& Engine()
+    {
+        return _engine;
+    }
+
+private:
+    uint16_t Pull(uint8_t* buffer, const uint16_t maxSize)
+    {
+        std::lock_guard<std::mutex> lck(_lock);
+        if (_outbound.empty() || _outbound.front().size() > maxSize) {
+            return 0;
+        }
+        uint16_t size = static_cast<uint16_t>(_outbound.front().size());
+        ::memcpy(buffer, _outbound.front().data(), size);
+        _outbound.pop_front();
+        return size;
+    }
+    uint16_t Push(uint8_t* buffer, const uint16_t size)
+    {
+        std::lock_guard<std::mutex> lck(_lock);
+        _echoed.append(reinterpret_cast<const char*>(buffer), size);
+        _changed.notify_all();
+        return size;
+    }
+
+private:
+    EchoServer _server;
+    int _descriptor;
+    std::mutex _lock;
+    std::condition_variable _changed;
+    std::deque<std::string> _outbound;
+    std::string _echoed;
+    bool _closed = false;
+    FireboltSDK::UringEngine _engine;
+};
+
+} // namespace UringEcho
+
+#endif
@@ -0,0 +1,71 @@
+#ifdef ENABLE_IO_URING
+
+#include <gtest/gtest.h>
+#include "uringEcho.h"
+
+#include <cstdio>
+#include <string>
+
+class UringEngineTest : public ::testing::Test {
+protected:
+    static constexpr uint32_t Messages = 200;
+    static constexpr uint16_t MessageSize = 64;
+
+    using Client = UringEcho::Client;
+
+    // One message in flight at a time, each echoed back whole and in order
+    static void PingPong(const bool preferUring)
+    {
+        Client client(preferUring);
+        std::string expected;
+        std::string message(MessageSize, 'x');
+        for (uint32_t index = 0; index < Messages; ++index) {
+            std::snprintf(&message[0], MessageSize, "%08u", index);
+            message[8] = 'x';
+            expected += message;
+            client.Send(message);
+            ASSERT_TRUE(client.WaitFor(expected.size()));
+        }
+        EXPECT_EQ(client.Echoed(), expected);
+        FireboltSDK::UringEngine::Statistics stats = client.Engine().Stats();
+        EXPECT_EQ(stats.sent, static_cast<uint64_t>(Messages) * MessageSize);
+        EXPECT_EQ(stats.received, static_cast<uint64_t>(Messages) * MessageSize);
+    }
+};
+
+TEST_F(UringEngineTest, FallsBackOnReadiness)
+{
+    Client client(false);
+    EXPECT_FALSE(client.Engine().IsUring());
+    client.Send("ping");
+    ASSERT_TRUE(client.WaitFor(4));
+    EXPECT_EQ(client.Echoed(), "ping");
+}
+
+TEST_F(UringEngineTest, BatchesQueuedFrames)
+{
+    Client client(true);
+    if (client.Engine().IsUring() == false) {
+        GTEST_SKIP() << "io_uring is not available on this kernel";
+    }
+    std::string expected;
+    for (uint32_t index = 0; index < 100; ++index) {
+        expected += "frame" + std::to_string(index) + ";";
+    }
+    // Queued before the engine gets to pull them, they go out gathered in the registered buffer
+    uint64_t before = client.Engine().Stats().syscalls;
+    for (uint32_t index = 0; index < 100; ++index) {
+        client.Send("frame" + std::to_string(index) + ";");
+    }
+    ASSERT_TRUE(client.WaitFor(expected.size()));
+    EXPECT_EQ(client.Echoed(), expected);
+    EXPECT_LT(client.Engine().Stats().syscalls - before, 100u);
+}
+
+TEST_F(UringEngineTest, EchoesEveryMessage)
+{
+    PingPong(false);
+    PingPong(true);
+}
+
+#endif
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include "Accessor/WorkerPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <vector>
+
+class WorkerPoolTest : public ::testing::Test {
+protected:
+    static constexpr uint8_t Threads = 4;
+    static constexpr uint32_t Jobs = 20000;
+
+    class Job : public WPEFramework::Core::IDispatch {
+    protected:
+        Job(const std::function<void()>& work)
+            : _work(work)
+        {
+        }
+
+    public:
+        Job() = delete;
+        Job(const Job&) = delete;
+        Job& operator=(const Job&) = delete;
+        ~Job() = default;
+
+        void Dispatch() override
+        {
+            _work();
+        }
+
+    private:
+        std::function<void()> _work;
+    };
+
+    static WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch> Make(const std::function<void()>& work)
+    {
+        return WPEFramework::Core::ProxyType<WPEFramework::Core::IDispatch>(WPEFramework::Core::ProxyType<Job>::Create(work));
+    }
+
+    static bool WaitFor(const std::atomic<uint32_t>& count, const uint32_t expected)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(20);
+        while ((count.load() < expected) && (std::chrono::steady_clock::now() < deadline)) {
+            std::this_thread::yield();
+        }
+        return (count.load() == expected);
+    }
+};
+
+TEST_F(WorkerPoolTest, RunsJobsSubmittedFromJobs) {
+    FireboltSDK::WorkStealingPool pool(Threads, WPEFramework::Core::Thread::DefaultStackSize());
+    pool.Run();
+
+    // Would exhaust a bounded queue: every job submits another one from its minion
+    std::atomic<uint32_t> done(0);
+    for (uint32_t index = 0; index < Jobs / 2; ++index) {
+        pool.Submit(Make([&pool, &done]() {
+            pool.Submit(Make([&done]() { ++done; }));
+            ++done;
+        }));
+    }
+    EXPECT_TRUE(WaitFor(done, Jobs));
+    pool.Stop();
+}
+
+TEST_F(WorkerPoolTest, Revoke) {
+    FireboltSDK::WorkStealingPool pool(1, WPEFramework::Core::Thread::DefaultStackSize());
+    pool.Run();
+
+    std::atomic<bool> started(false);
+    std::atomic<bool> release(false);
+    std::atomic<bool> ran(false);
+    auto blocker = Make([&]() {
+        started = true;
+        while (release == false) {
+            std::this_thread::yield();
+        }
+    });
+    auto pending = Make([&ran]() { ran = true; });
+
+    pool.Submit(blocker);
+    while (started == false) {
+        std::this_thread::yield();
+    }
+    pool.Submit(pending);
+    EXPECT_EQ(pool.Revoke(pending), WPEFramework::Core::ERROR_NONE);
+    EXPECT_EQ(pool.Revoke(blocker, 10), WPEFramework::Core::ERROR_TIMEDOUT);
+    release = true;
+    EXPECT_EQ(pool.Revoke(blocker), WPEFramework::Core::ERROR_NONE);
+    EXPECT_FALSE(ran);
+    pool.Stop();
+}
+
+TEST_F(WorkerPoolTest, GrowsWhenBlockedAndShrinksWhenIdle) {
+    FireboltSDK::WorkStealingPool pool(1, WPEFramework::Core::Thread::DefaultStackSize(), 3, 20, 200);
+    pool.Run();
+
+    // The only minion waits for a job that needs another one to run, as a synchronous request waiting for its response would
+    std::atomic<bool> started(false);
+    std::atomic<bool> answered(false);
+    std::atomic<uint32_t> done(0);
+    pool.Submit(Make([&]() {
+        started = true;
+        while (answered == false) {
+            std::this_thread::yield();
+        }
+        ++done;
+    }));
+    while (started == false) {
+        std::this_thread::yield();
+    }
+    pool.Submit(Make([&]() {
+        answered = true;
+        ++done;
+    }));
+    EXPECT_TRUE(WaitFor(done, 2));
+
+    FireboltSDK::WorkStealingPool::Statistics stats = pool.Stats();
+    EXPECT_GE(stats.grown, 1u);
+    EXPECT_GE(stats.peak, 2u);
+    EXPECT_LE(stats.peak, 3u);
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while ((pool.Stats().threads > 1) && (std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    stats = pool.Stats();
+    EXPECT_EQ(stats.threads, 1u);
+    EXPECT_EQ(stats.shrunk, stats.grown);
+
+    // Still runs jobs once shrunk, growing again if needed
+    done = 0;
+    for (uint32_t index = 0; index < 100; ++index) {
+        pool.Submit(Make([&done]() { ++done; }));
+    }
+    EXPECT_TRUE(WaitFor(done, 100));
+    pool.Stop();
+}
+
+// Several threads submitting at once, as the channel and the jobs themselves do: no job is lost or run twice
+TEST_F(WorkerPoolTest, RunsEveryJobOnceUnderLoad) {
+    static constexpr uint32_t Submitters = 4;
+
+    FireboltSDK::WorkStealingPool pool(Threads, WPEFramework::Core::Thread::DefaultStackSize());
+    pool.Run();
+
+    std::vector<std::atomic<uint32_t>> runs(Jobs);
+    for (auto& count : runs) {
+        count = 0;
+    }
+    std::atomic<uint32_t> done(0);
+    std::vector<std::thread> submitters;
+    for (uint32_t submitter = 0; submitter < Submitters; ++submitter) {
+        submitters.emplace_back([&, submitter]() {
+            for (uint32_t index = submitter; index < Jobs; index += Submitters) {
+                pool.Submit(Make([&runs, &done, index]() {
+                    ++runs[index];
+                    ++done;
+                }));
+            }
+        });
+    }
+    for (auto& submitter : submitters) {
+        submitter.join();
+    }
+    EXPECT_TRUE(WaitFor(done, Jobs));
+    pool.Stop();
+
+    EXPECT_EQ(done.load(), Jobs);
+    EXPECT_EQ(std::count_if(runs.begin(), runs.end(), [](const std::atomic<uint32_t>& count) { return (count.load() != 1); }), 0);
+}